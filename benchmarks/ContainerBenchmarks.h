@@ -11,6 +11,8 @@
 #define BENCHMARK_CONTAINER_BENCHMARKS_H
 
 #include <cassert>
+#include <iterator>
+#include <utility>
 
 #include "Utilities.h"
 #include "benchmark/benchmark.h"
@@ -47,6 +49,31 @@ void BM_ConstructIterIter(benchmark::State& st, Container, GenInputs gen) {
     }
 }
 
+// Grows the capacity and shrinks it back, which moves all the elements to new storage twice.
+template <class Container, class GenInputs>
+void BM_ReserveShrink(benchmark::State& st, Container, GenInputs gen) {
+    auto in = gen(st.range(0));
+    Container c(std::make_move_iterator(in.begin()), std::make_move_iterator(in.end()));
+    for (auto _ : st) {
+        c.reserve(2 * c.size());
+        c.shrink_to_fit();
+        DoNotOptimizeData(c);
+    }
+}
+
+// Erases the first element and appends it again, which moves all the others down by one.
+template <class Container, class GenInputs>
+void BM_EraseFront(benchmark::State& st, Container, GenInputs gen) {
+    auto in = gen(st.range(0));
+    Container c(std::make_move_iterator(in.begin()), std::make_move_iterator(in.end()));
+    for (auto _ : st) {
+        typename Container::value_type v = std::move(c.front());
+        c.erase(c.begin());
+        c.push_back(std::move(v));
+        DoNotOptimizeData(c);
+    }
+}
+
 template <class Container, class GenInputs>
 void BM_InsertValue(benchmark::State& st, Container c, GenInputs gen) {
     auto in = gen(st.range(0));
@@ -106,6 +133,22 @@ void BM_EmplaceDuplicate(benchmark::State& st, Container c, GenInputs gen) {
     }
 }
 
+template <class Container, class GenInputs>
+void BM_EraseInsert(benchmark::State& st, Container c, GenInputs gen) {
+    auto in = gen(st.range(0));
+    const auto end = in.end();
+    c.insert(in.begin(), in.end());
+    benchmark::DoNotOptimize(&c);
+    benchmark::DoNotOptimize(&in);
+    while (st.KeepRunning()) {
+        for (auto it = in.begin(); it != end; ++it) {
+            c.erase(*it);
+            benchmark::DoNotOptimize(&(*c.insert(*it).first));
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
 template <class Container, class GenInputs>
 static void BM_Find(benchmark::State& st, Container c, GenInputs gen) {
     auto in = gen(st.range(0));
@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Scans contiguous ranges of integers of every width with find, count,
+// mismatch and equal. The ranges are equal and don't hold the value searched
+// for, so every algorithm looks at every element.
+
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "CartesianBenchmarks.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+enum class ElementWidth { Uint8, Uint16, Uint32, Uint64 };
+struct AllElementWidths : EnumValuesAsTuple<AllElementWidths, ElementWidth, 4> {
+  static constexpr const char* Names[] = {"uint8", "uint16", "uint32", "uint64"};
+};
+
+using ElementTypes = std::tuple<uint8_t, uint16_t, uint32_t, uint64_t>;
+
+template <class Width>
+using Element = std::tuple_element_t<(int)Width::value, ElementTypes>;
+
+enum class Algorithm { Find, Count, Mismatch, Equal };
+struct AllAlgorithms : EnumValuesAsTuple<AllAlgorithms, Algorithm, 4> {
+  static constexpr const char* Names[] = {"Find", "Count", "Mismatch", "Equal"};
+};
+
+template <class Width, class Alg>
+struct Scan {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    using T = Element<Width>;
+    std::vector<T> A(Quantity, T(1));
+    std::vector<T> B(Quantity, T(1));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(A.data());
+      benchmark::DoNotOptimize(B.data());
+      switch (Alg()) {
+      case Algorithm::Find:
+        benchmark::DoNotOptimize(std::find(A.begin(), A.end(), T(2)));
+        break;
+      case Algorithm::Count:
+        benchmark::DoNotOptimize(std::count(A.begin(), A.end(), T(1)));
+        break;
+      case Algorithm::Mismatch:
+        benchmark::DoNotOptimize(std::mismatch(A.begin(), A.end(), B.begin()));
+        break;
+      case Algorithm::Equal:
+        benchmark::DoNotOptimize(std::equal(A.begin(), A.end(), B.begin()));
+        break;
+      }
+    }
+    state.SetBytesProcessed(state.iterations() * Quantity * sizeof(T));
+  }
+
+  std::string name() const { return "BM_" + Alg::name() + Width::name() + "_" + std::to_string(Quantity); }
+};
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  const std::vector<size_t> Quantities = {1 << 4, 1 << 6, 1 << 8, 1 << 12, 1 << 16, 1 << 20};
+  makeCartesianProductBenchmark<Scan, AllElementWidths, AllAlgorithms>(Quantities);
+  benchmark::RunSpecifiedBenchmarks();
+}
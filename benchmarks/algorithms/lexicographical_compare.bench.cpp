@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Orders two ranges of Quantity integers that only differ in their last
+// element, with lexicographical_compare and lexicographical_compare_three_way,
+// and sorts 2^16 byte strings of Quantity bytes that share half of their
+// bytes, like keys with a common prefix.
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "CartesianBenchmarks.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+enum class ValueType { Uint8, Uint16, Uint32, Uint64 };
+struct AllValueTypes : EnumValuesAsTuple<AllValueTypes, ValueType, 4> {
+  static constexpr const char* Names[] = {"uint8", "uint16", "uint32", "uint64"};
+};
+
+using Types = std::tuple<uint8_t, uint16_t, uint32_t, uint64_t>;
+
+template <class V>
+using Value = std::tuple_element_t<(int)V::value, Types>;
+
+enum class Algorithm { LexicographicalCompare, ThreeWay };
+struct AllAlgorithms : EnumValuesAsTuple<AllAlgorithms, Algorithm, 2> {
+  static constexpr const char* Names[] = {"LexicographicalCompare", "LexicographicalCompareThreeWay"};
+};
+
+template <class V, class Alg>
+struct Compare {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    using T = Value<V>;
+    std::vector<T> X(Quantity);
+    for (size_t I = 0; I != Quantity; ++I)
+      X[I] = T(I * 37);
+    std::vector<T> Y = X;
+    Y.back() = T(Y.back() + 1);
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(X);
+      benchmark::DoNotOptimize(Y);
+      if (Alg() == Algorithm::LexicographicalCompare)
+        benchmark::DoNotOptimize(std::lexicographical_compare(X.begin(), X.end(), Y.begin(), Y.end()));
+      else
+        benchmark::DoNotOptimize(std::lexicographical_compare_three_way(X.begin(), X.end(), Y.begin(), Y.end()));
+    }
+  }
+
+  std::string name() const { return "BM_" + Alg::name() + V::name() + "_" + std::to_string(Quantity); }
+};
+
+void BM_SortKeys(benchmark::State& state) {
+  const size_t Length = state.range(0);
+  const size_t Keys = 1 << 16;
+  std::mt19937 Gen(Length);
+  std::vector<std::vector<uint8_t>> Input(Keys, std::vector<uint8_t>(Length));
+  for (auto& Key : Input)
+    for (size_t I = Length / 2; I != Length; ++I)
+      Key[I] = static_cast<uint8_t>(Gen());
+
+  std::vector<std::vector<uint8_t>> Copy;
+  for (auto _ : state) {
+    state.PauseTiming();
+    Copy = Input;
+    state.ResumeTiming();
+    std::sort(Copy.begin(), Copy.end());
+    benchmark::DoNotOptimize(Copy.data());
+  }
+}
+BENCHMARK(BM_SortKeys)->Arg(8)->Arg(32)->Arg(256);
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  const std::vector<size_t> Quantities = {1 << 3, 1 << 6, 1 << 10, 1 << 16};
+  makeCartesianProductBenchmark<Compare, AllValueTypes, AllAlgorithms>(Quantities);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -31,6 +31,37 @@ struct LowerBound {
     return "BM_LowerBound" + ValueType::name() + "_" + std::to_string(Quantity);
   }
 };
+
+// Looks up random values in a single sorted range much larger than the L2 cache, where the search is
+// bound by the latency of the loads more than by the comparisons.
+template <class ValueType>
+struct LowerBoundLarge {
+  size_t Quantity;
+
+  mutable std::mt19937_64 rng { std::random_device{}() };
+
+  void run(benchmark::State& state) const {
+    std::vector<Value<ValueType> > Values;
+    fillValues(Values, Quantity, Order::Ascending);
+    const size_t Lookups = 1024;
+    std::vector<Value<ValueType> > Keys;
+    for (size_t I = 0; I != Lookups; ++I)
+      Keys.push_back(Values[rng() % Values.size()]);
+    while (state.KeepRunningBatch(Lookups)) {
+      for (auto& Key : Keys)
+        benchmark::DoNotOptimize(std::lower_bound(Values.begin(), Values.end(), Key));
+    }
+  }
+
+  bool skip() const {
+    return ValueType() != ::ValueType::Uint32 && ValueType() != ::ValueType::Uint64 &&
+           ValueType() != ::ValueType::Float;
+  }
+
+  std::string name() const {
+    return "BM_LowerBoundLarge" + ValueType::name() + "_" + std::to_string(Quantity);
+  }
+};
 } // namespace
 
 int main(int argc, char** argv) {
@@ -38,5 +69,6 @@ int main(int argc, char** argv) {
   if (benchmark::ReportUnrecognizedArguments(argc, argv))
     return 1;
   makeCartesianProductBenchmark<LowerBound, AllValueTypes>(Quantities);
+  makeCartesianProductBenchmark<LowerBoundLarge, AllValueTypes>(std::vector<size_t>{1 << 20, 1 << 22, 1 << 24});
   benchmark::RunSpecifiedBenchmarks();
 }
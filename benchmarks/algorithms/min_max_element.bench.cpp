@@ -11,6 +11,36 @@
 #include "common.h"
 
 namespace {
+template <class ValueType, class Order>
+struct MinElement {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    runOpOnCopies<ValueType>(state, Quantity, Order(), BatchSize::CountElements, [](auto& Copy) {
+      benchmark::DoNotOptimize(std::min_element(Copy.begin(), Copy.end()));
+    });
+  }
+
+  std::string name() const {
+    return "BM_MinElement" + ValueType::name() + Order::name() + "_" + std::to_string(Quantity);
+  }
+};
+
+template <class ValueType, class Order>
+struct MaxElement {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    runOpOnCopies<ValueType>(state, Quantity, Order(), BatchSize::CountElements, [](auto& Copy) {
+      benchmark::DoNotOptimize(std::max_element(Copy.begin(), Copy.end()));
+    });
+  }
+
+  std::string name() const {
+    return "BM_MaxElement" + ValueType::name() + Order::name() + "_" + std::to_string(Quantity);
+  }
+};
+
 template <class ValueType, class Order>
 struct MinMaxElement {
   size_t Quantity;
@@ -31,6 +61,8 @@ int main(int argc, char** argv) {
   benchmark::Initialize(&argc, argv);
   if (benchmark::ReportUnrecognizedArguments(argc, argv))
     return 1;
+  makeCartesianProductBenchmark<MinElement, AllValueTypes, AllOrders>(Quantities);
+  makeCartesianProductBenchmark<MaxElement, AllValueTypes, AllOrders>(Quantities);
   makeCartesianProductBenchmark<MinMaxElement, AllValueTypes, AllOrders>(Quantities);
   benchmark::RunSpecifiedBenchmarks();
 }
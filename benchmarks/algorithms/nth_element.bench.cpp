@@ -0,0 +1,150 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "common.h"
+
+namespace {
+template <class ValueType, class Order>
+struct NthElement {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    runOpOnCopies<ValueType>(
+        state, Quantity, Order(), BatchSize::CountElements, [](auto& Copy) {
+          std::nth_element(Copy.begin(), Copy.begin() + Copy.size() / 2,
+                           Copy.end());
+        });
+  }
+
+  std::string name() const {
+    return "BM_NthElement" + ValueType::name() + Order::name() + "_" +
+           std::to_string(Quantity);
+  };
+};
+
+// Sorts the 16 smallest elements. Large ranges keep them in a heap.
+template <class ValueType, class Order>
+struct PartialSortFew {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    runOpOnCopies<ValueType>(
+        state, Quantity, Order(), BatchSize::CountElements, [](auto& Copy) {
+          std::partial_sort(Copy.begin(),
+                            Copy.begin() + std::min<size_t>(Copy.size(), 16),
+                            Copy.end());
+        });
+  }
+
+  std::string name() const {
+    return "BM_PartialSortFew" + ValueType::name() + Order::name() + "_" +
+           std::to_string(Quantity);
+  };
+};
+
+template <class ValueType, class Order>
+struct PartialSortHalf {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    runOpOnCopies<ValueType>(
+        state, Quantity, Order(), BatchSize::CountElements, [](auto& Copy) {
+          std::partial_sort(Copy.begin(), Copy.begin() + Copy.size() / 2,
+                            Copy.end());
+        });
+  }
+
+  std::string name() const {
+    return "BM_PartialSortHalf" + ValueType::name() + Order::name() + "_" +
+           std::to_string(Quantity);
+  };
+};
+
+// Like fillAdversarialQuickSortInput, but against nth_element itself: the
+// values are decided as nth_element compares them, so that each pivot it
+// picks is as small as possible.
+template <class T>
+void fillAdversarialQuickSelectInput(std::vector<T>& V, size_t N) {
+  const unsigned int gas = N - 1;
+  V.assign(N, gas);
+  int candidate = 0;
+  int nsolid = 0;
+  std::vector<int> ascVals(N);
+  std::iota(ascVals.begin(), ascVals.end(), 0);
+  std::nth_element(ascVals.begin(), ascVals.begin() + N / 2, ascVals.end(),
+                   [&](int x, int y) {
+                     if (V[x] == gas && V[y] == gas) {
+                       if (x == candidate) {
+                         V[x] = nsolid++;
+                       } else {
+                         V[y] = nsolid++;
+                       }
+                     }
+                     if (V[x] == gas) {
+                       candidate = x;
+                     } else if (V[y] == gas) {
+                       candidate = y;
+                     }
+                     return V[x] < V[y];
+                   });
+}
+
+struct IntegerValueTypes
+    : EnumValuesAsTuple<IntegerValueTypes, ValueType, 2> {
+  static constexpr const char* Names[] = {"uint32", "uint64"};
+};
+
+template <class ValueType>
+struct NthElementAdversary {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    using T = Value<ValueType>;
+    std::vector<std::vector<T> > Copies(
+        std::max(size_t{1}, TestSetElements / Quantity));
+    for (auto& Copy : Copies)
+      fillAdversarialQuickSelectInput(Copy, Quantity);
+    auto Orig = Copies;
+
+    while (state.KeepRunningBatch(Copies.size() * Quantity)) {
+      for (auto& Copy : Copies) {
+        std::nth_element(Copy.begin(), Copy.begin() + Copy.size() / 2,
+                         Copy.end());
+        benchmark::DoNotOptimize(Copy);
+      }
+      state.PauseTiming();
+      Copies = Orig;
+      state.ResumeTiming();
+    }
+  }
+
+  std::string name() const {
+    return "BM_NthElementAdversary" + ValueType::name() + "_" +
+           std::to_string(Quantity);
+  };
+};
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  makeCartesianProductBenchmark<NthElement, AllValueTypes, AllOrders>(
+      Quantities);
+  makeCartesianProductBenchmark<NthElementAdversary, IntegerValueTypes>(
+      Quantities);
+  makeCartesianProductBenchmark<PartialSortFew, AllValueTypes, AllOrders>(
+      Quantities);
+  makeCartesianProductBenchmark<PartialSortHalf, AllValueTypes, AllOrders>(
+      Quantities);
+  benchmark::RunSpecifiedBenchmarks();
+}
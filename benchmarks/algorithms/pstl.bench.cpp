@@ -0,0 +1,167 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Compares the sequential and the parallel execution policies. The parallel
+// benchmarks take the number of elements and the number of threads taking part
+// in the algorithm, where 0 stands for one thread per hardware thread.
+
+#include <algorithm>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "../GenerateInput.h"
+
+namespace {
+
+const std::vector<int64_t> Sizes = {1 << 10, 1 << 14, 1 << 18, 1 << 22};
+const std::vector<int64_t> Threads = {1, 2, 4, 8, 0};
+
+struct SeqTag {
+  static const auto& policy() { return std::execution::seq; }
+};
+
+struct ParTag {
+  static const auto& policy() { return std::execution::par; }
+};
+
+// Limits the number of threads used by the parallel algorithms for the
+// duration of a benchmark.
+class ConcurrencyScope {
+public:
+  explicit ConcurrencyScope(unsigned N) {
+#ifdef _LIBCPP_VERSION
+    std::__par_backend::__set_max_concurrency(N);
+#endif
+  }
+  ~ConcurrencyScope() {
+#ifdef _LIBCPP_VERSION
+    std::__par_backend::__set_max_concurrency(0);
+#endif
+  }
+};
+
+template <class Body>
+void runBenchmark(benchmark::State& state, Body body) {
+  ConcurrencyScope Scope(state.range(1));
+  for (auto _ : state)
+    body(state);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class Tag>
+void BM_ForEach(benchmark::State& state) {
+  std::vector<uint64_t> V = getRandomIntegerInputs<uint64_t>(state.range(0));
+  runBenchmark(state, [&](benchmark::State&) {
+    std::for_each(Tag::policy(), V.begin(), V.end(), [](uint64_t& X) { X = X * 2654435761u + 1; });
+    benchmark::DoNotOptimize(V.data());
+  });
+}
+
+template <class Tag>
+void BM_Transform(benchmark::State& state) {
+  std::vector<uint64_t> In = getRandomIntegerInputs<uint64_t>(state.range(0));
+  std::vector<uint64_t> Out(In.size());
+  runBenchmark(state, [&](benchmark::State&) {
+    std::transform(Tag::policy(), In.begin(), In.end(), Out.begin(), [](uint64_t X) { return X * 3 + 1; });
+    benchmark::DoNotOptimize(Out.data());
+  });
+}
+
+template <class Tag>
+void BM_Reduce(benchmark::State& state) {
+  std::vector<uint64_t> V = getRandomIntegerInputs<uint64_t>(state.range(0));
+  runBenchmark(state, [&](benchmark::State&) {
+    benchmark::DoNotOptimize(std::reduce(Tag::policy(), V.begin(), V.end()));
+  });
+}
+
+template <class Tag>
+void BM_TransformReduce(benchmark::State& state) {
+  std::vector<double> A(state.range(0), 1.5);
+  std::vector<double> B(state.range(0), 2.5);
+  runBenchmark(state, [&](benchmark::State&) {
+    benchmark::DoNotOptimize(std::transform_reduce(Tag::policy(), A.begin(), A.end(), B.begin(), 0.0));
+  });
+}
+
+template <class Tag>
+void BM_InclusiveScan(benchmark::State& state) {
+  std::vector<uint64_t> In = getRandomIntegerInputs<uint64_t>(state.range(0));
+  std::vector<uint64_t> Out(In.size());
+  runBenchmark(state, [&](benchmark::State&) {
+    std::inclusive_scan(Tag::policy(), In.begin(), In.end(), Out.begin());
+    benchmark::DoNotOptimize(Out.data());
+  });
+}
+
+template <class Tag>
+void BM_CopyIf(benchmark::State& state) {
+  std::vector<uint64_t> In = getRandomIntegerInputs<uint64_t>(state.range(0));
+  std::vector<uint64_t> Out(In.size());
+  runBenchmark(state, [&](benchmark::State&) {
+    benchmark::DoNotOptimize(
+        std::copy_if(Tag::policy(), In.begin(), In.end(), Out.begin(), [](uint64_t X) { return X % 2 == 0; }));
+  });
+}
+
+template <class Tag>
+void BM_Sort(benchmark::State& state) {
+  const std::vector<uint64_t> Orig = getRandomIntegerInputs<uint64_t>(state.range(0));
+  std::vector<uint64_t> V;
+  runBenchmark(state, [&](benchmark::State& S) {
+    S.PauseTiming();
+    V = Orig;
+    S.ResumeTiming();
+    std::sort(Tag::policy(), V.begin(), V.end());
+    benchmark::DoNotOptimize(V.data());
+  });
+}
+
+template <class Tag>
+void BM_StableSort(benchmark::State& state) {
+  const std::vector<uint64_t> Orig = getRandomIntegerInputs<uint64_t>(state.range(0));
+  std::vector<uint64_t> V;
+  runBenchmark(state, [&](benchmark::State& S) {
+    S.PauseTiming();
+    V = Orig;
+    S.ResumeTiming();
+    std::stable_sort(Tag::policy(), V.begin(), V.end());
+    benchmark::DoNotOptimize(V.data());
+  });
+}
+
+void SeqArgs(benchmark::internal::Benchmark* B) {
+  for (int64_t Size : Sizes)
+    B->ArgPair(Size, 1);
+}
+
+void ParArgs(benchmark::internal::Benchmark* B) {
+  for (int64_t Size : Sizes)
+    for (int64_t Thread : Threads)
+      B->ArgPair(Size, Thread);
+}
+
+} // namespace
+
+#define PSTL_BENCHMARK(Name)                                                                                           \
+  BENCHMARK_TEMPLATE(Name, SeqTag)->Apply(SeqArgs)->UseRealTime();                                                     \
+  BENCHMARK_TEMPLATE(Name, ParTag)->Apply(ParArgs)->UseRealTime()
+
+PSTL_BENCHMARK(BM_ForEach);
+PSTL_BENCHMARK(BM_Transform);
+PSTL_BENCHMARK(BM_Reduce);
+PSTL_BENCHMARK(BM_TransformReduce);
+PSTL_BENCHMARK(BM_InclusiveScan);
+PSTL_BENCHMARK(BM_CopyIf);
+PSTL_BENCHMARK(BM_Sort);
+PSTL_BENCHMARK(BM_StableSort);
+
+BENCHMARK_MAIN();
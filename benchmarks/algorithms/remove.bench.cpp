@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Compacts a range of Quantity elements, of which a given percentage are
+// dropped at random positions. Dropping none or few of them is predictable,
+// while dropping half of them defeats branch prediction. remove and remove_if
+// work on a fresh copy of the input at every iteration, and unique drops the
+// elements that repeat the one before them.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "CartesianBenchmarks.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+enum class ValueType { Uint32, Uint64 };
+struct AllValueTypes : EnumValuesAsTuple<AllValueTypes, ValueType, 2> {
+  static constexpr const char* Names[] = {"uint32", "uint64"};
+};
+
+using Types = std::tuple<uint32_t, uint64_t>;
+
+template <class V>
+using Value = std::tuple_element_t<(int)V::value, Types>;
+
+enum class Algorithm { Remove, RemoveIf, Unique, CopyIf };
+struct AllAlgorithms : EnumValuesAsTuple<AllAlgorithms, Algorithm, 4> {
+  static constexpr const char* Names[] = {"Remove", "RemoveIf", "Unique", "CopyIf"};
+};
+
+enum class Dropped { None, Few, Half };
+struct AllDropped : EnumValuesAsTuple<AllDropped, Dropped, 3> {
+  static constexpr const char* Names[] = {"Dropped0", "Dropped1", "Dropped50"};
+};
+
+unsigned percentage(Dropped D) {
+  switch (D) {
+  case Dropped::None:
+    return 0;
+  case Dropped::Few:
+    return 1;
+  case Dropped::Half:
+    return 50;
+  }
+  return 0;
+}
+
+// Returns Quantity elements that are 1, 3 or 5, except for the given
+// percentage of them, which are 7. For unique, the dropped elements repeat
+// the one before them instead.
+template <class T>
+std::vector<T> getInput(size_t Quantity, Algorithm A, unsigned Percentage) {
+  std::mt19937 Gen(Quantity);
+  std::vector<T> Input(Quantity);
+  for (size_t I = 0; I != Quantity; ++I) {
+    bool Drop = Gen() % 100 < Percentage;
+    if (A == Algorithm::Unique)
+      Input[I] = I != 0 && Drop ? Input[I - 1] : T(I);
+    else
+      Input[I] = Drop ? T(7) : T(1 + Gen() % 3 * 2);
+  }
+  return Input;
+}
+
+struct IsSeven {
+  template <class T>
+  bool operator()(T X) const {
+    return X == 7;
+  }
+};
+
+struct IsNotSeven {
+  template <class T>
+  bool operator()(T X) const {
+    return X != 7;
+  }
+};
+
+template <class V, class Alg, class D>
+struct Compact {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    using T = Value<V>;
+    const std::vector<T> Input = getInput<T>(Quantity, Alg(), percentage(D()));
+    std::vector<T> Out(Quantity);
+
+    for (auto _ : state) {
+      switch (Alg()) {
+      case Algorithm::Remove:
+        std::copy(Input.begin(), Input.end(), Out.begin());
+        benchmark::DoNotOptimize(std::remove(Out.begin(), Out.end(), T(7)));
+        break;
+      case Algorithm::RemoveIf:
+        std::copy(Input.begin(), Input.end(), Out.begin());
+        benchmark::DoNotOptimize(std::remove_if(Out.begin(), Out.end(), IsSeven()));
+        break;
+      case Algorithm::Unique:
+        std::copy(Input.begin(), Input.end(), Out.begin());
+        benchmark::DoNotOptimize(std::unique(Out.begin(), Out.end()));
+        break;
+      case Algorithm::CopyIf:
+        benchmark::DoNotOptimize(std::copy_if(Input.begin(), Input.end(), Out.begin(), IsNotSeven()));
+        break;
+      }
+      benchmark::ClobberMemory();
+    }
+  }
+
+  std::string name() const {
+    return "BM_" + Alg::name() + V::name() + "_" + D::name() + "_" + std::to_string(Quantity);
+  }
+};
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  const std::vector<size_t> Quantities = {1 << 10, 1 << 16, 1 << 20};
+  makeCartesianProductBenchmark<Compact, AllValueTypes, AllAlgorithms, AllDropped>(Quantities);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,126 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Searches random lowercase text for a fixed set of needles, which are built
+// once and reused for every haystack, as a text filter would. Each needle
+// occurs once in its haystack, close to the end. Copy measures handing a
+// searcher to another thread, which takes its own copy.
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "CartesianBenchmarks.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+enum class Searcher { Default, BoyerMoore, BoyerMooreHorspool, StringFind };
+struct AllSearchers : EnumValuesAsTuple<AllSearchers, Searcher, 4> {
+  static constexpr const char* Names[] = {"DefaultSearcher", "BoyerMooreSearcher", "BoyerMooreHorspoolSearcher",
+                                          "StringFind"};
+};
+
+using Iter = std::string::const_iterator;
+
+// string::find has no searcher, and keeps the needle itself.
+using Searchers = std::tuple<std::default_searcher<Iter>, std::boyer_moore_searcher<Iter>,
+                             std::boyer_moore_horspool_searcher<Iter>, const std::string*>;
+
+template <class S>
+using SearcherFor = std::tuple_element_t<(int)S::value, Searchers>;
+
+constexpr size_t NumNeedles = 8;
+
+std::string getRandomText(std::mt19937& Gen, size_t Length) {
+  std::string Text(Length, 'a');
+  for (char& C : Text)
+    C = static_cast<char>('a' + Gen() % 26);
+  return Text;
+}
+
+template <class S>
+SearcherFor<S> makeSearcher(const std::string& Needle) {
+  if constexpr (S() == Searcher::StringFind)
+    return &Needle;
+  else
+    return SearcherFor<S>(Needle.begin(), Needle.end());
+}
+
+template <class S>
+size_t search(const SearcherFor<S>& Compiled, const std::string& Haystack) {
+  if constexpr (S() == Searcher::StringFind)
+    return Haystack.find(*Compiled);
+  else
+    return std::search(Haystack.begin(), Haystack.end(), Compiled) - Haystack.begin();
+}
+
+template <class S>
+struct Search {
+  size_t NeedleLength;
+  size_t HaystackLength;
+
+  void run(benchmark::State& state) const {
+    std::mt19937 Gen(NeedleLength);
+    std::vector<std::string> Needles;
+    std::vector<std::string> Haystacks;
+    for (size_t I = 0; I != NumNeedles; ++I) {
+      Needles.push_back(getRandomText(Gen, NeedleLength));
+      Haystacks.push_back(getRandomText(Gen, HaystackLength));
+      Haystacks.back().replace(HaystackLength - NeedleLength - I, NeedleLength, Needles.back());
+    }
+    std::vector<SearcherFor<S>> Compiled;
+    for (const std::string& Needle : Needles)
+      Compiled.push_back(makeSearcher<S>(Needle));
+
+    for (auto _ : state) {
+      for (size_t I = 0; I != NumNeedles; ++I)
+        benchmark::DoNotOptimize(search<S>(Compiled[I], Haystacks[I]));
+    }
+    state.SetBytesProcessed(state.iterations() * NumNeedles * HaystackLength);
+  }
+
+  bool skip() const { return NeedleLength + NumNeedles > HaystackLength; }
+
+  std::string name() const {
+    return "BM_Search" + S::name() + "_Needle" + std::to_string(NeedleLength) + "_" + std::to_string(HaystackLength);
+  }
+};
+
+template <class S>
+struct Copy {
+  size_t NeedleLength;
+
+  void run(benchmark::State& state) const {
+    std::mt19937 Gen(NeedleLength);
+    const std::string Needle = getRandomText(Gen, NeedleLength);
+    const SearcherFor<S> Original = makeSearcher<S>(Needle);
+    for (auto _ : state) {
+      SearcherFor<S> Copied = Original;
+      benchmark::DoNotOptimize(Copied);
+    }
+  }
+
+  bool skip() const { return S() == ::Searcher::StringFind; }
+
+  std::string name() const { return "BM_Copy" + S::name() + "_Needle" + std::to_string(NeedleLength); }
+};
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  const std::vector<size_t> NeedleLengths = {2, 8, 32, 128, 1024};
+  const std::vector<size_t> HaystackLengths = {1 << 10, 1 << 16};
+  makeCartesianProductBenchmark<Search, AllSearchers>(NeedleLengths, HaystackLengths);
+  makeCartesianProductBenchmark<Copy, AllSearchers>(NeedleLengths);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Combines a sorted range of Quantity elements with a sorted range that is
+// Ratio times smaller. With a ratio of one, the elements of both ranges
+// interleave and every algorithm looks at every element. With larger ratios,
+// the elements of the larger range come in long runs between two elements of
+// the smaller one.
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+#include "CartesianBenchmarks.h"
+#include "GenerateInput.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+enum class ValueType { Uint32, Uint64 };
+struct AllValueTypes : EnumValuesAsTuple<AllValueTypes, ValueType, 2> {
+  static constexpr const char* Names[] = {"uint32", "uint64"};
+};
+
+using Types = std::tuple<uint32_t, uint64_t>;
+
+template <class V>
+using Value = std::tuple_element_t<(int)V::value, Types>;
+
+enum class Algorithm { Intersection, Union, Difference };
+struct AllAlgorithms : EnumValuesAsTuple<AllAlgorithms, Algorithm, 3> {
+  static constexpr const char* Names[] = {"Intersection", "Union", "Difference"};
+};
+
+enum class Ratio { One, Sixteen, Thousand };
+struct AllRatios : EnumValuesAsTuple<AllRatios, Ratio, 3> {
+  static constexpr const char* Names[] = {"Ratio1", "Ratio16", "Ratio1000"};
+};
+
+size_t ratio(Ratio R) {
+  switch (R) {
+  case Ratio::One:
+    return 1;
+  case Ratio::Sixteen:
+    return 16;
+  case Ratio::Thousand:
+    return 1000;
+  }
+  return 1;
+}
+
+template <class V, class Alg, class R>
+struct SetOperation {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    using T = Value<V>;
+    std::vector<T> Large = getRandomIntegerInputs<T>(Quantity);
+    std::vector<T> Small = getRandomIntegerInputs<T>(std::max<size_t>(Quantity / ratio(R()), 1));
+    std::sort(Large.begin(), Large.end());
+    std::sort(Small.begin(), Small.end());
+    std::vector<T> Out(Large.size() + Small.size());
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(Large.data());
+      benchmark::DoNotOptimize(Small.data());
+      switch (Alg()) {
+      case Algorithm::Intersection:
+        benchmark::DoNotOptimize(
+            std::set_intersection(Large.begin(), Large.end(), Small.begin(), Small.end(), Out.begin()));
+        break;
+      case Algorithm::Union:
+        benchmark::DoNotOptimize(std::set_union(Large.begin(), Large.end(), Small.begin(), Small.end(), Out.begin()));
+        break;
+      case Algorithm::Difference:
+        benchmark::DoNotOptimize(
+            std::set_difference(Large.begin(), Large.end(), Small.begin(), Small.end(), Out.begin()));
+        break;
+      }
+      benchmark::ClobberMemory();
+    }
+  }
+
+  std::string name() const {
+    return "BM_Set" + Alg::name() + V::name() + "_" + R::name() + "_" + std::to_string(Quantity);
+  }
+};
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  const std::vector<size_t> Quantities = {1 << 10, 1 << 16, 1 << 20};
+  makeCartesianProductBenchmark<SetOperation, AllValueTypes, AllAlgorithms, AllRatios>(Quantities);
+  benchmark::RunSpecifiedBenchmarks();
+}
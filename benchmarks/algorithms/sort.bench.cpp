@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <algorithm>
+#include <type_traits>
 
 #include "common.h"
 
@@ -28,6 +29,43 @@ struct Sort {
            std::to_string(Quantity);
   };
 };
+
+// std::sort radix sorts large ranges of arithmetic values compared with the
+// default comparator. Sorting them with an equivalent lambda always uses the
+// comparison sort, which shows where the radix sort starts paying off.
+template <class ValueType, class Order>
+struct SortWithComparator {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    runOpOnCopies<ValueType>(
+        state, Quantity, Order(), BatchSize::CountElements, [](auto& Copy) {
+          std::sort(Copy.begin(), Copy.end(),
+                    [](const auto& A, const auto& B) { return A < B; });
+        });
+  }
+
+  bool skip() const {
+    return Order() != ::Order::Random ||
+           !std::is_arithmetic<Value<ValueType> >::value;
+  }
+
+  std::string name() const {
+    return "BM_SortWithComparator" + ValueType::name() + Order::name() + "_" +
+           std::to_string(Quantity);
+  };
+};
+
+const std::vector<size_t> CrossoverQuantities = {1 << 7,  1 << 9,  1 << 11,
+                                                 1 << 12, 1 << 13, 1 << 20};
+
+template <class ValueType, class Order>
+struct SortCrossover : Sort<ValueType, Order> {
+  bool skip() const {
+    return Order() != ::Order::Random ||
+           !std::is_arithmetic<Value<ValueType> >::value;
+  }
+};
 } // namespace
 
 int main(int argc, char** argv) {
@@ -35,5 +73,11 @@ int main(int argc, char** argv) {
   if (benchmark::ReportUnrecognizedArguments(argc, argv))
     return 1;
   makeCartesianProductBenchmark<Sort, AllValueTypes, AllOrders>(Quantities);
+  makeCartesianProductBenchmark<SortCrossover, AllValueTypes, AllOrders>(
+      CrossoverQuantities);
+  makeCartesianProductBenchmark<SortWithComparator, AllValueTypes, AllOrders>(
+      Quantities);
+  makeCartesianProductBenchmark<SortWithComparator, AllValueTypes, AllOrders>(
+      CrossoverQuantities);
   benchmark::RunSpecifiedBenchmarks();
 }
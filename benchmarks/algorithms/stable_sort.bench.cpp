@@ -7,6 +7,11 @@
 //===----------------------------------------------------------------------===//
 
 #include <algorithm>
+#include <cstddef>
+#include <experimental/algorithm>
+#include <experimental/memory_resource>
+#include <new>
+#include <vector>
 
 #include "common.h"
 
@@ -28,6 +33,70 @@ struct StableSort {
            std::to_string(Quantity);
   };
 };
+// Hands out a single buffer of Bytes bytes, allocated once up front, the way a
+// caller would reuse its scratch storage across calls. Larger requests fail.
+class ScratchResource : public std::experimental::pmr::memory_resource {
+  std::vector<char> Storage;
+  bool InUse = false;
+
+  void* do_allocate(size_t Bytes, size_t Align) override {
+    if (InUse || Bytes > Storage.size() || Align > alignof(std::max_align_t))
+      throw std::bad_alloc();
+    InUse = true;
+    return Storage.data();
+  }
+
+  void do_deallocate(void*, size_t, size_t) override { InUse = false; }
+
+  bool do_is_equal(const memory_resource& Other) const noexcept override {
+    return this == &Other;
+  }
+
+public:
+  explicit ScratchResource(size_t Bytes) : Storage(Bytes) {}
+};
+
+template <class ValueType, class Order>
+struct StableSortScratch {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    ScratchResource Scratch(Quantity * sizeof(Value<ValueType>));
+    runOpOnCopies<ValueType>(
+        state, Quantity, Order(), BatchSize::CountElements, [&](auto& Copy) {
+          std::experimental::stable_sort(Copy.begin(), Copy.end(), &Scratch);
+        });
+  }
+
+  bool skip() const { return Order() == ::Order::Heap; }
+
+  std::string name() const {
+    return "BM_StableSortScratch" + ValueType::name() + Order::name() + "_" +
+           std::to_string(Quantity);
+  };
+};
+
+// Without any memory to allocate, stable_sort merges through its own
+// kilobyte-sized buffer.
+template <class ValueType, class Order>
+struct StableSortNoMemory {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    ScratchResource Scratch(0);
+    runOpOnCopies<ValueType>(
+        state, Quantity, Order(), BatchSize::CountElements, [&](auto& Copy) {
+          std::experimental::stable_sort(Copy.begin(), Copy.end(), &Scratch);
+        });
+  }
+
+  bool skip() const { return Order() == ::Order::Heap; }
+
+  std::string name() const {
+    return "BM_StableSortNoMemory" + ValueType::name() + Order::name() + "_" +
+           std::to_string(Quantity);
+  };
+};
 } // namespace
 
 int main(int argc, char** argv) {
@@ -35,5 +104,9 @@ int main(int argc, char** argv) {
   if (benchmark::ReportUnrecognizedArguments(argc, argv))
     return 1;
   makeCartesianProductBenchmark<StableSort, AllValueTypes, AllOrders>(Quantities);
+  makeCartesianProductBenchmark<StableSortScratch, AllValueTypes, AllOrders>(
+      Quantities);
+  makeCartesianProductBenchmark<StableSortNoMemory, AllValueTypes, AllOrders>(
+      Quantities);
   benchmark::RunSpecifiedBenchmarks();
 }
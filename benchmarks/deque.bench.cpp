@@ -6,7 +6,9 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
 #include <deque>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
@@ -40,7 +42,68 @@ BENCHMARK_CAPTURE(BM_ConstructIterIter,
   std::deque<std::string>{},
   getRandomStringInputs)->Arg(TestNumInputs);
 
+// The algorithms below go through a deque one block at a time.
 
+template <class Container>
+void BM_Fill(benchmark::State& st, Container c) {
+  c.resize(st.range(0));
+  for (auto _ : st) {
+    std::fill(c.begin(), c.end(), typename Container::value_type(1));
+    DoNotOptimizeData(c);
+  }
+}
 
+template <class Container>
+void BM_Find(benchmark::State& st, Container c) {
+  c.resize(st.range(0));
+  for (auto _ : st) {
+    DoNotOptimizeData(c);
+    benchmark::DoNotOptimize(std::find(c.begin(), c.end(), typename Container::value_type(1)));
+  }
+}
+
+template <class Container>
+void BM_ForEach(benchmark::State& st, Container c) {
+  c.resize(st.range(0), 1);
+  for (auto _ : st) {
+    DoNotOptimizeData(c);
+    long sum = 0;
+    std::for_each(c.begin(), c.end(), [&sum](typename Container::value_type x) { sum += x; });
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+template <class Container>
+void BM_CopyOut(benchmark::State& st, Container c) {
+  c.resize(st.range(0));
+  std::vector<typename Container::value_type> out(c.size());
+  for (auto _ : st) {
+    DoNotOptimizeData(c);
+    std::copy(c.begin(), c.end(), out.begin());
+    DoNotOptimizeData(out);
+  }
+}
+
+template <class Container>
+void BM_MoveIn(benchmark::State& st, Container c) {
+  c.resize(st.range(0));
+  std::vector<typename Container::value_type> in(c.size());
+  for (auto _ : st) {
+    DoNotOptimizeData(in);
+    std::move(in.begin(), in.end(), c.begin());
+    DoNotOptimizeData(c);
+  }
+}
+
+BENCHMARK_CAPTURE(BM_Fill, deque_byte, std::deque<unsigned char>{})->Arg(TestNumInputs)->Arg(5140480);
+BENCHMARK_CAPTURE(BM_Fill, deque_int, std::deque<int>{})->Arg(TestNumInputs)->Arg(5140480);
+BENCHMARK_CAPTURE(BM_Find, deque_byte, std::deque<unsigned char>{})->Arg(TestNumInputs)->Arg(5140480);
+BENCHMARK_CAPTURE(BM_Find, deque_int, std::deque<int>{})->Arg(TestNumInputs)->Arg(5140480);
+BENCHMARK_CAPTURE(BM_ForEach, deque_byte, std::deque<unsigned char>{})->Arg(TestNumInputs)->Arg(5140480);
+BENCHMARK_CAPTURE(BM_ForEach, deque_int, std::deque<int>{})->Arg(TestNumInputs)->Arg(5140480);
+BENCHMARK_CAPTURE(BM_CopyOut, deque_byte, std::deque<unsigned char>{})->Arg(TestNumInputs)->Arg(5140480);
+BENCHMARK_CAPTURE(BM_CopyOut, deque_int, std::deque<int>{})->Arg(TestNumInputs)->Arg(5140480);
+BENCHMARK_CAPTURE(BM_MoveIn, deque_byte, std::deque<unsigned char>{})->Arg(TestNumInputs)->Arg(5140480);
+BENCHMARK_CAPTURE(BM_MoveIn, deque_int, std::deque<int>{})->Arg(TestNumInputs)->Arg(5140480);
 
 BENCHMARK_MAIN();
@@ -8,8 +8,11 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <experimental/btree_map>
 #include <map>
 #include <random>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "CartesianBenchmarks.h"
@@ -47,23 +50,33 @@ struct AllOrders : EnumValuesAsTuple<AllOrders, Order, 2> {
   static constexpr const char* Names[] = {"Sorted", "Random"};
 };
 
+using StdMap = std::map<uint64_t, int64_t>;
+using BTreeMap = std::experimental::btree_map<uint64_t, int64_t>;
+
+template <class MapT>
+std::string mapName() {
+  return std::is_same<MapT, BTreeMap>::value ? "_BTreeMap" : "";
+}
+
+// The hints are only used with StdMap, a btree_map invalidates them on every
+// insertion.
+template <class MapT = StdMap>
 struct TestSets {
   std::vector<uint64_t> Keys;
-  std::vector<std::map<uint64_t, int64_t> > Maps;
-  std::vector<
-      std::vector<typename std::map<uint64_t, int64_t>::const_iterator> >
-      Hints;
+  std::vector<MapT> Maps;
+  std::vector<std::vector<typename MapT::const_iterator> > Hints;
 };
 
 enum class Shuffle { None, Keys, Hints };
 
-TestSets makeTestingSets(size_t MapSize, Mode mode, Shuffle shuffle,
-                         size_t max_maps) {
+template <class MapT = StdMap>
+TestSets<MapT> makeTestingSets(size_t MapSize, Mode mode, Shuffle shuffle,
+                               size_t max_maps) {
   /*
    * The shuffle does not retain the random number generator to use the same
    * set of random numbers for every iteration.
    */
-  TestSets R;
+  TestSets<MapT> R;
 
   int MapCount = std::min(max_maps, 1000000 / MapSize);
 
@@ -128,25 +141,57 @@ struct ConstructorIterator : Base {
   std::string name() const { return "BM_ConstructorIterator" + baseName(); }
 };
 
+// Sorted ranges are linked into a tree in one go, other ranges are inserted one
+// element at a time.
+template <class Order, class MapT = StdMap>
+struct ConstructorRange : Base {
+  using Base::Base;
+
+  void run(benchmark::State& State) const {
+    std::vector<std::pair<uint64_t, int64_t> > Data;
+    for (uint64_t I = 0; I < MapSize; ++I)
+      Data.push_back(std::make_pair(2 * I + 2, 0));
+    if (Order::value == ::Order::Random)
+      std::shuffle(Data.begin(), Data.end(), std::mt19937());
+    while (State.KeepRunningBatch(MapSize)) {
+#ifndef VALIDATE
+      benchmark::DoNotOptimize(MapT(Data.begin(), Data.end()));
+#else
+      MapT M{Data.begin(), Data.end()};
+      if (M.size() != MapSize || !std::is_sorted(M.begin(), M.end()))
+        State.SkipWithError("Map contains an invalid number of elements.");
+#endif
+    }
+  }
+
+  std::string name() const {
+    return "BM_ConstructorRange" + baseName() + Order::name() +
+           mapName<MapT>();
+  }
+};
+
+template <class MapT = StdMap>
 struct ConstructorCopy : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(MapSize, Mode::Hit, Shuffle::None, 1);
+    auto Data = makeTestingSets<MapT>(MapSize, Mode::Hit, Shuffle::None, 1);
     auto& Map = Data.Maps.front();
     while (State.KeepRunningBatch(MapSize)) {
 #ifndef VALIDATE
-      std::map<uint64_t, int64_t> M(Map);
+      MapT M(Map);
       benchmark::DoNotOptimize(M);
 #else
-      std::map<uint64_t, int64_t> M(Map);
+      MapT M(Map);
       if (M != Map)
         State.SkipWithError("Map copy not identical");
 #endif
     }
   }
 
-  std::string name() const { return "BM_ConstructorCopy" + baseName(); }
+  std::string name() const {
+    return "BM_ConstructorCopy" + baseName() + mapName<MapT>();
+  }
 };
 
 struct ConstructorMove : Base {
@@ -233,12 +278,12 @@ struct Clear : Base {
   std::string name() const { return "BM_Clear" + baseName(); }
 };
 
-template <class Mode, class Order>
+template <class Mode, class Order, class MapT = StdMap>
 struct Insert : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(
+    auto Data = makeTestingSets<MapT>(
         MapSize, Mode(),
         Order::value == ::Order::Random ? Shuffle::Keys : Shuffle::None, 1000);
     while (State.KeepRunningBatch(MapSize * Data.Maps.size())) {
@@ -260,16 +305,17 @@ struct Insert : Base {
       }
 
       State.PauseTiming();
-      Data = makeTestingSets(MapSize, Mode(),
-                             Order::value == ::Order::Random ? Shuffle::Keys
-                                                             : Shuffle::None,
-                             1000);
+      Data = makeTestingSets<MapT>(
+          MapSize, Mode(),
+          Order::value == ::Order::Random ? Shuffle::Keys : Shuffle::None,
+          1000);
       State.ResumeTiming();
     }
   }
 
   std::string name() const {
-    return "BM_Insert" + baseName() + Mode::name() + Order::name();
+    return "BM_Insert" + baseName() + Mode::name() + Order::name() +
+           mapName<MapT>();
   }
 };
 
@@ -711,12 +757,12 @@ struct TryEmplaceHint : Base {
   }
 };
 
-template <class Mode, class Order>
+template <class Mode, class Order, class MapT = StdMap>
 struct Erase : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(
+    auto Data = makeTestingSets<MapT>(
         MapSize, Mode(),
         Order::value == ::Order::Random ? Shuffle::Keys : Shuffle::None, 1000);
     while (State.KeepRunningBatch(MapSize * Data.Maps.size())) {
@@ -738,16 +784,17 @@ struct Erase : Base {
       }
 
       State.PauseTiming();
-      Data = makeTestingSets(MapSize, Mode(),
-                             Order::value == ::Order::Random ? Shuffle::Keys
-                                                             : Shuffle::None,
-                             1000);
+      Data = makeTestingSets<MapT>(
+          MapSize, Mode(),
+          Order::value == ::Order::Random ? Shuffle::Keys : Shuffle::None,
+          1000);
       State.ResumeTiming();
     }
   }
 
   std::string name() const {
-    return "BM_Erase" + baseName() + Mode::name() + Order::name();
+    return "BM_Erase" + baseName() + Mode::name() + Order::name() +
+           mapName<MapT>();
   }
 };
 
@@ -814,12 +861,12 @@ struct EraseRange : Base {
 //                            Lookup                                 |
 //*******************************************************************|
 
-template <class Mode, class Order>
+template <class Mode, class Order, class MapT = StdMap>
 struct Count : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(
+    auto Data = makeTestingSets<MapT>(
         MapSize, Mode(),
         Order::value == ::Order::Random ? Shuffle::Keys : Shuffle::None, 1);
     auto& Map = Data.Maps.front();
@@ -842,16 +889,17 @@ struct Count : Base {
   }
 
   std::string name() const {
-    return "BM_Count" + baseName() + Mode::name() + Order::name();
+    return "BM_Count" + baseName() + Mode::name() + Order::name() +
+           mapName<MapT>();
   }
 };
 
-template <class Mode, class Order>
+template <class Mode, class Order, class MapT = StdMap>
 struct Find : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(
+    auto Data = makeTestingSets<MapT>(
         MapSize, Mode(),
         Order::value == ::Order::Random ? Shuffle::Keys : Shuffle::None, 1);
     auto& Map = Data.Maps.front();
@@ -874,7 +922,8 @@ struct Find : Base {
   }
 
   std::string name() const {
-    return "BM_Find" + baseName() + Mode::name() + Order::name();
+    return "BM_Find" + baseName() + Mode::name() + Order::name() +
+           mapName<MapT>();
   }
 };
 
@@ -918,12 +967,12 @@ struct EqualRange : Base {
   }
 };
 
-template <class Mode, class Order>
+template <class Mode, class Order, class MapT = StdMap>
 struct LowerBound : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(
+    auto Data = makeTestingSets<MapT>(
         MapSize, Mode(),
         Order::value == ::Order::Random ? Shuffle::Keys : Shuffle::None, 1);
     auto& Map = Data.Maps.front();
@@ -946,16 +995,17 @@ struct LowerBound : Base {
   }
 
   std::string name() const {
-    return "BM_LowerBound" + baseName() + Mode::name() + Order::name();
+    return "BM_LowerBound" + baseName() + Mode::name() + Order::name() +
+           mapName<MapT>();
   }
 };
 
-template <class Mode, class Order>
+template <class Mode, class Order, class MapT = StdMap>
 struct UpperBound : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(
+    auto Data = makeTestingSets<MapT>(
         MapSize, Mode(),
         Order::value == ::Order::Random ? Shuffle::Keys : Shuffle::None, 1);
     auto& Map = Data.Maps.front();
@@ -964,7 +1014,7 @@ struct UpperBound : Base {
 #ifndef VALIDATE
         benchmark::DoNotOptimize(Map.upper_bound(K));
 #else
-        std::map<uint64_t, int64_t>::iterator Itor = Map.upper_bound(K);
+        typename MapT::iterator Itor = Map.upper_bound(K);
         if (Mode() == ::Mode::Hit) {
           // Adjust validation for the last element.
           auto Key = K;
@@ -984,10 +1034,27 @@ struct UpperBound : Base {
   }
 
   std::string name() const {
-    return "BM_UpperBound" + baseName() + Mode::name() + Order::name();
+    return "BM_UpperBound" + baseName() + Mode::name() + Order::name() +
+           mapName<MapT>();
   }
 };
 
+template <class Order>
+using BTreeConstructorRange = ConstructorRange<Order, BTreeMap>;
+using BTreeConstructorCopy = ConstructorCopy<BTreeMap>;
+template <class Mode, class Order>
+using BTreeInsert = Insert<Mode, Order, BTreeMap>;
+template <class Mode, class Order>
+using BTreeErase = Erase<Mode, Order, BTreeMap>;
+template <class Mode, class Order>
+using BTreeCount = Count<Mode, Order, BTreeMap>;
+template <class Mode, class Order>
+using BTreeFind = Find<Mode, Order, BTreeMap>;
+template <class Mode, class Order>
+using BTreeLowerBound = LowerBound<Mode, Order, BTreeMap>;
+template <class Mode, class Order>
+using BTreeUpperBound = UpperBound<Mode, Order, BTreeMap>;
+
 } // namespace
 
 int main(int argc, char** argv) {
@@ -1004,6 +1071,7 @@ int main(int argc, char** argv) {
   // Member functions
   makeCartesianProductBenchmark<ConstructorDefault>();
   makeCartesianProductBenchmark<ConstructorIterator>(MapSize);
+  makeCartesianProductBenchmark<ConstructorRange, AllOrders>(MapSize);
   makeCartesianProductBenchmark<ConstructorCopy>(MapSize);
   makeCartesianProductBenchmark<ConstructorMove>(MapSize);
 
@@ -1033,5 +1101,15 @@ int main(int argc, char** argv) {
   makeCartesianProductBenchmark<LowerBound, AllModes, AllOrders>(MapSize);
   makeCartesianProductBenchmark<UpperBound, AllModes, AllOrders>(MapSize);
 
+  // B-tree
+  makeCartesianProductBenchmark<BTreeConstructorRange, AllOrders>(MapSize);
+  makeCartesianProductBenchmark<BTreeConstructorCopy>(MapSize);
+  makeCartesianProductBenchmark<BTreeInsert, AllModes, AllOrders>(MapSize);
+  makeCartesianProductBenchmark<BTreeErase, AllModes, AllOrders>(MapSize);
+  makeCartesianProductBenchmark<BTreeCount, AllModes, AllOrders>(MapSize);
+  makeCartesianProductBenchmark<BTreeFind, AllModes, AllOrders>(MapSize);
+  makeCartesianProductBenchmark<BTreeLowerBound, AllModes, AllOrders>(MapSize);
+  makeCartesianProductBenchmark<BTreeUpperBound, AllModes, AllOrders>(MapSize);
+
   benchmark::RunSpecifiedBenchmarks();
 }
@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Aggregates a vector of Quantity elements with plus. accumulate and
+// partial_sum process the elements in order, and are the baseline for reduce,
+// transform_reduce (an inner product with a second vector) and the scans.
+
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include "CartesianBenchmarks.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+enum class ValueType { Int32, Int64, Float, Double };
+struct AllValueTypes : EnumValuesAsTuple<AllValueTypes, ValueType, 4> {
+  static constexpr const char* Names[] = {"int32", "int64", "float", "double"};
+};
+
+using Types = std::tuple<int32_t, int64_t, float, double>;
+
+template <class V>
+using Value = std::tuple_element_t<(int)V::value, Types>;
+
+enum class Algorithm { Accumulate, Reduce, TransformReduce, PartialSum, InclusiveScan, ExclusiveScan };
+struct AllAlgorithms : EnumValuesAsTuple<AllAlgorithms, Algorithm, 6> {
+  static constexpr const char* Names[] = {"Accumulate", "Reduce",        "TransformReduce",
+                                          "PartialSum", "InclusiveScan", "ExclusiveScan"};
+};
+
+template <class V, class Alg>
+struct Aggregate {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    using T = Value<V>;
+    std::vector<T> Input(Quantity);
+    std::vector<T> Other(Quantity);
+    for (size_t I = 0; I != Quantity; ++I) {
+      Input[I] = T(I % 7);
+      Other[I] = T(I % 3);
+    }
+    std::vector<T> Out(Quantity);
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(Input.data());
+      switch (Alg()) {
+      case Algorithm::Accumulate:
+        benchmark::DoNotOptimize(std::accumulate(Input.begin(), Input.end(), T()));
+        break;
+      case Algorithm::Reduce:
+        benchmark::DoNotOptimize(std::reduce(Input.begin(), Input.end(), T()));
+        break;
+      case Algorithm::TransformReduce:
+        benchmark::DoNotOptimize(std::transform_reduce(Input.begin(), Input.end(), Other.begin(), T()));
+        break;
+      case Algorithm::PartialSum:
+        benchmark::DoNotOptimize(std::partial_sum(Input.begin(), Input.end(), Out.begin()));
+        break;
+      case Algorithm::InclusiveScan:
+        benchmark::DoNotOptimize(std::inclusive_scan(Input.begin(), Input.end(), Out.begin()));
+        break;
+      case Algorithm::ExclusiveScan:
+        benchmark::DoNotOptimize(std::exclusive_scan(Input.begin(), Input.end(), Out.begin(), T()));
+        break;
+      }
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * Quantity);
+  }
+
+  std::string name() const { return "BM_" + Alg::name() + V::name() + "_" + std::to_string(Quantity); }
+};
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  const std::vector<size_t> Quantities = {1 << 10, 1 << 16, 1 << 20};
+  makeCartesianProductBenchmark<Aggregate, AllValueTypes, AllAlgorithms>(Quantities);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -8,10 +8,12 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <experimental/btree_set>
 #include <memory>
 #include <random>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "CartesianBenchmarks.h"
@@ -41,14 +43,25 @@ void sortKeysBy(std::vector<uint64_t>& Keys, AccessPattern AP) {
   }
 }
 
+using StdSet = std::set<uint64_t>;
+using BTreeSet = std::experimental::btree_set<uint64_t>;
+
+// The benchmarks of btree_set have the names of the ones of set, with a suffix.
+template <class SetT>
+std::string setName() {
+  return std::is_same<SetT, BTreeSet>::value ? "_BTreeSet" : "";
+}
+
+template <class SetT>
 struct TestSets {
-  std::vector<std::set<uint64_t> > Sets;
+  std::vector<SetT> Sets;
   std::vector<uint64_t> Keys;
 };
 
-TestSets makeTestingSets(size_t TableSize, size_t NumTables, HitType Hit,
-                         AccessPattern Access) {
-  TestSets R;
+template <class SetT>
+TestSets<SetT> makeTestingSets(size_t TableSize, size_t NumTables, HitType Hit,
+                               AccessPattern Access) {
+  TestSets<SetT> R;
   R.Sets.resize(1);
 
   for (uint64_t I = 0; I < TableSize; ++I) {
@@ -77,7 +90,7 @@ struct Base {
   }
 };
 
-template <class Access>
+template <class Access, class SetT = StdSet>
 struct Create : Base {
   using Base::Base;
 
@@ -87,7 +100,7 @@ struct Create : Base {
     sortKeysBy(Keys, Access());
 
     while (State.KeepRunningBatch(TableSize * NumTables)) {
-      std::vector<std::set<uint64_t>> Sets(NumTables);
+      std::vector<SetT> Sets(NumTables);
       for (auto K : Keys) {
         for (auto& Set : Sets) {
           benchmark::DoNotOptimize(Set.insert(K));
@@ -97,16 +110,42 @@ struct Create : Base {
   }
 
   std::string name() const {
-    return "BM_Create" + Access::name() + baseName();
+    return "BM_Create" + Access::name() + baseName() + setName<SetT>();
   }
 };
 
-template <class Hit, class Access>
+// Unlike Create, builds each set from the whole range of keys, which links the
+// tree in one go when the keys are ordered.
+template <class Access, class SetT = StdSet>
+struct CreateFromRange : Base {
+  using Base::Base;
+
+  void run(benchmark::State& State) const {
+    std::vector<uint64_t> Keys(TableSize);
+    std::iota(Keys.begin(), Keys.end(), uint64_t{0});
+    sortKeysBy(Keys, Access());
+
+    while (State.KeepRunningBatch(TableSize * NumTables)) {
+      std::vector<SetT> Sets(NumTables);
+      for (auto& Set : Sets) {
+        Set.insert(Keys.begin(), Keys.end());
+        benchmark::DoNotOptimize(Set);
+      }
+    }
+  }
+
+  std::string name() const {
+    return "BM_CreateFromRange" + Access::name() + baseName() +
+           setName<SetT>();
+  }
+};
+
+template <class Hit, class Access, class SetT = StdSet>
 struct Find : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(TableSize, NumTables, Hit(), Access());
+    auto Data = makeTestingSets<SetT>(TableSize, NumTables, Hit(), Access());
 
     while (State.KeepRunningBatch(TableSize * NumTables)) {
       for (auto K : Data.Keys) {
@@ -118,16 +157,17 @@ struct Find : Base {
   }
 
   std::string name() const {
-    return "BM_Find" + Hit::name() + Access::name() + baseName();
+    return "BM_Find" + Hit::name() + Access::name() + baseName() +
+           setName<SetT>();
   }
 };
 
-template <class Hit, class Access>
+template <class Hit, class Access, class SetT = StdSet>
 struct FindNeEnd : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(TableSize, NumTables, Hit(), Access());
+    auto Data = makeTestingSets<SetT>(TableSize, NumTables, Hit(), Access());
 
     while (State.KeepRunningBatch(TableSize * NumTables)) {
       for (auto K : Data.Keys) {
@@ -139,16 +179,18 @@ struct FindNeEnd : Base {
   }
 
   std::string name() const {
-    return "BM_FindNeEnd" + Hit::name() + Access::name() + baseName();
+    return "BM_FindNeEnd" + Hit::name() + Access::name() + baseName() +
+           setName<SetT>();
   }
 };
 
-template <class Access>
+template <class Access, class SetT = StdSet>
 struct InsertHit : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(TableSize, NumTables, HitType::Hit, Access());
+    auto Data =
+        makeTestingSets<SetT>(TableSize, NumTables, HitType::Hit, Access());
 
     while (State.KeepRunningBatch(TableSize * NumTables)) {
       for (auto K : Data.Keys) {
@@ -160,16 +202,17 @@ struct InsertHit : Base {
   }
 
   std::string name() const {
-    return "BM_InsertHit" + Access::name() + baseName();
+    return "BM_InsertHit" + Access::name() + baseName() + setName<SetT>();
   }
 };
 
-template <class Access>
+template <class Access, class SetT = StdSet>
 struct InsertMissAndErase : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(TableSize, NumTables, HitType::Miss, Access());
+    auto Data =
+        makeTestingSets<SetT>(TableSize, NumTables, HitType::Miss, Access());
 
     while (State.KeepRunningBatch(TableSize * NumTables)) {
       for (auto K : Data.Keys) {
@@ -181,16 +224,18 @@ struct InsertMissAndErase : Base {
   }
 
   std::string name() const {
-    return "BM_InsertMissAndErase" + Access::name() + baseName();
+    return "BM_InsertMissAndErase" + Access::name() + baseName() +
+           setName<SetT>();
   }
 };
 
+template <class SetT = StdSet>
 struct IterateRangeFor : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(TableSize, NumTables, HitType::Miss,
-                                AccessPattern::Ordered);
+    auto Data = makeTestingSets<SetT>(TableSize, NumTables, HitType::Miss,
+                                      AccessPattern::Ordered);
 
     while (State.KeepRunningBatch(TableSize * NumTables)) {
       for (auto& Set : Data.Sets) {
@@ -201,15 +246,18 @@ struct IterateRangeFor : Base {
     }
   }
 
-  std::string name() const { return "BM_IterateRangeFor" + baseName(); }
+  std::string name() const {
+    return "BM_IterateRangeFor" + baseName() + setName<SetT>();
+  }
 };
 
+template <class SetT = StdSet>
 struct IterateBeginEnd : Base {
   using Base::Base;
 
   void run(benchmark::State& State) const {
-    auto Data = makeTestingSets(TableSize, NumTables, HitType::Miss,
-                                AccessPattern::Ordered);
+    auto Data = makeTestingSets<SetT>(TableSize, NumTables, HitType::Miss,
+                                      AccessPattern::Ordered);
 
     while (State.KeepRunningBatch(TableSize * NumTables)) {
       for (auto& Set : Data.Sets) {
@@ -220,9 +268,26 @@ struct IterateBeginEnd : Base {
     }
   }
 
-  std::string name() const { return "BM_IterateBeginEnd" + baseName(); }
+  std::string name() const {
+    return "BM_IterateBeginEnd" + baseName() + setName<SetT>();
+  }
 };
 
+template <class Access>
+using BTreeCreate = Create<Access, BTreeSet>;
+template <class Access>
+using BTreeCreateFromRange = CreateFromRange<Access, BTreeSet>;
+template <class Hit, class Access>
+using BTreeFind = Find<Hit, Access, BTreeSet>;
+template <class Hit, class Access>
+using BTreeFindNeEnd = FindNeEnd<Hit, Access, BTreeSet>;
+template <class Access>
+using BTreeInsertHit = InsertHit<Access, BTreeSet>;
+template <class Access>
+using BTreeInsertMissAndErase = InsertMissAndErase<Access, BTreeSet>;
+using BTreeIterateRangeFor = IterateRangeFor<BTreeSet>;
+using BTreeIterateBeginEnd = IterateBeginEnd<BTreeSet>;
+
 }  // namespace
 
 int main(int argc, char** argv) {
@@ -234,6 +299,8 @@ int main(int argc, char** argv) {
   const std::vector<size_t> NumTables{1, 10, 100, 1000, 10000, 100000, 1000000};
 
   makeCartesianProductBenchmark<Create, AllAccessPattern>(TableSize, NumTables);
+  makeCartesianProductBenchmark<CreateFromRange, AllAccessPattern>(TableSize,
+                                                                   NumTables);
   makeCartesianProductBenchmark<Find, AllHitTypes, AllAccessPattern>(
       TableSize, NumTables);
   makeCartesianProductBenchmark<FindNeEnd, AllHitTypes, AllAccessPattern>(
@@ -244,5 +311,20 @@ int main(int argc, char** argv) {
       TableSize, NumTables);
   makeCartesianProductBenchmark<IterateRangeFor>(TableSize, NumTables);
   makeCartesianProductBenchmark<IterateBeginEnd>(TableSize, NumTables);
+
+  makeCartesianProductBenchmark<BTreeCreate, AllAccessPattern>(TableSize,
+                                                               NumTables);
+  makeCartesianProductBenchmark<BTreeCreateFromRange, AllAccessPattern>(
+      TableSize, NumTables);
+  makeCartesianProductBenchmark<BTreeFind, AllHitTypes, AllAccessPattern>(
+      TableSize, NumTables);
+  makeCartesianProductBenchmark<BTreeFindNeEnd, AllHitTypes, AllAccessPattern>(
+      TableSize, NumTables);
+  makeCartesianProductBenchmark<BTreeInsertHit, AllAccessPattern>(TableSize,
+                                                                  NumTables);
+  makeCartesianProductBenchmark<BTreeInsertMissAndErase, AllAccessPattern>(
+      TableSize, NumTables);
+  makeCartesianProductBenchmark<BTreeIterateRangeFor>(TableSize, NumTables);
+  makeCartesianProductBenchmark<BTreeIterateBeginEnd>(TableSize, NumTables);
   benchmark::RunSpecifiedBenchmarks();
 }
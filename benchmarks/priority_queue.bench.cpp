@@ -0,0 +1,125 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Compares priority_queue with the d-ary heaps of std::experimental::d_ary_priority_queue, as min-heaps
+// of deadlines. Drain pushes Quantity random deadlines and pops them all. Hold keeps Quantity deadlines
+// queued, and repeatedly pops the earliest one and pushes a later one, as a timer queue or a discrete
+// event scheduler does.
+
+#include <cstdint>
+#include <experimental/queue>
+#include <functional>
+#include <queue>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "CartesianBenchmarks.h"
+#include "benchmark/benchmark.h"
+
+namespace {
+enum class ValueType { Uint32, Uint64, Pair };
+struct AllValueTypes : EnumValuesAsTuple<AllValueTypes, ValueType, 3> {
+  static constexpr const char* Names[] = {"uint32", "uint64", "pair<uint64, uint32>"};
+};
+
+using Types = std::tuple<uint32_t, uint64_t, std::pair<uint64_t, uint32_t> >;
+
+template <class V>
+using Value = std::tuple_element_t<(int)V::value, Types>;
+
+enum class QueueType { PriorityQueue, DAry4, DAry8 };
+struct AllQueueTypes : EnumValuesAsTuple<AllQueueTypes, QueueType, 3> {
+  static constexpr const char* Names[] = {"PriorityQueue", "DAryPriorityQueue4", "DAryPriorityQueue8"};
+};
+
+template <class T>
+using Later = std::greater<T>;
+
+template <class T>
+using Queues = std::tuple<std::priority_queue<T, std::vector<T>, Later<T> >,
+                          std::experimental::d_ary_priority_queue<T, std::vector<T>, Later<T>, 4>,
+                          std::experimental::d_ary_priority_queue<T, std::vector<T>, Later<T>, 8> >;
+
+template <class Q, class V>
+using Queue = std::tuple_element_t<(int)Q::value, Queues<Value<V> > >;
+
+template <class T>
+T makeDeadline(uint64_t Ticks) {
+  return static_cast<T>(Ticks);
+}
+
+template <>
+std::pair<uint64_t, uint32_t> makeDeadline<std::pair<uint64_t, uint32_t> >(uint64_t Ticks) {
+  return std::make_pair(Ticks, static_cast<uint32_t>(Ticks));
+}
+
+template <class V, class Q>
+struct Drain {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    using T = Value<V>;
+    std::mt19937_64 Gen(Quantity);
+    std::vector<T> Deadlines;
+    for (size_t I = 0; I != Quantity; ++I)
+      Deadlines.push_back(makeDeadline<T>(Gen() >> 33));
+
+    for (auto _ : state) {
+      Queue<Q, V> Queued;
+      for (const T& Deadline : Deadlines)
+        Queued.push(Deadline);
+      while (!Queued.empty()) {
+        benchmark::DoNotOptimize(Queued.top());
+        Queued.pop();
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * Quantity);
+  }
+
+  std::string name() const { return "BM_Drain" + Q::name() + V::name() + "_" + std::to_string(Quantity); }
+};
+
+template <class V, class Q>
+struct Hold {
+  size_t Quantity;
+
+  void run(benchmark::State& state) const {
+    using T = Value<V>;
+    std::mt19937_64 Gen(Quantity);
+    Queue<Q, V> Queued;
+    uint64_t Now = 0;
+    for (size_t I = 0; I != Quantity; ++I)
+      Queued.push(makeDeadline<T>(Gen() % (4 * Quantity)));
+
+    // Each iteration fires the Quantity earliest deadlines, and schedules as many new ones.
+    for (auto _ : state) {
+      for (size_t I = 0; I != Quantity; ++I) {
+        ++Now;
+        benchmark::DoNotOptimize(Queued.top());
+        Queued.pop();
+        Queued.push(makeDeadline<T>(Now + Gen() % (4 * Quantity)));
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * Quantity);
+  }
+
+  std::string name() const { return "BM_Hold" + Q::name() + V::name() + "_" + std::to_string(Quantity); }
+};
+} // namespace
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  const std::vector<size_t> Quantities = {1 << 10, 1 << 16, 1 << 20};
+  makeCartesianProductBenchmark<Drain, AllValueTypes, AllQueueTypes>(Quantities);
+  makeCartesianProductBenchmark<Hold, AllValueTypes, AllQueueTypes>(Quantities);
+  benchmark::RunSpecifiedBenchmarks();
+}
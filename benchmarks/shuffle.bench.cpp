@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+// Shuffles the same array over and over, as a training loop does once per epoch.
+template <class Engine>
+static void BM_Shuffle(benchmark::State& state) {
+  std::vector<std::uint32_t> v(state.range(0));
+  std::iota(v.begin(), v.end(), 0);
+  Engine g;
+  for (auto _ : state) {
+    std::shuffle(v.begin(), v.end(), g);
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Shuffle, std::minstd_rand)->Range(1 << 6, 1 << 24);
+BENCHMARK_TEMPLATE(BM_Shuffle, std::mt19937)->Range(1 << 6, 1 << 24);
+BENCHMARK_TEMPLATE(BM_Shuffle, std::mt19937_64)->Range(1 << 6, 1 << 24);
+
+// Draws a sample of a sixteenth of the population, in order.
+template <class Engine>
+static void BM_Sample(benchmark::State& state) {
+  std::vector<std::uint32_t> population(state.range(0));
+  std::iota(population.begin(), population.end(), 0);
+  std::vector<std::uint32_t> out(population.size() / 16);
+  Engine g;
+  for (auto _ : state) {
+    std::sample(population.begin(), population.end(), out.begin(), out.size(), g);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Sample, std::minstd_rand)->Range(1 << 6, 1 << 24);
+BENCHMARK_TEMPLATE(BM_Sample, std::mt19937)->Range(1 << 6, 1 << 24);
+BENCHMARK_TEMPLATE(BM_Sample, std::mt19937_64)->Range(1 << 6, 1 << 24);
+
+BENCHMARK_MAIN();
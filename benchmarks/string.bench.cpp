@@ -49,6 +49,39 @@ static void BM_StringFindMatch2(benchmark::State &state) {
 }
 BENCHMARK(BM_StringFindMatch2)->Range(1, MAX_STRING_LEN / 4);
 
+// Benchmark when the first character of the string matches everywhere.
+static void BM_StringFindFrequentFirstChar(benchmark::State &state) {
+  std::string s1(MAX_STRING_LEN, '-');
+  std::string s2(state.range(0), '*');
+  s2[0] = '-';
+  for (auto _ : state)
+    benchmark::DoNotOptimize(s1.find(s2));
+}
+BENCHMARK(BM_StringFindFrequentFirstChar)->Range(2, MAX_STRING_LEN / 4);
+
+// Benchmark when every position matches the string up to its middle.
+static void BM_StringFindRepetitive(benchmark::State &state) {
+  std::string s1(MAX_STRING_LEN, '-');
+  std::string s2(state.range(0), '-');
+  s2[s2.size() / 2] = '*';
+  for (auto _ : state)
+    benchmark::DoNotOptimize(s1.find(s2));
+}
+BENCHMARK(BM_StringFindRepetitive)->Range(2, MAX_STRING_LEN / 4);
+
+// Benchmark when the string and the text it is searched in share a period,
+// and every period of the text matches the string up to its middle.
+static void BM_StringFindPeriodic(benchmark::State &state) {
+  std::string s1;
+  while (s1.size() < MAX_STRING_LEN)
+    s1 += "-*--*";
+  std::string s2(s1, 0, state.range(0));
+  s2[s2.size() / 2] = '+';
+  for (auto _ : state)
+    benchmark::DoNotOptimize(s1.find(s2));
+}
+BENCHMARK(BM_StringFindPeriodic)->Range(2, MAX_STRING_LEN / 4);
+
 static void BM_StringCtorDefault(benchmark::State &state) {
   for (auto _ : state) {
     std::string Default;
@@ -1,3 +1,5 @@
+#include <experimental/flat_hash_set>
+#include <experimental/unordered_set>
 #include <unordered_set>
 #include <vector>
 #include <functional>
@@ -202,6 +204,76 @@ BENCHMARK_CAPTURE(BM_InsertValueRehash,
     std::unordered_set<std::string>{},
     getRandomStringInputs)->Arg(TestNumInputs);
 
+// Flat Hash Set //
+BENCHMARK_CAPTURE(BM_InsertValue,
+    flat_hash_set_uint32,
+    std::experimental::flat_hash_set<uint32_t>{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    flat_hash_set_uint32_sorted,
+    std::experimental::flat_hash_set<uint32_t>{},
+    getSortedIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    flat_hash_set_top_bits_uint32,
+    std::experimental::flat_hash_set<uint32_t>{},
+    getSortedTopBitsIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValueRehash,
+    flat_hash_set_top_bits_uint32,
+    std::experimental::flat_hash_set<uint32_t, UInt32Hash>{},
+    getSortedTopBitsIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    flat_hash_set_string,
+    std::experimental::flat_hash_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValueRehash,
+    flat_hash_set_string,
+    std::experimental::flat_hash_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+// Pooled Nodes //
+BENCHMARK_CAPTURE(BM_InsertValue,
+    unordered_set_uint32_pooled,
+    std::unordered_set<uint32_t, std::hash<uint32_t>, std::equal_to<uint32_t>,
+        std::experimental::pooled_node_allocator<uint32_t, TestNumInputs>>{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_InsertValue,
+    unordered_set_string_pooled,
+    std::unordered_set<std::string, std::hash<std::string>, std::equal_to<std::string>,
+        std::experimental::pooled_node_allocator<std::string, TestNumInputs>>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+//----------------------------------------------------------------------------//
+//                         BM_EraseInsert
+// ---------------------------------------------------------------------------//
+
+BENCHMARK_CAPTURE(BM_EraseInsert,
+    unordered_set_uint32,
+    std::unordered_set<uint32_t>{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_EraseInsert,
+    unordered_set_uint32_pooled,
+    std::unordered_set<uint32_t, std::hash<uint32_t>, std::equal_to<uint32_t>,
+        std::experimental::pooled_node_allocator<uint32_t>>{},
+    getRandomIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_EraseInsert,
+    unordered_set_string,
+    std::unordered_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_EraseInsert,
+    unordered_set_string_pooled,
+    std::unordered_set<std::string, std::hash<std::string>, std::equal_to<std::string>,
+        std::experimental::pooled_node_allocator<std::string>>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
 //----------------------------------------------------------------------------//
 //                         BM_Find
 // ---------------------------------------------------------------------------//
@@ -287,6 +359,47 @@ BENCHMARK_CAPTURE(BM_FindRehash,
     std::unordered_set<std::string>{},
     getRandomStringInputs)->Arg(TestNumInputs);
 
+// Flat Hash Set //
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_random_uint64,
+    std::experimental::flat_hash_set<uint64_t>{},
+    getRandomIntegerInputs<uint64_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_sorted_uint64,
+    std::experimental::flat_hash_set<uint64_t>{},
+    getSortedIntegerInputs<uint64_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_sorted_uint128,
+    std::experimental::flat_hash_set<__uint128_t, UInt128Hash>{},
+    getSortedTopBitsIntegerInputs<__uint128_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_sorted_uint32,
+    std::experimental::flat_hash_set<uint32_t>{},
+    getSortedIntegerInputs<uint32_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_sorted_large_uint64,
+    std::experimental::flat_hash_set<uint64_t>{},
+    getSortedLargeIntegerInputs<uint64_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_top_bits_uint64,
+    std::experimental::flat_hash_set<uint64_t>{},
+    getSortedTopBitsIntegerInputs<uint64_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_FindRehash,
+    flat_hash_set_top_bits_uint64,
+    std::experimental::flat_hash_set<uint64_t, UInt64Hash>{},
+    getSortedTopBitsIntegerInputs<uint64_t>)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_Find,
+    flat_hash_set_string,
+    std::experimental::flat_hash_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
 //----------------------------------------------------------------------------//
 //                         BM_Rehash
 // ---------------------------------------------------------------------------//
@@ -339,4 +452,27 @@ BENCHMARK_CAPTURE(BM_EmplaceDuplicate,
     std::unordered_set<std::string>{},
     getRandomCStringInputs)->Arg(TestNumInputs);
 
+BENCHMARK_CAPTURE(BM_InsertDuplicate,
+    flat_hash_set_int,
+    std::experimental::flat_hash_set<int>{},
+    getRandomIntegerInputs<int>)->Arg(TestNumInputs);
+BENCHMARK_CAPTURE(BM_InsertDuplicate,
+    flat_hash_set_string,
+    std::experimental::flat_hash_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_EmplaceDuplicate,
+    flat_hash_set_int,
+    std::experimental::flat_hash_set<int>{},
+    getRandomIntegerInputs<int>)->Arg(TestNumInputs);
+BENCHMARK_CAPTURE(BM_EmplaceDuplicate,
+    flat_hash_set_string,
+    std::experimental::flat_hash_set<std::string>{},
+    getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_EmplaceDuplicate,
+    flat_hash_set_string_arg,
+    std::experimental::flat_hash_set<std::string>{},
+    getRandomCStringInputs)->Arg(TestNumInputs);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+// The algorithms below go through a vector<bool> a word at a time. The bitmaps are all zeros but
+// for their last bit, so that searches go all the way to the end.
+
+static std::vector<bool> makeBitmap(std::size_t size) {
+  std::vector<bool> v(size);
+  v.back() = true;
+  return v;
+}
+
+static void BM_Find(benchmark::State& st) {
+  std::vector<bool> v = makeBitmap(st.range(0));
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(std::find(v.begin(), v.end(), true));
+  }
+}
+
+static void BM_RangesFind(benchmark::State& st) {
+  std::vector<bool> v = makeBitmap(st.range(0));
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(std::ranges::find(v, true));
+  }
+}
+
+static void BM_Count(benchmark::State& st) {
+  std::vector<bool> v = makeBitmap(st.range(0));
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(std::count(v.begin(), v.end(), true));
+  }
+}
+
+static void BM_RangesCount(benchmark::State& st) {
+  std::vector<bool> v = makeBitmap(st.range(0));
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(std::ranges::count(v, true));
+  }
+}
+
+static void BM_RangesEqual(benchmark::State& st) {
+  std::vector<bool> v = makeBitmap(st.range(0));
+  std::vector<bool> w = v;
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(w);
+    benchmark::DoNotOptimize(std::ranges::equal(v, w));
+  }
+}
+
+static void BM_RangesSwapRanges(benchmark::State& st) {
+  std::vector<bool> v = makeBitmap(st.range(0));
+  std::vector<bool> w(v.size());
+  for (auto _ : st) {
+    std::ranges::swap_ranges(v, w);
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(w);
+  }
+}
+
+BENCHMARK(BM_Find)->Arg(1024)->Arg(1 << 20)->Arg(1 << 26);
+BENCHMARK(BM_RangesFind)->Arg(1024)->Arg(1 << 20)->Arg(1 << 26);
+BENCHMARK(BM_Count)->Arg(1024)->Arg(1 << 20)->Arg(1 << 26);
+BENCHMARK(BM_RangesCount)->Arg(1024)->Arg(1 << 20)->Arg(1 << 26);
+BENCHMARK(BM_RangesEqual)->Arg(1024)->Arg(1 << 20)->Arg(1 << 26);
+BENCHMARK(BM_RangesSwapRanges)->Arg(1024)->Arg(1 << 20)->Arg(1 << 26);
+
+BENCHMARK_MAIN();
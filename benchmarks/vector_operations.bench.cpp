@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
 
 #include "benchmark/benchmark.h"
 
@@ -13,6 +14,13 @@ using namespace ContainerBenchmarks;
 
 constexpr std::size_t TestNumInputs = 1024;
 
+std::vector<std::unique_ptr<int>> getUniquePtrInputs(std::size_t N) {
+  std::vector<std::unique_ptr<int>> inputs;
+  for (std::size_t i = 0; i < N; ++i)
+    inputs.push_back(std::make_unique<int>(static_cast<int>(i)));
+  return inputs;
+}
+
 BENCHMARK_CAPTURE(BM_ConstructSize,
     vector_byte,
     std::vector<unsigned char>{})->Arg(5140480);
@@ -36,5 +44,25 @@ BENCHMARK_CAPTURE(BM_ConstructIterIter,
   std::vector<std::string>{},
   getRandomStringInputs)->Arg(TestNumInputs);
 
+// std::string and std::unique_ptr are trivially relocatable, so these move them with memmove.
+BENCHMARK_CAPTURE(BM_ReserveShrink,
+  vector_string,
+  std::vector<std::string>{},
+  getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_ReserveShrink,
+  vector_unique_ptr,
+  std::vector<std::unique_ptr<int>>{},
+  getUniquePtrInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_EraseFront,
+  vector_string,
+  std::vector<std::string>{},
+  getRandomStringInputs)->Arg(TestNumInputs);
+
+BENCHMARK_CAPTURE(BM_EraseFront,
+  vector_unique_ptr,
+  std::vector<std::unique_ptr<int>>{},
+  getUniquePtrInputs)->Arg(TestNumInputs);
 
 BENCHMARK_MAIN();
@@ -9,7 +9,16 @@
 #ifndef _LIBCPP___ALGORITHM_COPY_IF_H
 #define _LIBCPP___ALGORITHM_COPY_IF_H
 
+#include <__algorithm/copy.h>
+#include <__algorithm/move.h>
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
+#include <__type_traits/conditional.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/remove_const.h>
+#include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -20,8 +29,8 @@ _LIBCPP_BEGIN_NAMESPACE_STD
 template<class _InputIterator, class _OutputIterator, class _Predicate>
 inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17
 _OutputIterator
-copy_if(_InputIterator __first, _InputIterator __last,
-        _OutputIterator __result, _Predicate __pred)
+__copy_if(_InputIterator __first, _InputIterator __last,
+          _OutputIterator __result, _Predicate& __pred)
 {
     for (; __first != __last; ++__first)
     {
@@ -34,6 +43,70 @@ copy_if(_InputIterator __first, _InputIterator __last,
     return __result;
 }
 
+template <class _Tp, class _OutputIterator>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator
+__copy_if_flush_block(_Tp* __first, _Tp* __last, _OutputIterator __result, false_type)
+{
+    return _VSTD::copy(__first, __last, __result);
+}
+
+template <class _Tp, class _OutputIterator>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator
+__copy_if_flush_block(_Tp* __first, _Tp* __last, _OutputIterator __result, true_type)
+{
+    return _VSTD::move(__first, __last, __result);
+}
+
+// Copies the elements of the blocks of [__first, __last) for which __pred returns _Selected to __result, and
+// advances __first past the blocks. Every element of a block is written to a buffer, which only keeps the
+// ones selected by advancing past them, and the buffer is then copied to the output at once. The output
+// must not overlap the range, except that it may start before __first. With _Move, the elements are moved
+// into the buffer and out of it instead, so that remove_if works with types that are only move-assignable.
+template <bool _Selected, bool _Move, class _Tp, class _OutputIterator, class _Predicate>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator
+__copy_if_by_blocks(_Tp*& __first, _Tp* __last, _OutputIterator __result, _Predicate& __pred)
+{
+    typedef typename conditional<_Move, _Tp&&, _Tp&>::type _Ref;
+    const ptrdiff_t __block_size = 64;
+    if (__last - __first < __block_size)
+        return __result;
+    typename remove_const<_Tp>::type __buffer[__block_size] = {};
+    for (; __last - __first >= __block_size; __first += __block_size)
+    {
+        ptrdiff_t __size = 0;
+        for (ptrdiff_t __i = 0; __i != __block_size; ++__i)
+        {
+            bool __select = static_cast<bool>(__pred(__first[__i])) == _Selected;
+            __buffer[__size] = static_cast<_Ref>(__first[__i]);
+            __size += __select;
+        }
+        __result = _VSTD::__copy_if_flush_block(
+            __buffer, __buffer + __size, __result, integral_constant<bool, _Move>());
+    }
+    return __result;
+}
+
+// The output may not have room for the elements that aren't copied, so unlike remove_if, copy_if can't
+// write every element to it, and compacts the elements in a buffer instead.
+template<class _Tp, class _OutputIterator, class _Predicate,
+         __enable_if_t<__can_compact_by_blocks<typename remove_const<_Tp>::type>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17
+_OutputIterator
+__copy_if(_Tp* __first, _Tp* __last, _OutputIterator __result, _Predicate& __pred)
+{
+    __result = _VSTD::__copy_if_by_blocks<true, false>(__first, __last, __result, __pred);
+    return _VSTD::__copy_if<_Tp*, _OutputIterator, _Predicate>(__first, __last, __result, __pred);
+}
+
+template<class _InputIterator, class _OutputIterator, class _Predicate>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17
+_OutputIterator
+copy_if(_InputIterator __first, _InputIterator __last,
+        _OutputIterator __result, _Predicate __pred)
+{
+    return _VSTD::__copy_if(_VSTD::__unwrap_iter(__first), _VSTD::__unwrap_iter(__last), __result, __pred);
+}
+
 _LIBCPP_END_NAMESPACE_STD
 
 #endif // _LIBCPP___ALGORITHM_COPY_IF_H
@@ -10,8 +10,13 @@
 #ifndef _LIBCPP___ALGORITHM_COUNT_H
 #define _LIBCPP___ALGORITHM_COUNT_H
 
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__iterator/iterator_traits.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/remove_const.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -20,9 +25,8 @@
 _LIBCPP_BEGIN_NAMESPACE_STD
 
 template <class _InputIterator, class _Tp>
-_LIBCPP_NODISCARD_EXT inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17
-    typename iterator_traits<_InputIterator>::difference_type
-    count(_InputIterator __first, _InputIterator __last, const _Tp& __value) {
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 typename iterator_traits<_InputIterator>::difference_type
+__count_impl(_InputIterator __first, _InputIterator __last, const _Tp& __value) {
   typename iterator_traits<_InputIterator>::difference_type __r(0);
   for (; __first != __last; ++__first)
     if (*__first == __value)
@@ -30,6 +34,32 @@ _LIBCPP_NODISCARD_EXT inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_C
   return __r;
 }
 
+#ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+// Contiguous ranges of integers and pointers are counted a vector at a time.
+template <class _ValueT,
+          class _Tp,
+          __enable_if_t<__can_find_bitwise<typename remove_const<_ValueT>::type, _Tp>::value &&
+                            __has_simd_equality<_ValueT>::value,
+                        int> = 0>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 ptrdiff_t
+__count_impl(_ValueT* __first, _ValueT* __last, const _Tp& __value) {
+  if (__libcpp_is_constant_evaluated())
+    return std::__count_impl<_ValueT*, _Tp>(__first, __last, __value);
+  typename remove_const<_ValueT>::type __converted;
+  if (!std::__convert_searched_value(__value, __converted))
+    return 0;
+  return static_cast<ptrdiff_t>(std::__simd_count(__first, __last, __converted));
+}
+#endif
+
+template <class _InputIterator, class _Tp>
+_LIBCPP_NODISCARD_EXT inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17
+    typename iterator_traits<_InputIterator>::difference_type
+    count(_InputIterator __first, _InputIterator __last, const _Tp& __value) {
+  return static_cast<typename iterator_traits<_InputIterator>::difference_type>(
+      std::__count_impl(std::__unwrap_iter(__first), std::__unwrap_iter(__last), __value));
+}
+
 _LIBCPP_END_NAMESPACE_STD
 
 #endif // _LIBCPP___ALGORITHM_COUNT_H
@@ -0,0 +1,252 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_D_ARY_HEAP_H
+#define _LIBCPP___ALGORITHM_D_ARY_HEAP_H
+
+#include <__algorithm/comp_ref_type.h>
+#include <__algorithm/iterator_operations.h>
+#include <__algorithm/lower_bound.h>
+#include <__assert>
+#include <__config>
+#include <__iterator/iterator_traits.h>
+#include <__memory/addressof.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/remove_cvref.h>
+#include <__utility/move.h>
+#include <cstddef>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// The heaps below generalize the binary heaps of make_heap, push_heap and pop_heap to _Arity children per
+// node: the children of the node at index __i are at _Arity * __i + 1 to _Arity * __i + _Arity, and its
+// parent is at (__i - 1) / _Arity. A wider node makes the heap shallower, and its children are adjacent,
+// so sifting an element down touches a cache line or two per level instead of one per comparison.
+
+// Returns the largest of the __count adjacent children starting at __child, the first one for ties.
+template <class _Compare, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 _RandomAccessIterator
+__d_ary_largest_child(_RandomAccessIterator __child, _Compare __comp,
+                      typename iterator_traits<_RandomAccessIterator>::difference_type __count,
+                      false_type /* branchless */) {
+  _RandomAccessIterator __largest = __child;
+  for (typename iterator_traits<_RandomAccessIterator>::difference_type __i = 1; __i < __count; ++__i) {
+    if (__comp(*__largest, __child[__i]))
+      __largest = __child + __i;
+  }
+  return __largest;
+}
+
+// Whichever child is larger is as unpredictable as the elements, so arithmetic elements in one of the
+// standard orders are compared by value, and the largest one so far is picked with conditional moves.
+template <class _Compare, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 _RandomAccessIterator
+__d_ary_largest_child(_RandomAccessIterator __child, _Compare __comp,
+                      typename iterator_traits<_RandomAccessIterator>::difference_type __count,
+                      true_type /* branchless */) {
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+  difference_type __largest = 0;
+  value_type __largest_value = __child[0];
+  for (difference_type __i = 1; __i < __count; ++__i) {
+    value_type __value = __child[__i];
+    bool __larger = __comp(__largest_value, __value);
+    __largest = __larger ? __i : __largest;
+    __largest_value = __larger ? __value : __largest_value;
+  }
+  return __child + __largest;
+}
+
+// The branchless comparisons leave nothing for the processor to speculate on, so the next level of a heap
+// larger than the caches would only be loaded once they are done. This prefetches the children of all
+// the children of the node at __index instead, which are adjacent, whichever child is picked.
+template <size_t _Arity, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI void
+__d_ary_prefetch_grandchildren(_RandomAccessIterator __first,
+                               typename iterator_traits<_RandomAccessIterator>::difference_type __len,
+                               typename iterator_traits<_RandomAccessIterator>::difference_type __index) {
+#if __has_builtin(__builtin_prefetch)
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+  const difference_type __arity = _Arity;
+  const difference_type __step = sizeof(value_type) < 64 ? 64 / sizeof(value_type) : 1;
+  const difference_type __grandchild = __arity * (__arity * __index + 1) + 1;
+  const difference_type __end = __grandchild + __arity * __arity < __len ? __grandchild + __arity * __arity : __len;
+  for (difference_type __i = __grandchild; __i < __end; __i += __step)
+    __builtin_prefetch(std::addressof(*(__first + __i)));
+  if (__grandchild < __end)
+    __builtin_prefetch(std::addressof(*(__first + (__end - 1))));
+#else
+  (void)__first;
+  (void)__len;
+  (void)__index;
+#endif
+}
+
+// Returns the largest child of the node at __index, which must have at least one child. Nodes with all
+// their children, which are nearly all of them, compare a constant number of children.
+template <size_t _Arity, class _Compare, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 _RandomAccessIterator
+__d_ary_largest_child_of(_RandomAccessIterator __first, _Compare __comp,
+                         typename iterator_traits<_RandomAccessIterator>::difference_type __len,
+                         typename iterator_traits<_RandomAccessIterator>::difference_type __index) {
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  const difference_type __arity = _Arity;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+  typedef integral_constant<bool, __use_branchless_search<__uncvref_t<_Compare>, value_type, value_type>::value>
+      _Branchless;
+  const difference_type __child = __arity * __index + 1;
+  if (_Branchless::value && !__libcpp_is_constant_evaluated())
+    std::__d_ary_prefetch_grandchildren<_Arity>(__first, __len, __index);
+  if (__len - __child >= __arity)
+    return std::__d_ary_largest_child<_Compare>(__first + __child, __comp, __arity, _Branchless());
+  return std::__d_ary_largest_child<_Compare>(__first + __child, __comp, __len - __child, _Branchless());
+}
+
+// Moves the last element of [__first, __last) up to its place in the heap [__first, __last - 1).
+template <size_t _Arity, class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 void
+__d_ary_sift_up(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp,
+                typename iterator_traits<_RandomAccessIterator>::difference_type __len) {
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+  const difference_type __arity = _Arity;
+
+  if (__len > 1) {
+    difference_type __parent = (__len - 2) / __arity;
+    _RandomAccessIterator __ptr = __first + __parent;
+
+    if (__comp(*__ptr, *--__last)) {
+      value_type __t(_IterOps<_AlgPolicy>::__iter_move(__last));
+      do {
+        *__last = _IterOps<_AlgPolicy>::__iter_move(__ptr);
+        __last = __ptr;
+        if (__parent == 0)
+          break;
+        __parent = (__parent - 1) / __arity;
+        __ptr = __first + __parent;
+      } while (__comp(*__ptr, __t));
+
+      *__last = std::move(__t);
+    }
+  }
+}
+
+// Moves __start down to its place in the heap [__first, __first + __len), whose subtrees below __start
+// are already heaps.
+template <size_t _Arity, class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 void
+__d_ary_sift_down(_RandomAccessIterator __first, _Compare __comp,
+                  typename iterator_traits<_RandomAccessIterator>::difference_type __len,
+                  _RandomAccessIterator __start) {
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+  const difference_type __arity = _Arity;
+
+  // The nodes after (__len - 2) / _Arity are leaves.
+  difference_type __index = __start - __first;
+  if (__len < 2 || (__len - 2) / __arity < __index)
+    return;
+
+  _RandomAccessIterator __child_i = std::__d_ary_largest_child_of<_Arity, _Compare>(__first, __comp, __len, __index);
+  if (__comp(*__child_i, *__start))
+    return;
+
+  value_type __top(_IterOps<_AlgPolicy>::__iter_move(__start));
+  do {
+    *__start = _IterOps<_AlgPolicy>::__iter_move(__child_i);
+    __start = __child_i;
+    __index = __child_i - __first;
+    if ((__len - 2) / __arity < __index)
+      break;
+    __child_i = std::__d_ary_largest_child_of<_Arity, _Compare>(__first, __comp, __len, __index);
+  } while (!__comp(*__child_i, __top));
+  *__start = std::move(__top);
+}
+
+// Moves the hole at __first down to a leaf, filling it with the largest child at each level, and returns
+// the leaf. This is Floyd's bottom-up variant: the element that fills the hole in the end usually belongs
+// near the bottom, so this doesn't compare it on the way down, and sifts it up from the leaf instead.
+template <size_t _Arity, class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 _RandomAccessIterator
+__d_ary_floyd_sift_down(_RandomAccessIterator __first, _Compare __comp,
+                        typename iterator_traits<_RandomAccessIterator>::difference_type __len) {
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  _LIBCPP_ASSERT(__len >= 2, "shouldn't be called unless __len >= 2");
+  const difference_type __arity = _Arity;
+
+  _RandomAccessIterator __hole = __first;
+  difference_type __index = 0;
+  do {
+    _RandomAccessIterator __child_i = std::__d_ary_largest_child_of<_Arity, _Compare>(__first, __comp, __len, __index);
+    *__hole = _IterOps<_AlgPolicy>::__iter_move(__child_i);
+    __hole = __child_i;
+    __index = __child_i - __first;
+  } while (__index <= (__len - 2) / __arity);
+  return __hole;
+}
+
+template <size_t _Arity, class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 void
+__d_ary_make_heap(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare& __comp) {
+  using _CompRef = typename __comp_ref_type<_Compare>::type;
+  _CompRef __comp_ref = __comp;
+
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  const difference_type __arity = _Arity;
+  difference_type __n = __last - __first;
+  if (__n > 1) {
+    for (difference_type __start = (__n - 2) / __arity; __start >= 0; --__start)
+      std::__d_ary_sift_down<_Arity, _AlgPolicy, _CompRef>(__first, __comp_ref, __n, __first + __start);
+  }
+}
+
+template <size_t _Arity, class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 void
+__d_ary_push_heap(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare& __comp) {
+  using _CompRef = typename __comp_ref_type<_Compare>::type;
+  typename iterator_traits<_RandomAccessIterator>::difference_type __len = __last - __first;
+  std::__d_ary_sift_up<_Arity, _AlgPolicy, _CompRef>(std::move(__first), std::move(__last), __comp, __len);
+}
+
+template <size_t _Arity, class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 void
+__d_ary_pop_heap(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare& __comp) {
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  difference_type __len = __last - __first;
+  _LIBCPP_ASSERT(__len > 0, "The heap given to pop_heap must be non-empty");
+
+  using _CompRef = typename __comp_ref_type<_Compare>::type;
+  _CompRef __comp_ref = __comp;
+
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+  if (__len > 1) {
+    value_type __top = _IterOps<_AlgPolicy>::__iter_move(__first); // create a hole at __first
+    _RandomAccessIterator __hole =
+        std::__d_ary_floyd_sift_down<_Arity, _AlgPolicy, _CompRef>(__first, __comp_ref, __len);
+    --__last;
+
+    if (__hole == __last) {
+      *__hole = std::move(__top);
+    } else {
+      *__hole = _IterOps<_AlgPolicy>::__iter_move(__last);
+      ++__hole;
+      *__last = std::move(__top);
+      std::__d_ary_sift_up<_Arity, _AlgPolicy, _CompRef>(__first, __hole, __comp_ref, __hole - __first);
+    }
+  }
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP___ALGORITHM_D_ARY_HEAP_H
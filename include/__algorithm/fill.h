@@ -12,6 +12,7 @@
 #include <__algorithm/fill_n.h>
 #include <__config>
 #include <__iterator/iterator_traits.h>
+#include <__iterator/segmented_iterator.h>
 #include <type_traits>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -40,11 +41,48 @@ __fill(_RandomAccessIterator __first, _RandomAccessIterator __last, const _Tp& _
 template <class _ForwardIterator, class _Tp>
 inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17
 void
-fill(_ForwardIterator __first, _ForwardIterator __last, const _Tp& __value)
+__fill(_ForwardIterator __first, _ForwardIterator __last, const _Tp& __value, false_type /* segmented */)
 {
     _VSTD::__fill(__first, __last, __value, typename iterator_traits<_ForwardIterator>::iterator_category());
 }
 
+template <class _SegmentedIterator, class _Tp>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17
+void
+__fill(_SegmentedIterator __first, _SegmentedIterator __last, const _Tp& __value, true_type /* segmented */);
+
+template <class _Tp>
+struct __fill_segment_functor
+{
+    const _Tp& __value_;
+
+    template <class _LocalIterator>
+    _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17
+    void operator()(_LocalIterator __first, _LocalIterator __last) const
+    {
+        _VSTD::__fill(__first, __last, __value_, __is_segmented_iterator<_LocalIterator>());
+    }
+};
+
+// Segmented iterators, like the ones of deque, are filled one segment at a time, so that contiguous
+// segments are filled like any other contiguous range.
+template <class _SegmentedIterator, class _Tp>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17
+void
+__fill(_SegmentedIterator __first, _SegmentedIterator __last, const _Tp& __value, true_type /* segmented */)
+{
+    __fill_segment_functor<_Tp> __functor = {__value};
+    _VSTD::__for_each_segment(__first, __last, __functor);
+}
+
+template <class _ForwardIterator, class _Tp>
+inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17
+void
+fill(_ForwardIterator __first, _ForwardIterator __last, const _Tp& __value)
+{
+    _VSTD::__fill(__first, __last, __value, __is_segmented_iterator<_ForwardIterator>());
+}
+
 _LIBCPP_END_NAMESPACE_STD
 
 #endif // _LIBCPP___ALGORITHM_FILL_H
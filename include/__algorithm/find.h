@@ -10,7 +10,14 @@
 #ifndef _LIBCPP___ALGORITHM_FIND_H
 #define _LIBCPP___ALGORITHM_FIND_H
 
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
+#include <__iterator/segmented_iterator.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/remove_const.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -19,14 +26,76 @@
 _LIBCPP_BEGIN_NAMESPACE_STD
 
 template <class _InputIterator, class _Tp>
-_LIBCPP_NODISCARD_EXT inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _InputIterator
-find(_InputIterator __first, _InputIterator __last, const _Tp& __value) {
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _InputIterator
+__find_impl(_InputIterator __first, _InputIterator __last, const _Tp& __value) {
   for (; __first != __last; ++__first)
     if (*__first == __value)
       break;
   return __first;
 }
 
+#ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+// Contiguous ranges of integers and pointers are searched a vector at a time.
+template <class _ValueT,
+          class _Tp,
+          __enable_if_t<__can_find_bitwise<typename remove_const<_ValueT>::type, _Tp>::value &&
+                            __has_simd_equality<_ValueT>::value,
+                        int> = 0>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _ValueT*
+__find_impl(_ValueT* __first, _ValueT* __last, const _Tp& __value) {
+  if (__libcpp_is_constant_evaluated())
+    return std::__find_impl<_ValueT*, _Tp>(__first, __last, __value);
+  typename remove_const<_ValueT>::type __converted;
+  if (!std::__convert_searched_value(__value, __converted))
+    return __last;
+  return std::__simd_find(__first, __last, __converted);
+}
+#endif
+
+template <class _InputIterator, class _Tp>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _InputIterator
+__find(_InputIterator __first, _InputIterator __last, const _Tp& __value, false_type /* segmented */) {
+  return std::__rewrap_iter(
+      __first, std::__find_impl(std::__unwrap_iter(__first), std::__unwrap_iter(__last), __value));
+}
+
+// Segmented iterators, like the ones of deque, are searched one segment at a time, so that contiguous
+// segments are searched like any other contiguous range.
+template <class _SegmentedIterator, class _Tp>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _SegmentedIterator
+__find(_SegmentedIterator __first, _SegmentedIterator __last, const _Tp& __value, true_type /* segmented */) {
+  typedef __segmented_iterator_traits<_SegmentedIterator> _Traits;
+  typedef typename _Traits::__local_iterator _LocalIterator;
+  typedef __is_segmented_iterator<_LocalIterator> _IsSegmented;
+  typename _Traits::__segment_iterator __sfirst = _Traits::__segment(__first);
+  typename _Traits::__segment_iterator __slast  = _Traits::__segment(__last);
+  if (__sfirst == __slast) {
+    _LocalIterator __llast  = _Traits::__local(__last);
+    _LocalIterator __result = std::__find(_Traits::__local(__first), __llast, __value, _IsSegmented());
+    return __result == __llast ? __last : _Traits::__compose(__sfirst, __result);
+  }
+
+  _LocalIterator __lend   = _Traits::__end(__sfirst);
+  _LocalIterator __result = std::__find(_Traits::__local(__first), __lend, __value, _IsSegmented());
+  if (__result != __lend)
+    return _Traits::__compose(__sfirst, __result);
+  for (++__sfirst; __sfirst != __slast; ++__sfirst) {
+    __lend   = _Traits::__end(__sfirst);
+    __result = std::__find(_Traits::__begin(__sfirst), __lend, __value, _IsSegmented());
+    if (__result != __lend)
+      return _Traits::__compose(__sfirst, __result);
+  }
+  __lend   = _Traits::__local(__last);
+  __result = std::__find(_Traits::__begin(__slast), __lend, __value, _IsSegmented());
+  return __result == __lend ? __last : _Traits::__compose(__slast, __result);
+}
+
+template <class _InputIterator, class _Tp>
+_LIBCPP_NODISCARD_EXT inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _InputIterator
+find(_InputIterator __first, _InputIterator __last, const _Tp& __value) {
+  return std::__find(__first, __last, __value, __is_segmented_iterator<_InputIterator>());
+}
+
 _LIBCPP_END_NAMESPACE_STD
 
 #endif // _LIBCPP___ALGORITHM_FIND_H
@@ -11,6 +11,8 @@
 #define _LIBCPP___ALGORITHM_FOR_EACH_H
 
 #include <__config>
+#include <__iterator/segmented_iterator.h>
+#include <__type_traits/integral_constant.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -18,12 +20,42 @@
 
 _LIBCPP_BEGIN_NAMESPACE_STD
 
+template <class _InputIterator, class _Function>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 void
+__for_each(_InputIterator __first, _InputIterator __last, _Function& __f, false_type /* segmented */) {
+  for (; __first != __last; ++__first)
+    __f(*__first);
+}
+
+template <class _SegmentedIterator, class _Function>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 void
+__for_each(_SegmentedIterator __first, _SegmentedIterator __last, _Function& __f, true_type /* segmented */);
+
+template <class _Function>
+struct __for_each_segment_functor {
+  _Function& __f_;
+
+  template <class _LocalIterator>
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 void
+  operator()(_LocalIterator __first, _LocalIterator __last) const {
+    std::__for_each(__first, __last, __f_, __is_segmented_iterator<_LocalIterator>());
+  }
+};
+
+// Segmented iterators, like the ones of deque, are iterated over one segment at a time, with the
+// iterators of the segments.
+template <class _SegmentedIterator, class _Function>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 void
+__for_each(_SegmentedIterator __first, _SegmentedIterator __last, _Function& __f, true_type /* segmented */) {
+  __for_each_segment_functor<_Function> __functor = {__f};
+  std::__for_each_segment(__first, __last, __functor);
+}
+
 template <class _InputIterator, class _Function>
 inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _Function for_each(_InputIterator __first,
                                                                                   _InputIterator __last,
                                                                                   _Function __f) {
-  for (; __first != __last; ++__first)
-    __f(*__first);
+  std::__for_each(__first, __last, __f, __is_segmented_iterator<_InputIterator>());
   return __f;
 }
 
@@ -11,8 +11,17 @@
 
 #include <__algorithm/comp.h>
 #include <__algorithm/comp_ref_type.h>
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__iterator/iterator_traits.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/is_integral.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/remove_const.h>
+#include <cstddef>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -35,6 +44,54 @@ __lexicographical_compare(_InputIterator1 __first1, _InputIterator1 __last1,
     return false;
 }
 
+// Whether contiguous ranges of _Tp can be ordered by __lexicographical_compare_integers: with memcmp if
+// their object representations are ordered like them, and otherwise by finding their first difference a
+// vector at a time.
+template <class _Tp>
+struct __can_lexicographical_compare_integers
+    : integral_constant<bool, __is_bytewise_ordered<_Tp>::value
+#ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+                                  || (is_integral<_Tp>::value && __is_bitwise_equality_comparable<_Tp>::value)
+#endif
+                        > {};
+
+// Orders [__first1, __first1 + __n) and [__first2, __first2 + __n) lexicographically, and returns a value
+// less than, equal to or greater than zero like memcmp.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI int __lexicographical_compare_integers(const _Tp* __first1, const _Tp* __first2, size_t __n) {
+  // Empty ranges may be null pointers, which memcmp must not be given.
+  if (__n == 0)
+    return 0;
+  if (__is_bytewise_ordered<_Tp>::value)
+    return ::__builtin_memcmp(__first1, __first2, __n * sizeof(_Tp));
+  size_t __i = 0;
+#ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+  __i = std::__simd_mismatch(__first1, __first2, __n);
+#endif
+  if (__i == __n)
+    return 0;
+  return __first1[__i] < __first2[__i] ? -1 : 1;
+}
+
+// Contiguous ranges of integers compared with operator< are ordered by __lexicographical_compare_integers.
+template <class _Compare,
+          class _Tp,
+          class _Up,
+          __enable_if_t<is_same<typename remove_const<_Tp>::type, typename remove_const<_Up>::type>::value &&
+                            __is_less_predicate<__uncvref_t<_Compare>, typename remove_const<_Tp>::type>::value &&
+                            __can_lexicographical_compare_integers<typename remove_const<_Tp>::type>::value,
+                        int> = 0>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 bool
+__lexicographical_compare(_Tp* __first1, _Tp* __last1, _Up* __first2, _Up* __last2, _Compare __comp) {
+  if (__libcpp_is_constant_evaluated())
+    return std::__lexicographical_compare<_Compare, _Tp*, _Up*>(__first1, __last1, __first2, __last2, __comp);
+  size_t __size1 = static_cast<size_t>(__last1 - __first1);
+  size_t __size2 = static_cast<size_t>(__last2 - __first2);
+  int __result   = std::__lexicographical_compare_integers<typename remove_const<_Tp>::type>(
+      __first1, __first2, __size1 < __size2 ? __size1 : __size2);
+  return __result != 0 ? __result < 0 : __size1 < __size2;
+}
+
 template <class _InputIterator1, class _InputIterator2, class _Compare>
 _LIBCPP_NODISCARD_EXT inline
 _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17
@@ -43,7 +100,9 @@ lexicographical_compare(_InputIterator1 __first1, _InputIterator1 __last1,
                         _InputIterator2 __first2, _InputIterator2 __last2, _Compare __comp)
 {
     typedef typename __comp_ref_type<_Compare>::type _Comp_ref;
-    return _VSTD::__lexicographical_compare<_Comp_ref>(__first1, __last1, __first2, __last2, __comp);
+    return _VSTD::__lexicographical_compare<_Comp_ref>(_VSTD::__unwrap_iter(__first1), _VSTD::__unwrap_iter(__last1),
+                                                       _VSTD::__unwrap_iter(__first2), _VSTD::__unwrap_iter(__last2),
+                                                       __comp);
 }
 
 template <class _InputIterator1, class _InputIterator2>
@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_LEXICOGRAPHICAL_COMPARE_THREE_WAY_H
+#define _LIBCPP___ALGORITHM_LEXICOGRAPHICAL_COMPARE_THREE_WAY_H
+
+#include <__algorithm/lexicographical_compare.h>
+#include <__algorithm/unwrap_iter.h>
+#include <__compare/compare_three_way.h>
+#include <__compare/ordering.h>
+#include <__config>
+#include <__iterator/iterator_traits.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/remove_const.h>
+#include <cstddef>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER > 17
+
+template <class _Cmp, class _InputIterator1, class _InputIterator2>
+_LIBCPP_HIDE_FROM_ABI constexpr auto __lexicographical_compare_three_way(
+    _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _InputIterator2 __last2, _Cmp __comp)
+    -> decltype(__comp(*__first1, *__first2)) {
+  if constexpr (__is_cpp17_random_access_iterator<_InputIterator1>::value &&
+                __is_cpp17_random_access_iterator<_InputIterator2>::value) {
+    // Only the shorter range needs to be checked for its end.
+    auto __size1 = __last1 - __first1;
+    auto __size2 = __last2 - __first2;
+    auto __size  = __size1 < __size2 ? __size1 : __size2;
+    for (decltype(__size) __i = 0; __i != __size; ++__i) {
+      auto __result = __comp(__first1[__i], __first2[__i]);
+      if (__result != 0)
+        return __result;
+    }
+    return __size1 <=> __size2;
+  } else {
+    for (; __first1 != __last1 && __first2 != __last2; ++__first1, (void)++__first2) {
+      auto __result = __comp(*__first1, *__first2);
+      if (__result != 0)
+        return __result;
+    }
+    if (__first1 != __last1)
+      return strong_ordering::greater;
+    if (__first2 != __last2)
+      return strong_ordering::less;
+    return strong_ordering::equal;
+  }
+}
+
+// Contiguous ranges of integers compared with compare_three_way are ordered by
+// __lexicographical_compare_integers.
+template <class _Cmp, class _Tp, class _Up>
+  requires is_same_v<__uncvref_t<_Cmp>, compare_three_way> && is_same_v<remove_const_t<_Tp>, remove_const_t<_Up>> &&
+           __can_lexicographical_compare_integers<remove_const_t<_Tp>>::value
+_LIBCPP_HIDE_FROM_ABI constexpr strong_ordering
+__lexicographical_compare_three_way(_Tp* __first1, _Tp* __last1, _Up* __first2, _Up* __last2, _Cmp __comp) {
+  if (__libcpp_is_constant_evaluated())
+    return std::__lexicographical_compare_three_way<_Cmp, _Tp*, _Up*>(__first1, __last1, __first2, __last2, __comp);
+  size_t __size1 = static_cast<size_t>(__last1 - __first1);
+  size_t __size2 = static_cast<size_t>(__last2 - __first2);
+  int __result   = std::__lexicographical_compare_integers<remove_const_t<_Tp>>(
+      __first1, __first2, __size1 < __size2 ? __size1 : __size2);
+  return __result != 0 ? __result <=> 0 : __size1 <=> __size2;
+}
+
+template <class _InputIterator1, class _InputIterator2, class _Cmp>
+_LIBCPP_NODISCARD_EXT _LIBCPP_HIDE_FROM_ABI constexpr auto lexicographical_compare_three_way(
+    _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _InputIterator2 __last2, _Cmp __comp)
+    -> decltype(__comp(*__first1, *__first2)) {
+  static_assert(__one_of_v<decltype(__comp(*__first1, *__first2)), partial_ordering, weak_ordering, strong_ordering>,
+                "The comparator passed to lexicographical_compare_three_way must return a comparison category type.");
+  return std::__lexicographical_compare_three_way<_Cmp&>(
+      std::__unwrap_iter(__first1), std::__unwrap_iter(__last1), std::__unwrap_iter(__first2),
+      std::__unwrap_iter(__last2), __comp);
+}
+
+template <class _InputIterator1, class _InputIterator2>
+_LIBCPP_NODISCARD_EXT _LIBCPP_HIDE_FROM_ABI constexpr auto lexicographical_compare_three_way(
+    _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _InputIterator2 __last2) {
+  return std::lexicographical_compare_three_way(__first1, __last1, __first2, __last2, compare_three_way());
+}
+
+#endif // _LIBCPP_STD_VER > 17
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP___ALGORITHM_LEXICOGRAPHICAL_COMPARE_THREE_WAY_H
@@ -12,14 +12,25 @@
 #include <__algorithm/comp.h>
 #include <__algorithm/half_positive.h>
 #include <__algorithm/iterator_operations.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__functional/identity.h>
 #include <__functional/invoke.h>
+#include <__functional/operations.h>
+#include <__functional/ranges_operations.h>
 #include <__iterator/advance.h>
 #include <__iterator/distance.h>
 #include <__iterator/iterator_traits.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_arithmetic.h>
 #include <__type_traits/is_callable.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/is_volatile.h>
+#include <__type_traits/remove_const.h>
 #include <__type_traits/remove_reference.h>
+#include <cstddef>
 #include <type_traits>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -47,13 +58,127 @@ _Iter __lower_bound_impl(_Iter __first, _Sent __last, const _Type& __value, _Com
   return __first;
 }
 
+// Returns the first element of [__first, __last) which isn't ordered before __value, like
+// __lower_bound_impl, but looks at the elements 0, 1, 3, 7, 15... positions after __first before
+// bisecting the last interval it has stepped into. It makes O(log(d)) comparisons, where d is the
+// distance from __first to the result, rather than O(log(__last - __first)), which makes it the better
+// choice to skip a run of elements whose end is likely close to __first.
+template <class _RandomAccessIterator, class _Type, class _Comp>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _RandomAccessIterator __lower_bound_onesided(
+    _RandomAccessIterator __first, _RandomAccessIterator __last, const _Type& __value, _Comp& __comp) {
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  if (__first == __last || !__comp(*__first, __value))
+    return __first;
+  auto __proj = std::__identity();
+  for (difference_type __step = 1;; __step *= 2) {
+    // *__first is ordered before __value.
+    if (__step >= __last - __first)
+      return std::__lower_bound_impl<_ClassicAlgPolicy>(__first + difference_type(1), __last, __value, __comp, __proj);
+    _RandomAccessIterator __probe = __first + __step;
+    if (!__comp(*__probe, __value)) {
+      if (__step == 1)
+        return __probe;
+      return std::__lower_bound_impl<_ClassicAlgPolicy>(__first + difference_type(1), __probe, __value, __comp, __proj);
+    }
+    __first = __probe;
+  }
+}
+
+// Whether the set algorithms can skip over a run of the elements of [__first, __last) with
+// __lower_bound_onesided, and the number of elements in a row they go through one by one before they do.
+// Searching for the end of a short run takes more comparisons than going through it.
+template <class _Iter, class _Sent>
+struct __can_gallop
+    : integral_constant<bool, is_same<_Iter, _Sent>::value && __is_cpp17_random_access_iterator<_Iter>::value> {};
+
+const unsigned __gallop_threshold = 8;
+
+// Galloping only pays off when one of the ranges is much longer than the other one. When their lengths
+// are close, the runs are short, and searching for their ends mispredicts more branches than merging
+// them element by element, so the set algorithms stick to the plain merge.
+const int __gallop_min_ratio = 64;
+
+template <class _Iter1, class _Iter2>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 bool
+__should_gallop(_Iter1 __first1, _Iter1 __last1, _Iter2 __first2, _Iter2 __last2) {
+  return (__last1 - __first1) / __gallop_min_ratio > __last2 - __first2 ||
+         (__last2 - __first2) / __gallop_min_ratio > __last1 - __first1;
+}
+
+template <class _Comp>
+struct __is_standard_order : false_type {};
+template <class _T1, class _T2>
+struct __is_standard_order<__less<_T1, _T2> > : true_type {};
+template <class _Tp>
+struct __is_standard_order<less<_Tp> > : true_type {};
+template <class _Tp>
+struct __is_standard_order<greater<_Tp> > : true_type {};
+#if _LIBCPP_STD_VER > 17
+template <>
+struct __is_standard_order<ranges::less> : true_type {};
+template <>
+struct __is_standard_order<ranges::greater> : true_type {};
+#endif
+
+// Whether contiguous elements of type _Tp can be searched for a value of type _Up without branching on
+// the outcome of the comparisons, which is as unpredictable as the value: _Comp is one of the standard
+// orders, so comparing arithmetic values with it is cheap and has no side effects.
+template <class _Comp, class _Tp, class _Up>
+struct __use_branchless_search
+    : integral_constant<bool, __is_standard_order<_Comp>::value && is_arithmetic<_Tp>::value &&
+                                  !is_volatile<_Tp>::value && is_arithmetic<_Up>::value> {};
+
+// Prefetches the element that the next step of a binary search looks at, whichever half of the range
+// it ends up in. Once the range is larger than the caches, this overlaps the next load with the current
+// comparison, which is the latency the search is bound by.
+template <class _Tp>
+inline _LIBCPP_HIDE_FROM_ABI void __prefetch_next_midpoints(const _Tp* __first, size_t __half, size_t __next_half) {
+#if __has_builtin(__builtin_prefetch)
+  __builtin_prefetch(__first + __next_half);
+  __builtin_prefetch(__first + __half + __next_half);
+#else
+  (void)__first;
+  (void)__half;
+  (void)__next_half;
+#endif
+}
+
+// Binary search which keeps the range it has left to search [__first, __first + __len] (note the
+// closed end) at half its previous size in every step, whatever the comparison says. The comparison
+// only decides where the range starts, which compiles to a conditional move rather than a branch.
+template <class _AlgPolicy,
+          class _Tp,
+          class _Type,
+          class _Comp,
+          __enable_if_t<__use_branchless_search<_Comp, typename remove_const<_Tp>::type, _Type>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17
+_Tp* __lower_bound_impl(_Tp* __first, _Tp* __last, const _Type& __value, _Comp& __comp, __identity& __proj) {
+  if (__libcpp_is_constant_evaluated())
+    return std::__lower_bound_impl<_AlgPolicy, _Tp*, _Tp*, _Type, __identity, _Comp>(
+        __first, __last, __value, __comp, __proj);
+
+  size_t __len = static_cast<size_t>(__last - __first);
+  if (__len == 0)
+    return __first;
+  while (__len > 1) {
+    size_t __half = __len / 2;
+    std::__prefetch_next_midpoints(__first, __half, (__len - __half) / 2);
+    __first += __comp(__first[__half], __value) ? __half : 0;
+    __len -= __half;
+  }
+  return __first + (__comp(*__first, __value) ? 1 : 0);
+}
+
 template <class _ForwardIterator, class _Tp, class _Compare>
 _LIBCPP_NODISCARD_EXT inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17
 _ForwardIterator lower_bound(_ForwardIterator __first, _ForwardIterator __last, const _Tp& __value, _Compare __comp) {
   static_assert(__is_callable<_Compare, decltype(*__first), const _Tp&>::value,
                 "The comparator has to be callable");
   auto __proj = std::__identity();
-  return std::__lower_bound_impl<_ClassicAlgPolicy>(__first, __last, __value, __comp, __proj);
+  return std::__rewrap_iter(
+      __first,
+      std::__lower_bound_impl<_ClassicAlgPolicy>(
+          std::__unwrap_iter(__first), std::__unwrap_iter(__last), __value, __comp, __proj));
 }
 
 template <class _ForwardIterator, class _Tp>
@@ -11,8 +11,14 @@
 
 #include <__algorithm/comp.h>
 #include <__algorithm/comp_ref_type.h>
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__iterator/iterator_traits.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/remove_const.h>
+#include <__type_traits/remove_cvref.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -36,12 +42,28 @@ __max_element(_ForwardIterator __first, _ForwardIterator __last, _Compare __comp
     return __first;
 }
 
+#ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+// Contiguous ranges of integers and floating point values compared with operator< are looked at a vector
+// at a time.
+template <class _Compare,
+          class _Tp,
+          __enable_if_t<__has_simd_ordering<typename remove_const<_Tp>::type>::value &&
+                            __is_less_predicate<__uncvref_t<_Compare>, typename remove_const<_Tp>::type>::value,
+                        int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 _Tp* __max_element(_Tp* __first, _Tp* __last, _Compare __comp) {
+  if (__libcpp_is_constant_evaluated())
+    return std::__max_element<_Compare, _Tp*>(__first, __last, __comp);
+  return std::__simd_min_element<true>(__first, __last);
+}
+#endif
+
 template <class _ForwardIterator, class _Compare>
 _LIBCPP_NODISCARD_EXT inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 _ForwardIterator
 max_element(_ForwardIterator __first, _ForwardIterator __last, _Compare __comp)
 {
     typedef typename __comp_ref_type<_Compare>::type _Comp_ref;
-    return _VSTD::__max_element<_Comp_ref>(__first, __last, __comp);
+    return std::__rewrap_iter(
+        __first, std::__max_element<_Comp_ref>(std::__unwrap_iter(__first), std::__unwrap_iter(__last), __comp));
 }
 
 
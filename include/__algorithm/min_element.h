@@ -11,11 +11,17 @@
 
 #include <__algorithm/comp.h>
 #include <__algorithm/comp_ref_type.h>
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__functional/identity.h>
 #include <__functional/invoke.h>
 #include <__iterator/iterator_traits.h>
+#include <__type_traits/enable_if.h>
 #include <__type_traits/is_callable.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/remove_const.h>
+#include <__type_traits/remove_cvref.h>
 #include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -45,6 +51,23 @@ _Iter __min_element(_Iter __first, _Sent __last, _Comp __comp) {
   return std::__min_element<_Comp>(std::move(__first), std::move(__last), __comp, __proj);
 }
 
+#ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+// Contiguous ranges of integers and floating point values compared with operator< are looked at a vector
+// at a time.
+template <class _Comp,
+          class _Tp,
+          __enable_if_t<__has_simd_ordering<typename remove_const<_Tp>::type>::value &&
+                            __is_less_predicate<__uncvref_t<_Comp>, typename remove_const<_Tp>::type>::value,
+                        int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 _Tp* __min_element(_Tp* __first, _Tp* __last, _Comp __comp) {
+  if (__libcpp_is_constant_evaluated()) {
+    auto __proj = __identity();
+    return std::__min_element<_Comp>(__first, __last, __comp, __proj);
+  }
+  return std::__simd_min_element<false>(__first, __last);
+}
+#endif
+
 template <class _ForwardIterator, class _Compare>
 _LIBCPP_NODISCARD_EXT inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 _ForwardIterator
 min_element(_ForwardIterator __first, _ForwardIterator __last, _Compare __comp)
@@ -55,7 +78,8 @@ min_element(_ForwardIterator __first, _ForwardIterator __last, _Compare __comp)
               "The comparator has to be callable");
 
   typedef typename __comp_ref_type<_Compare>::type _Comp_ref;
-  return std::__min_element<_Comp_ref>(std::move(__first), std::move(__last), __comp);
+  return std::__rewrap_iter(
+      __first, std::__min_element<_Comp_ref>(std::__unwrap_iter(__first), std::__unwrap_iter(__last), __comp));
 }
 
 template <class _ForwardIterator>
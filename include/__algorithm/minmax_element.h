@@ -10,6 +10,8 @@
 #define _LIBCPP___ALGORITHM_MINMAX_ELEMENT_H
 
 #include <__algorithm/comp.h>
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__functional/identity.h>
 #include <__iterator/iterator_traits.h>
@@ -38,21 +40,12 @@ public:
   }
 };
 
-template <class _Iter, class _Sent, class _Proj, class _Comp>
+// Updates __result, which holds the first smallest and the last largest elements seen so far, with the
+// elements of [__first, __last), two at a time.
+template <class _Iter, class _Sent, class _Less>
 _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11
-pair<_Iter, _Iter> __minmax_element_impl(_Iter __first, _Sent __last, _Comp& __comp, _Proj& __proj) {
-  auto __less = _MinmaxElementLessFunc<_Comp, _Proj>(__comp, __proj);
-
-  pair<_Iter, _Iter> __result(__first, __first);
-  if (__first == __last || ++__first == __last)
-    return __result;
-
-  if (__less(__first, __result.first))
-    __result.first = __first;
-  else
-    __result.second = __first;
-
-  while (++__first != __last) {
+pair<_Iter, _Iter> __minmax_element_loop(_Iter __first, _Sent __last, _Less& __less, pair<_Iter, _Iter> __result) {
+  while (__first != __last) {
     _Iter __i = __first;
     if (++__first == __last) {
       if (__less(__i, __result.first))
@@ -73,11 +66,80 @@ pair<_Iter, _Iter> __minmax_element_impl(_Iter __first, _Sent __last, _Comp& __c
       if (!__less(__first, __result.second))
         __result.second = __first;
     }
+    ++__first;
   }
 
   return __result;
 }
 
+template <class _Iter, class _Sent, class _Proj, class _Comp>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11
+pair<_Iter, _Iter> __minmax_element_impl(_Iter __first, _Sent __last, _Comp& __comp, _Proj& __proj) {
+  auto __less = _MinmaxElementLessFunc<_Comp, _Proj>(__comp, __proj);
+
+  pair<_Iter, _Iter> __result(__first, __first);
+  if (__first == __last || ++__first == __last)
+    return __result;
+
+  if (__less(__first, __result.first))
+    __result.first = __first;
+  else
+    __result.second = __first;
+
+  return std::__minmax_element_loop(++__first, __last, __less, __result);
+}
+
+#ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+// Contiguous ranges of integers and floating point values compared with operator< are looked at a vector
+// at a time, one chunk of vectors after the other. If a chunk holds a NaN, the loop above takes over
+// from there, so that the result is the one it would have found on its own: it has found the same
+// elements so far, and the chunks are made of pairs of elements lined up with the ones it looks at.
+template <class _Tp,
+          class _Comp,
+          __enable_if_t<__has_simd_ordering<typename remove_const<_Tp>::type>::value &&
+                            __is_less_predicate<__uncvref_t<_Comp>, typename remove_const<_Tp>::type>::value,
+                        int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11
+pair<_Tp*, _Tp*> __minmax_element_impl(_Tp* __first, _Tp* __last, _Comp& __comp, __identity& __proj) {
+  typedef typename remove_const<_Tp>::type _Value;
+  typedef __simd_ordered_vector<_Value> _Traits;
+  if (__libcpp_is_constant_evaluated())
+    return std::__minmax_element_impl<_Tp*, _Tp*, __identity, _Comp>(__first, __last, __comp, __proj);
+
+  _Value __min = _Value(), __max = _Value();
+  _Tp* __min_chunk = __first;
+  _Tp* __max_chunk_end = __first;
+  _Tp* __i = __first;
+  while (static_cast<size_t>(__last - __i) >= _Traits::__size) {
+    size_t __vectors = static_cast<size_t>(__last - __i) / _Traits::__size;
+    if (__vectors > __simd_extremum_chunk_vectors)
+      __vectors = __simd_extremum_chunk_vectors;
+    _Value __chunk_min = _Value(), __chunk_max = _Value();
+    if (!std::__simd_minmax<_Value>(__i, __vectors, __chunk_min, __chunk_max))
+      break;
+    if (__i == __first || __chunk_min < __min) {
+      __min       = __chunk_min;
+      __min_chunk = __i;
+    }
+    __i += __vectors * _Traits::__size;
+    if (!(__chunk_max < __max) || __max_chunk_end == __first) {
+      __max           = __chunk_max;
+      __max_chunk_end = __i;
+    }
+  }
+  if (__i == __first)
+    return std::__minmax_element_impl<_Tp*, _Tp*, __identity, _Comp>(__first, __last, __comp, __proj);
+
+  pair<_Tp*, _Tp*> __result(__min_chunk, __max_chunk_end - 1);
+  while (!(*__result.first == __min))
+    ++__result.first;
+  while (!(*__result.second == __max))
+    --__result.second;
+  auto __less = _MinmaxElementLessFunc<_Comp, __identity>(__comp, __proj);
+  return std::__minmax_element_loop(__i, __last, __less, __result);
+}
+#endif
+
 template <class _ForwardIterator, class _Compare>
 _LIBCPP_NODISCARD_EXT _LIBCPP_CONSTEXPR_AFTER_CXX11
 pair<_ForwardIterator, _ForwardIterator>
@@ -87,7 +149,9 @@ minmax_element(_ForwardIterator __first, _ForwardIterator __last, _Compare __com
   static_assert(__is_callable<_Compare, decltype(*__first), decltype(*__first)>::value,
                 "The comparator has to be callable");
   auto __proj = __identity();
-  return std::__minmax_element_impl(__first, __last, __comp, __proj);
+  auto __result = std::__minmax_element_impl(std::__unwrap_iter(__first), std::__unwrap_iter(__last), __comp, __proj);
+  return pair<_ForwardIterator, _ForwardIterator>(
+      std::__rewrap_iter(__first, __result.first), std::__rewrap_iter(__first, __result.second));
 }
 
 template <class _ForwardIterator>
@@ -17,7 +17,9 @@
 #include <__debug>
 #include <__debug_utils/randomize_range.h>
 #include <__iterator/iterator_traits.h>
+#include <__type_traits/is_constant_evaluated.h>
 #include <__utility/move.h>
+#include <__utility/pair.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -222,6 +224,172 @@ __nth_element(_RandomAccessIterator __first, _RandomAccessIterator __nth, _Rando
     }
 }
 
+// Sorts [__first, __last), which is short, with insertion sort. __leftmost has the same meaning as for
+// __introsort.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCPP_HIDE_FROM_ABI void __select_by_insertion_sort(_RandomAccessIterator __first, _RandomAccessIterator __last,
+                                                      _Compare __comp, bool __leftmost) {
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  difference_type __len = __last - __first;
+  if (__len < 2)
+    return;
+  if (!__leftmost)
+    std::__insertion_sort_unguarded<_AlgPolicy, _Compare>(__first, __last, __comp);
+  else if (__len == 2) {
+    if (__comp(*--__last, *__first))
+      _IterOps<_AlgPolicy>::iter_swap(__first, __last);
+  } else
+    std::__insertion_sort_3<_AlgPolicy, _Compare>(__first, __last, __comp);
+}
+
+// Partitions [__first, __last) around the pivot in *__first for __introselect and __median_of_medians_select,
+// and narrows the range down to the part that holds __nth. Returns false if the element at __nth is in place.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, bool _UseBitSetPartition>
+_LIBCPP_HIDE_FROM_ABI bool __select_partition(_RandomAccessIterator& __first, _RandomAccessIterator __nth,
+                                              _RandomAccessIterator& __last, _Compare __comp, bool& __leftmost) {
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  // If the pivot is equivalent to the element right before the range, which is not greater than any
+  // element of the range, all the elements not greater than the pivot are equivalent to it, and already
+  // in place once they are moved to the front.
+  if (!__leftmost && !__comp(*(__first - difference_type(1)), *__first)) {
+    __first = std::__partition_with_equals_on_left<_AlgPolicy, _Compare>(__first, __last, __comp);
+    return __first <= __nth;
+  }
+  pair<_RandomAccessIterator, bool> __ret =
+      _UseBitSetPartition ? std::__bitset_partition<_AlgPolicy, _Compare>(__first, __last, __comp)
+                          : std::__partition_with_equals_on_right<_AlgPolicy, _Compare>(__first, __last, __comp);
+  _RandomAccessIterator __i = __ret.first;
+  // [__first, __i) < *__i and *__i <= [__i+1, __last)
+  if (__nth == __i)
+    return false;
+  // If the range was already partitioned, see if insertion sort is quick on the part that holds __nth.
+  if (__ret.second) {
+    using _WrappedComp = typename _WrapAlgPolicy<_AlgPolicy, _Compare>::type;
+    _WrappedComp __wrapped_comp(__comp);
+    if (__nth < __i ? std::__insertion_sort_incomplete<_WrappedComp>(__first, __i, __wrapped_comp)
+                    : std::__insertion_sort_incomplete<_WrappedComp>(__i + difference_type(1), __last, __wrapped_comp))
+      return false;
+  }
+  if (__nth < __i) {
+    __last = __i;
+  } else {
+    __first = ++__i;
+    __leftmost = false;
+  }
+  return true;
+}
+
+// Places the element at __nth in [__first, __last) like __introselect, but with the median of the medians of
+// groups of five elements as the pivot. At least 3/10 of the elements are on either side of that pivot, so
+// that the range shrinks by a constant factor at every step, and this takes linear time on any input. The
+// selections that wait for the median of their medians are kept in __pending rather than on the call stack.
+// Each one works on a fifth of the range of the one before, so there are fewer of them than half the bits
+// of difference_type.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCPP_HIDE_FROM_ABI void __median_of_medians_select(_RandomAccessIterator __first, _RandomAccessIterator __nth,
+                                                      _RandomAccessIterator __last, _Compare __comp, bool __leftmost) {
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  typedef typename iterator_traits<_RandomAccessIterator>::value_type value_type;
+  struct _Selection {
+    _RandomAccessIterator __first_;
+    _RandomAccessIterator __nth_;
+    _RandomAccessIterator __last_;
+    bool __leftmost_;
+  };
+  const difference_type __limit = __insertion_sort_limit<value_type>::value < 15
+                                      ? 15
+                                      : __insertion_sort_limit<value_type>::value;
+  _Selection __pending[sizeof(difference_type) * __CHAR_BIT__ / 2];
+  int __depth = 0;
+  while (true) {
+    difference_type __len = __last - __first;
+    if (__len > __limit) {
+      // Gather the medians of the groups at the front of the range, and select their median first.
+      difference_type __groups = __len / 5;
+      for (difference_type __g = 0; __g != __groups; ++__g) {
+        _RandomAccessIterator __group = __first + difference_type(5) * __g;
+        std::__sort5_maybe_branchless<_AlgPolicy, _Compare>(
+            __group, __group + difference_type(1), __group + difference_type(2), __group + difference_type(3),
+            __group + difference_type(4), __comp);
+        _IterOps<_AlgPolicy>::iter_swap(__first + __g, __group + difference_type(2));
+      }
+      _Selection& __s = __pending[__depth++];
+      __s.__first_    = __first;
+      __s.__nth_      = __nth;
+      __s.__last_     = __last;
+      __s.__leftmost_ = __leftmost;
+      __nth           = __first + __groups / 2;
+      __last          = __first + __groups;
+      continue;
+    }
+    std::__select_by_insertion_sort<_AlgPolicy, _Compare>(__first, __last, __comp, __leftmost);
+    // Go back to the selections that were waiting for their median, until one of them has to go on.
+    while (true) {
+      if (__depth == 0)
+        return;
+      _Selection& __s = __pending[--__depth];
+      __first         = __s.__first_;
+      __nth           = __s.__nth_;
+      __last          = __s.__last_;
+      __leftmost      = __s.__leftmost_;
+      // There are at least three groups, so some of the other medians are not less and not greater than
+      // the pivot, and guard the partitions.
+      _IterOps<_AlgPolicy>::iter_swap(__first, __first + (__last - __first) / 5 / 2);
+      if (std::__select_partition<_AlgPolicy, _Compare, _RandomAccessIterator, false>(
+              __first, __nth, __last, __comp, __leftmost))
+        break;
+    }
+  }
+}
+
+// Places the element at __nth in [__first, __last) with quickselect, which partitions the range around the
+// same pivots as __introsort, and only goes on with the part that holds __nth. A poor choice of pivots, which
+// adversarial inputs can force, makes this quadratic. After a partition that hasn't halved the range, a few
+// elements are swapped around to break up patterns, and once several partitions in a row haven't, it falls
+// back to __median_of_medians_select. This keeps it linear in the worst case.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, bool _UseBitSetPartition>
+_LIBCPP_HIDE_FROM_ABI void __introselect(_RandomAccessIterator __first, _RandomAccessIterator __nth,
+                                         _RandomAccessIterator __last, _Compare __comp) {
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  typedef typename iterator_traits<_RandomAccessIterator>::value_type value_type;
+  const difference_type __limit = __insertion_sort_limit<value_type>::value;
+  // The number of partitions that may fail to halve the range before falling back.
+  const int __max_attempts = 4;
+  bool __leftmost = true;
+  difference_type __len_to_halve = __last - __first;
+  int __attempts = 0;
+  while (true) {
+    difference_type __len = __last - __first;
+    if (__len <= __limit) {
+      std::__select_by_insertion_sort<_AlgPolicy, _Compare>(__first, __last, __comp, __leftmost);
+      return;
+    }
+    if (__attempts > __max_attempts) {
+      std::__median_of_medians_select<_AlgPolicy, _Compare>(__first, __nth, __last, __comp, __leftmost);
+      return;
+    }
+    if (__attempts > 0) {
+      // Swap a few elements around, which breaks up the patterns that led to poor pivots.
+      difference_type __quarter = __len / 4;
+      _IterOps<_AlgPolicy>::iter_swap(__first, __first + __quarter);
+      _IterOps<_AlgPolicy>::iter_swap(__last - difference_type(1), __last - __quarter);
+      _IterOps<_AlgPolicy>::iter_swap(__first + difference_type(1), __first + (__quarter + 1));
+      _IterOps<_AlgPolicy>::iter_swap(__last - difference_type(2), __last - (__quarter + 1));
+      _IterOps<_AlgPolicy>::iter_swap(__first + __len / 2, __first + (__len / 2 + __quarter / 2));
+    }
+    std::__choose_pivot<_AlgPolicy, _Compare>(__first, __last, __comp);
+    if (!std::__select_partition<_AlgPolicy, _Compare, _RandomAccessIterator, _UseBitSetPartition>(
+            __first, __nth, __last, __comp, __leftmost))
+      return;
+    if (__last - __first <= __len_to_halve / 2) {
+      __len_to_halve = __last - __first;
+      __attempts = 0;
+    } else {
+      ++__attempts;
+    }
+  }
+}
+
 template <class _AlgPolicy, class _RandomAccessIterator, class _Compare>
 inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17
 void __nth_element_impl(_RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last,
@@ -232,7 +400,14 @@ void __nth_element_impl(_RandomAccessIterator __first, _RandomAccessIterator __n
   std::__debug_randomize_range<_AlgPolicy>(__first, __last);
 
   using _Comp_ref = typename __comp_ref_type<_Compare>::type;
-  std::__nth_element<_AlgPolicy, _Comp_ref>(__first, __nth, __last, __comp);
+  if (__libcpp_is_constant_evaluated()) {
+    std::__nth_element<_AlgPolicy, _Comp_ref>(__first, __nth, __last, __comp);
+  } else {
+    _Comp_ref __comp_ref(__comp);
+    std::__introselect<_AlgPolicy, _Comp_ref, _RandomAccessIterator,
+                       __use_branchless_sort<_Comp_ref, _RandomAccessIterator>::value>(
+        __first, __nth, __last, __comp_ref);
+  }
 
   std::__debug_randomize_range<_AlgPolicy>(__first, __nth);
   if (__nth != __last) {
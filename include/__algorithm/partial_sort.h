@@ -13,12 +13,16 @@
 #include <__algorithm/comp_ref_type.h>
 #include <__algorithm/iterator_operations.h>
 #include <__algorithm/make_heap.h>
+#include <__algorithm/nth_element.h>
 #include <__algorithm/sift_down.h>
+#include <__algorithm/sort.h>
 #include <__algorithm/sort_heap.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__debug>
 #include <__debug_utils/randomize_range.h>
 #include <__iterator/iterator_traits.h>
+#include <__type_traits/is_constant_evaluated.h>
 #include <__utility/move.h>
 #include <type_traits>
 
@@ -54,6 +58,59 @@ _RandomAccessIterator __partial_sort_impl(
   return __i;
 }
 
+// Sorts the __middle - __first smallest elements of [__first, __last) into [__first, __middle) by placing the
+// last of them with __introselect, and sorting the ones before it. This takes linear time, on any input, plus
+// the time to sort them.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+void __partial_sort_by_selection(_RandomAccessIterator __first, _RandomAccessIterator __middle,
+                                 _RandomAccessIterator __last, _Compare __comp) {
+  --__middle;
+  std::__introselect<_AlgPolicy, _Compare, _RandomAccessIterator,
+                     __use_branchless_sort<_Compare, _RandomAccessIterator>::value>(__first, __middle, __last, __comp);
+  using _WrappedComp = typename _WrapAlgPolicy<_AlgPolicy, _Compare>::type;
+  _WrappedComp __wrapped_comp(__comp);
+  std::__sort<_WrappedComp>(std::__unwrap_iter(__first), std::__unwrap_iter(__middle), __wrapped_comp);
+}
+
+// Sorts the __middle - __first smallest elements of [__first, __last) into [__first, __middle). When they are
+// few, they are kept in a heap while the rest of the range is scanned, so that most elements only cost a
+// comparison with the top of the heap. Each element that goes into the heap costs a sift down, though, and
+// inputs that are in descending order send them all there. So this gives up on the heap for
+// __partial_sort_by_selection once too many elements went into it, and doesn't use it when there are more
+// than a few elements to sort, for which selecting them is faster anyway.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+void __partial_sort_by_heap_or_selection(_RandomAccessIterator __first, _RandomAccessIterator __middle,
+                                         _RandomAccessIterator __last, _Compare __comp) {
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  // The heap is only used for up to this fraction of the range.
+  const difference_type __max_heap_fraction = 256;
+  difference_type __len = __middle - __first;
+  if (__len > (__last - __first) / __max_heap_fraction) {
+    std::__partial_sort_by_selection<_AlgPolicy, _Compare>(__first, __middle, __last, __comp);
+    return;
+  }
+
+  std::__make_heap<_AlgPolicy, _Compare>(__first, __middle, __comp);
+  // Sifting an element down the heap takes up to two comparisons per level, and the heap is given up on once
+  // that adds up to as many comparisons as there are elements to scan.
+  const difference_type __sift_down_cost = 2 * std::__log2i(__len);
+  difference_type __comparisons_left = __last - __middle;
+  _RandomAccessIterator __i = __middle;
+  for (; __i != __last; ++__i) {
+    if (__comp(*__i, *__first)) {
+      if ((__comparisons_left -= __sift_down_cost) < 0)
+        break;
+      _IterOps<_AlgPolicy>::iter_swap(__i, __first);
+      std::__sift_down<_AlgPolicy, _Compare>(__first, __comp, __len, __first);
+    }
+  }
+  if (__i != __last) {
+    std::__partial_sort_by_selection<_AlgPolicy, _Compare>(__first, __middle, __last, __comp);
+    return;
+  }
+  std::__sort_heap<_AlgPolicy, _Compare>(__first, __middle, __comp);
+}
+
 template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, class _Sentinel>
 _LIBCPP_CONSTEXPR_AFTER_CXX17
 _RandomAccessIterator __partial_sort(_RandomAccessIterator __first, _RandomAccessIterator __middle, _Sentinel __last,
@@ -64,7 +121,15 @@ _RandomAccessIterator __partial_sort(_RandomAccessIterator __first, _RandomAcces
   std::__debug_randomize_range<_AlgPolicy>(__first, __last);
 
   using _Comp_ref = typename __comp_ref_type<_Compare>::type;
-  auto __last_iter = std::__partial_sort_impl<_AlgPolicy, _Comp_ref>(__first, __middle, __last, __comp);
+  if (__libcpp_is_constant_evaluated()) {
+    auto __last_iter = std::__partial_sort_impl<_AlgPolicy, _Comp_ref>(__first, __middle, __last, __comp);
+    std::__debug_randomize_range<_AlgPolicy>(__middle, __last);
+    return __last_iter;
+  }
+
+  _RandomAccessIterator __last_iter = _IterOps<_AlgPolicy>::next(__middle, __last);
+  _Comp_ref __comp_ref(__comp);
+  std::__partial_sort_by_heap_or_selection<_AlgPolicy, _Comp_ref>(__first, __middle, __last_iter, __comp_ref);
 
   std::__debug_randomize_range<_AlgPolicy>(__middle, __last);
 
@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_PSTL_BACKEND_H
+#define _LIBCPP___ALGORITHM_PSTL_BACKEND_H
+
+#include <__algorithm/pstl_backends/cpu_backend.h>
+#include <__config>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+/*
+
+  A PSTL backend is a tag type, which is passed as the first argument to the following functions.
+  The execution policy is passed as their first template argument, so that a backend can process
+  the sequenced policy serially.
+
+  template <class _ExecutionPolicy, class _ForwardIterator, class _Function>
+  void __pstl_for_each(_Backend, _ForwardIterator __first, _ForwardIterator __last, _Function __func);
+
+  template <class _ExecutionPolicy, class _ForwardIterator, class _ForwardOutIterator, class _UnaryOperation>
+  _ForwardOutIterator __pstl_transform(_Backend, _ForwardIterator __first, _ForwardIterator __last,
+                                       _ForwardOutIterator __result, _UnaryOperation __op);
+
+  template <class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class _ForwardOutIterator,
+            class _BinaryOperation>
+  _ForwardOutIterator __pstl_transform(_Backend, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
+                                       _ForwardIterator2 __first2, _ForwardOutIterator __result,
+                                       _BinaryOperation __op);
+
+  template <class _ExecutionPolicy, class _ForwardIterator, class _Tp, class _BinaryOperation, class _UnaryOperation>
+  _Tp __pstl_transform_reduce(_Backend, _ForwardIterator __first, _ForwardIterator __last, _Tp __init,
+                              _BinaryOperation __reduce, _UnaryOperation __transform);
+
+  template <class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class _Tp,
+            class _BinaryOperation1, class _BinaryOperation2>
+  _Tp __pstl_transform_reduce(_Backend, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
+                              _ForwardIterator2 __first2, _Tp __init,
+                              _BinaryOperation1 __reduce, _BinaryOperation2 __transform);
+
+  template <class _ExecutionPolicy, class _RandomAccessIterator, class _Compare>
+  void __pstl_sort(_Backend, _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp);
+
+  template <class _ExecutionPolicy, class _RandomAccessIterator, class _Compare>
+  void __pstl_stable_sort(_Backend, _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp);
+
+  template <class _ExecutionPolicy, class _ForwardIterator, class _ForwardOutIterator, class _BinaryOperation,
+            class _Tp>
+  _ForwardOutIterator __pstl_inclusive_scan(_Backend, _ForwardIterator __first, _ForwardIterator __last,
+                                            _ForwardOutIterator __result, _BinaryOperation __op,
+                                            optional<_Tp> __init);
+
+  template <class _ExecutionPolicy, class _ForwardIterator, class _ForwardOutIterator, class _Predicate>
+  _ForwardOutIterator __pstl_copy_if(_Backend, _ForwardIterator __first, _ForwardIterator __last,
+                                     _ForwardOutIterator __result, _Predicate __pred);
+
+  The element access functions must not let exceptions escape: std::terminate is called instead.
+
+*/
+
+#if !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+template <class _ExecutionPolicy>
+struct __select_backend {
+  using type = __cpu_backend_tag;
+};
+
+template <class _ExecutionPolicy>
+using __select_backend_t = typename __select_backend<_ExecutionPolicy>::type;
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+#endif // _LIBCPP___ALGORITHM_PSTL_BACKEND_H
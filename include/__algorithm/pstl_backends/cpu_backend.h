@@ -0,0 +1,49 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKEND_H
+#define _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKEND_H
+
+#include <__config>
+
+/*
+
+  The CPU backend splits the input into contiguous chunks and processes them concurrently on the
+  calling thread and a pool of worker threads living in the experimental library. Every algorithm
+  is built on top of the primitives in cpu_backends/backend.h:
+
+  __chunk_partition __partition_chunks(ptrdiff_t __size);
+
+  template <class _Func>
+  void __parallel_for_each_index(ptrdiff_t __count, _Func& __func);
+
+  template <class _RandomAccessIterator, class _Func>
+  void __parallel_for(_RandomAccessIterator __first, _RandomAccessIterator __last, _Func __func);
+
+  template <class _RandomAccessIterator, class _Tp, class _Reduce, class _ChunkReduce>
+  _Tp __parallel_reduce(_RandomAccessIterator __first, _RandomAccessIterator __last,
+                        _Tp __init, _Reduce __reduce, _ChunkReduce __chunk_reduce);
+
+  Only random access iterators are processed in parallel. Other iterators, non-parallel policies
+  and configurations without threads fall back to the serial algorithms.
+
+*/
+
+#include <__algorithm/pstl_backends/cpu_backends/backend.h>
+#include <__algorithm/pstl_backends/cpu_backends/copy_if.h>
+#include <__algorithm/pstl_backends/cpu_backends/for_each.h>
+#include <__algorithm/pstl_backends/cpu_backends/inclusive_scan.h>
+#include <__algorithm/pstl_backends/cpu_backends/sort.h>
+#include <__algorithm/pstl_backends/cpu_backends/transform.h>
+#include <__algorithm/pstl_backends/cpu_backends/transform_reduce.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+#endif // _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKEND_H
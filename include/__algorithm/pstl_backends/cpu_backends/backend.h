@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_BACKEND_H
+#define _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_BACKEND_H
+
+#include <__algorithm/min.h>
+#include <__config>
+#include <__memory/addressof.h>
+#include <__memory/unique_ptr.h>
+#include <__utility/move.h>
+#include <cstddef>
+#include <optional>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+#if !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+struct __cpu_backend_tag {};
+
+namespace __par_backend {
+
+#  ifndef _LIBCPP_HAS_NO_THREADS
+// The following functions are implemented in the experimental library, on top of a pool of
+// worker threads that is started the first time it is needed.
+
+// Calls __func(__context, __i) for every __i in [0, __count), spreading the calls over the calling
+// thread and the worker threads, and returns once all of them have completed. Calls made from
+// inside a parallel region run on the calling thread.
+_LIBCPP_EXPORTED_FROM_ABI void
+__parallel_apply(size_t __count, void* __context, void (*__func)(void* __context, size_t __index)) _NOEXCEPT;
+
+// Returns the number of threads, including the calling one, that take part in a __parallel_apply.
+_LIBCPP_EXPORTED_FROM_ABI unsigned __max_concurrency() _NOEXCEPT;
+
+// Limits the number of threads taking part in subsequent calls to __parallel_apply, e.g. for
+// benchmarking. Passing 0 restores the default, which is one thread per hardware thread.
+_LIBCPP_EXPORTED_FROM_ABI void __set_max_concurrency(unsigned __n) _NOEXCEPT;
+#  endif // _LIBCPP_HAS_NO_THREADS
+
+// Element access functions that exit via an exception call std::terminate ([algorithms.parallel.exceptions]).
+template <class _Func>
+_LIBCPP_HIDE_FROM_ABI decltype(auto) __terminate_on_exception(_Func&& __func) _NOEXCEPT {
+  return __func();
+}
+
+// Below this number of elements per chunk, the cost of handing the chunk to another thread
+// dominates the cost of processing it.
+inline constexpr ptrdiff_t __min_chunk_size = 2048;
+
+// Splits [0, __size) into __chunk_count_ contiguous chunks whose sizes differ by at most one.
+struct __chunk_partition {
+  ptrdiff_t __size_;
+  ptrdiff_t __chunk_count_;
+
+  _LIBCPP_HIDE_FROM_ABI ptrdiff_t __chunk_begin(ptrdiff_t __chunk) const {
+    ptrdiff_t __chunk_size = __size_ / __chunk_count_;
+    ptrdiff_t __remainder  = __size_ % __chunk_count_;
+    return __chunk * __chunk_size + std::min(__chunk, __remainder);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI ptrdiff_t __chunk_end(ptrdiff_t __chunk) const { return __chunk_begin(__chunk + 1); }
+};
+
+_LIBCPP_HIDE_FROM_ABI inline __chunk_partition __partition_chunks(ptrdiff_t __size) {
+  if (__size == 0)
+    return {0, 0};
+#  ifndef _LIBCPP_HAS_NO_THREADS
+  // Create a few chunks per thread so that the threads which finish early can pick up some of
+  // the remaining work instead of idling.
+  ptrdiff_t __concurrency = __par_backend::__max_concurrency();
+  ptrdiff_t __max_chunks  = __concurrency == 1 ? 1 : 4 * __concurrency;
+#  else
+  ptrdiff_t __max_chunks = 1;
+#  endif
+  ptrdiff_t __chunks = std::min(__max_chunks, __size / __min_chunk_size);
+  return {__size, __chunks == 0 ? 1 : __chunks};
+}
+
+// Calls __func(__i) for every __i in [0, __count), concurrently.
+template <class _Func>
+_LIBCPP_HIDE_FROM_ABI void __parallel_for_each_index(ptrdiff_t __count, _Func& __func) {
+  auto __invoke = [](void* __context, size_t __index) noexcept { (*static_cast<_Func*>(__context))(__index); };
+#  ifndef _LIBCPP_HAS_NO_THREADS
+  if (__count > 1) {
+    __par_backend::__parallel_apply(__count, std::addressof(__func), __invoke);
+    return;
+  }
+#  endif
+  for (ptrdiff_t __i = 0; __i != __count; ++__i)
+    __invoke(std::addressof(__func), __i);
+}
+
+// Calls __func(__chunk_first, __chunk_last) concurrently on chunks that cover [__first, __last).
+template <class _RandomAccessIterator, class _Func>
+_LIBCPP_HIDE_FROM_ABI void __parallel_for(_RandomAccessIterator __first, _RandomAccessIterator __last, _Func __func) {
+  __chunk_partition __partition = __par_backend::__partition_chunks(__last - __first);
+  auto __run_chunk = [&](ptrdiff_t __chunk) {
+    __func(__first + __partition.__chunk_begin(__chunk), __first + __partition.__chunk_end(__chunk));
+  };
+  __par_backend::__parallel_for_each_index(__partition.__chunk_count_, __run_chunk);
+}
+
+// Computes __chunk_reduce(__chunk_first, __chunk_last) concurrently on non-empty chunks that cover
+// [__first, __last), and folds the results into __init with __reduce, in order.
+template <class _RandomAccessIterator, class _Tp, class _Reduce, class _ChunkReduce>
+_LIBCPP_HIDE_FROM_ABI _Tp __parallel_reduce(
+    _RandomAccessIterator __first, _RandomAccessIterator __last, _Tp __init, _Reduce __reduce, _ChunkReduce __chunk_reduce) {
+  __chunk_partition __partition = __par_backend::__partition_chunks(__last - __first);
+  // _Tp doesn't have to be default constructible, so the partial results start out disengaged.
+  unique_ptr<optional<_Tp>[]> __partials(new optional<_Tp>[__partition.__chunk_count_]);
+  auto __run_chunk = [&](ptrdiff_t __chunk) {
+    __partials[__chunk].emplace(
+        __chunk_reduce(__first + __partition.__chunk_begin(__chunk), __first + __partition.__chunk_end(__chunk)));
+  };
+  __par_backend::__parallel_for_each_index(__partition.__chunk_count_, __run_chunk);
+  return __par_backend::__terminate_on_exception([&] {
+    for (ptrdiff_t __chunk = 0; __chunk != __partition.__chunk_count_; ++__chunk)
+      __init = __reduce(std::move(__init), std::move(*__partials[__chunk]));
+    return std::move(__init);
+  });
+}
+
+} // namespace __par_backend
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_BACKEND_H
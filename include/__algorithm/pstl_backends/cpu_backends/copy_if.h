@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_COPY_IF_H
+#define _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_COPY_IF_H
+
+#include <__algorithm/copy_if.h>
+#include <__algorithm/pstl_backends/cpu_backends/backend.h>
+#include <__config>
+#include <__iterator/iterator_traits.h>
+#include <__memory/unique_ptr.h>
+#include <__type_traits/is_execution_policy.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+#if !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+template <class _ExecutionPolicy, class _ForwardIterator, class _ForwardOutIterator, class _Predicate>
+_LIBCPP_HIDE_FROM_ABI _ForwardOutIterator __pstl_copy_if(
+    __cpu_backend_tag,
+    _ForwardIterator __first,
+    _ForwardIterator __last,
+    _ForwardOutIterator __result,
+    _Predicate __pred) {
+  if constexpr (__is_parallel_execution_policy_v<_ExecutionPolicy> &&
+                __is_cpp17_random_access_iterator<_ForwardIterator>::value &&
+                __is_cpp17_random_access_iterator<_ForwardOutIterator>::value) {
+    ptrdiff_t __size                             = __last - __first;
+    __par_backend::__chunk_partition __partition = __par_backend::__partition_chunks(__size);
+    ptrdiff_t __chunks                           = __partition.__chunk_count_;
+
+    // The predicate is only applied once per element: the first pass records its results, so that
+    // the second pass knows which elements to copy once the output position of every chunk is known.
+    unique_ptr<bool[]> __selected(new bool[__size]);
+    unique_ptr<ptrdiff_t[]> __offsets(new ptrdiff_t[__chunks + 1]);
+
+    auto __mark_chunk = [&](ptrdiff_t __chunk) {
+      ptrdiff_t __count = 0;
+      for (ptrdiff_t __i = __partition.__chunk_begin(__chunk); __i != __partition.__chunk_end(__chunk); ++__i)
+        __count += (__selected[__i] = static_cast<bool>(__pred(__first[__i])));
+      __offsets[__chunk + 1] = __count;
+    };
+    __par_backend::__parallel_for_each_index(__chunks, __mark_chunk);
+
+    __offsets[0] = 0;
+    for (ptrdiff_t __chunk = 0; __chunk != __chunks; ++__chunk)
+      __offsets[__chunk + 1] += __offsets[__chunk];
+
+    auto __copy_chunk = [&](ptrdiff_t __chunk) {
+      _ForwardOutIterator __dest = __result + __offsets[__chunk];
+      for (ptrdiff_t __i = __partition.__chunk_begin(__chunk); __i != __partition.__chunk_end(__chunk); ++__i) {
+        if (__selected[__i]) {
+          *__dest = __first[__i];
+          ++__dest;
+        }
+      }
+    };
+    __par_backend::__parallel_for_each_index(__chunks, __copy_chunk);
+    return __result + __offsets[__chunks];
+  } else {
+    return __par_backend::__terminate_on_exception([&] { return std::copy_if(__first, __last, __result, __pred); });
+  }
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+#endif // _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_COPY_IF_H
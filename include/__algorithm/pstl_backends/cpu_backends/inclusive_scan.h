@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_INCLUSIVE_SCAN_H
+#define _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_INCLUSIVE_SCAN_H
+
+#include <__algorithm/pstl_backends/cpu_backends/backend.h>
+#include <__config>
+#include <__iterator/iterator_traits.h>
+#include <__memory/unique_ptr.h>
+#include <__numeric/inclusive_scan.h>
+#include <__type_traits/is_execution_policy.h>
+#include <__utility/move.h>
+#include <optional>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+#if !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// __init is disengaged for the overloads of inclusive_scan that don't take an initial value.
+template <class _ExecutionPolicy, class _ForwardIterator, class _ForwardOutIterator, class _BinaryOperation, class _Tp>
+_LIBCPP_HIDE_FROM_ABI _ForwardOutIterator __pstl_inclusive_scan(
+    __cpu_backend_tag,
+    _ForwardIterator __first,
+    _ForwardIterator __last,
+    _ForwardOutIterator __result,
+    _BinaryOperation __op,
+    optional<_Tp> __init) {
+  if constexpr (__is_parallel_execution_policy_v<_ExecutionPolicy> &&
+                __is_cpp17_random_access_iterator<_ForwardIterator>::value &&
+                __is_cpp17_random_access_iterator<_ForwardOutIterator>::value) {
+    if (__first == __last)
+      return __result;
+
+    __par_backend::__chunk_partition __partition = __par_backend::__partition_chunks(__last - __first);
+    ptrdiff_t __chunks                           = __partition.__chunk_count_;
+    unique_ptr<optional<_Tp>[]> __carry(new optional<_Tp>[__chunks]);
+
+    // First, reduce every chunk but the last one. The operation is associative but not necessarily
+    // commutative, so every chunk is reduced in order. There is more than one chunk only if each of
+    // them holds at least __min_chunk_size elements.
+    auto __reduce_chunk = [&](ptrdiff_t __chunk) {
+      _ForwardIterator __brick_first = __first + __partition.__chunk_begin(__chunk);
+      _ForwardIterator __brick_last  = __first + __partition.__chunk_end(__chunk);
+      _Tp __sum(__op(__brick_first[0], __brick_first[1]));
+      for (__brick_first += 2; __brick_first != __brick_last; ++__brick_first)
+        __sum = __op(std::move(__sum), *__brick_first);
+      __carry[__chunk].emplace(std::move(__sum));
+    };
+    __par_backend::__parallel_for_each_index(__chunks - 1, __reduce_chunk);
+
+    // Then turn the sums into the value carried into every chunk. There are only a few chunks per
+    // thread, so this is cheap enough to do serially.
+    __par_backend::__terminate_on_exception([&] {
+      for (ptrdiff_t __chunk = 0; __chunk != __chunks; ++__chunk) {
+        optional<_Tp> __next;
+        if (__chunk != __chunks - 1)
+          __next.emplace(__init ? __op(*__init, std::move(*__carry[__chunk])) : std::move(*__carry[__chunk]));
+        __carry[__chunk] = std::move(__init);
+        __init           = std::move(__next);
+      }
+    });
+
+    // Finally, scan every chunk starting from the value carried into it.
+    auto __scan_chunk = [&](ptrdiff_t __chunk) {
+      _ForwardIterator __brick_first     = __first + __partition.__chunk_begin(__chunk);
+      _ForwardIterator __brick_last      = __first + __partition.__chunk_end(__chunk);
+      _ForwardOutIterator __brick_result = __result + __partition.__chunk_begin(__chunk);
+      if (__carry[__chunk])
+        std::inclusive_scan(__brick_first, __brick_last, __brick_result, __op, std::move(*__carry[__chunk]));
+      else
+        std::inclusive_scan(__brick_first, __brick_last, __brick_result, __op);
+    };
+    __par_backend::__parallel_for_each_index(__chunks, __scan_chunk);
+    return __result + (__last - __first);
+  } else {
+    return __par_backend::__terminate_on_exception([&] {
+      if (__init)
+        return std::inclusive_scan(__first, __last, __result, __op, std::move(*__init));
+      return std::inclusive_scan(__first, __last, __result, __op);
+    });
+  }
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+#endif // _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_INCLUSIVE_SCAN_H
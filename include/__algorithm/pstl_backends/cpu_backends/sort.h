@@ -0,0 +1,97 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_SORT_H
+#define _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_SORT_H
+
+#include <__algorithm/inplace_merge.h>
+#include <__algorithm/min.h>
+#include <__algorithm/pstl_backends/cpu_backends/backend.h>
+#include <__algorithm/sort.h>
+#include <__algorithm/stable_sort.h>
+#include <__config>
+#include <__type_traits/is_execution_policy.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+#if !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+namespace __par_backend {
+
+// Sorts every chunk of [__first, __last) concurrently with __leaf_sort, then merges neighbouring
+// runs pairwise until a single run is left. std::inplace_merge is stable, so the whole sort is
+// stable as long as __leaf_sort is.
+template <class _RandomAccessIterator, class _Compare, class _LeafSort>
+_LIBCPP_HIDE_FROM_ABI void __parallel_merge_sort(
+    _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare& __comp, _LeafSort __leaf_sort) {
+  __chunk_partition __partition = __par_backend::__partition_chunks(__last - __first);
+  ptrdiff_t __chunks            = __partition.__chunk_count_;
+
+  auto __sort_chunk = [&](ptrdiff_t __chunk) {
+    __leaf_sort(__first + __partition.__chunk_begin(__chunk), __first + __partition.__chunk_end(__chunk), __comp);
+  };
+  __par_backend::__parallel_for_each_index(__chunks, __sort_chunk);
+
+  // Runs are measured in chunks. Every level halves their number, so the last level is a single
+  // merge of the whole range.
+  for (ptrdiff_t __width = 1; __width < __chunks; __width *= 2) {
+    auto __merge_runs = [&](ptrdiff_t __pair) {
+      ptrdiff_t __lo  = 2 * __width * __pair;
+      ptrdiff_t __mid = __lo + __width;
+      ptrdiff_t __hi  = std::min(__mid + __width, __chunks);
+      std::inplace_merge(__first + __partition.__chunk_begin(__lo),
+                         __first + __partition.__chunk_begin(__mid),
+                         __first + __partition.__chunk_begin(__hi),
+                         __comp);
+    };
+    __par_backend::__parallel_for_each_index((__chunks - __width + 2 * __width - 1) / (2 * __width), __merge_runs);
+  }
+}
+
+} // namespace __par_backend
+
+template <class _ExecutionPolicy, class _RandomAccessIterator, class _Compare>
+_LIBCPP_HIDE_FROM_ABI void
+__pstl_sort(__cpu_backend_tag, _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp) {
+  if constexpr (__is_parallel_execution_policy_v<_ExecutionPolicy>) {
+    __par_backend::__parallel_merge_sort(
+        __first, __last, __comp, [](_RandomAccessIterator __brick_first, _RandomAccessIterator __brick_last, _Compare& __c) {
+          std::sort(__brick_first, __brick_last, __c);
+        });
+  } else {
+    __par_backend::__terminate_on_exception([&] { std::sort(__first, __last, __comp); });
+  }
+}
+
+template <class _ExecutionPolicy, class _RandomAccessIterator, class _Compare>
+_LIBCPP_HIDE_FROM_ABI void
+__pstl_stable_sort(__cpu_backend_tag, _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp) {
+  if constexpr (__is_parallel_execution_policy_v<_ExecutionPolicy>) {
+    __par_backend::__parallel_merge_sort(
+        __first, __last, __comp, [](_RandomAccessIterator __brick_first, _RandomAccessIterator __brick_last, _Compare& __c) {
+          std::stable_sort(__brick_first, __brick_last, __c);
+        });
+  } else {
+    __par_backend::__terminate_on_exception([&] { std::stable_sort(__first, __last, __comp); });
+  }
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_SORT_H
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_TRANSFORM_REDUCE_H
+#define _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_TRANSFORM_REDUCE_H
+
+#include <__algorithm/pstl_backends/cpu_backends/backend.h>
+#include <__config>
+#include <__iterator/iterator_traits.h>
+#include <__numeric/transform_reduce.h>
+#include <__type_traits/is_execution_policy.h>
+#include <__utility/move.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+#if !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+template <class _ExecutionPolicy, class _ForwardIterator, class _Tp, class _BinaryOperation, class _UnaryOperation>
+_LIBCPP_HIDE_FROM_ABI _Tp __pstl_transform_reduce(
+    __cpu_backend_tag,
+    _ForwardIterator __first,
+    _ForwardIterator __last,
+    _Tp __init,
+    _BinaryOperation __reduce,
+    _UnaryOperation __transform) {
+  if constexpr (__is_parallel_execution_policy_v<_ExecutionPolicy> &&
+                __is_cpp17_random_access_iterator<_ForwardIterator>::value) {
+    if (__last - __first >= 2) {
+      return __par_backend::__parallel_reduce(
+          __first, __last, std::move(__init), __reduce, [&](_ForwardIterator __brick_first, _ForwardIterator __brick_last) {
+            // Seed every chunk with its first two elements, so that __init is only accounted for once. The
+            // elements themselves don't have to be convertible to _Tp, but the result of __reduce is. The
+            // range is only split into chunks of at least __min_chunk_size elements, so none is shorter.
+            _Tp __brick_init(__reduce(__transform(__brick_first[0]), __transform(__brick_first[1])));
+            return std::transform_reduce(__brick_first + 2, __brick_last, std::move(__brick_init), __reduce, __transform);
+          });
+    }
+  }
+  return __par_backend::__terminate_on_exception(
+      [&] { return std::transform_reduce(__first, __last, std::move(__init), __reduce, __transform); });
+}
+
+template <class _ExecutionPolicy,
+          class _ForwardIterator1,
+          class _ForwardIterator2,
+          class _Tp,
+          class _BinaryOperation1,
+          class _BinaryOperation2>
+_LIBCPP_HIDE_FROM_ABI _Tp __pstl_transform_reduce(
+    __cpu_backend_tag,
+    _ForwardIterator1 __first1,
+    _ForwardIterator1 __last1,
+    _ForwardIterator2 __first2,
+    _Tp __init,
+    _BinaryOperation1 __reduce,
+    _BinaryOperation2 __transform) {
+  if constexpr (__is_parallel_execution_policy_v<_ExecutionPolicy> &&
+                __is_cpp17_random_access_iterator<_ForwardIterator1>::value &&
+                __is_cpp17_random_access_iterator<_ForwardIterator2>::value) {
+    if (__last1 - __first1 >= 2) {
+      return __par_backend::__parallel_reduce(
+          __first1,
+          __last1,
+          std::move(__init),
+          __reduce,
+          [&](_ForwardIterator1 __brick_first, _ForwardIterator1 __brick_last) {
+            _ForwardIterator2 __brick_first2 = __first2 + (__brick_first - __first1);
+            _Tp __brick_init(__reduce(__transform(__brick_first[0], __brick_first2[0]),
+                                      __transform(__brick_first[1], __brick_first2[1])));
+            return std::transform_reduce(
+                __brick_first + 2, __brick_last, __brick_first2 + 2, std::move(__brick_init), __reduce, __transform);
+          });
+    }
+  }
+  return __par_backend::__terminate_on_exception([&] {
+    return std::transform_reduce(__first1, __last1, __first2, std::move(__init), __reduce, __transform);
+  });
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER > 14
+
+#endif // _LIBCPP___ALGORITHM_PSTL_BACKENDS_CPU_BACKENDS_TRANSFORM_REDUCE_H
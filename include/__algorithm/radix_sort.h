@@ -0,0 +1,182 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_RADIX_SORT_H
+#define _LIBCPP___ALGORITHM_RADIX_SORT_H
+
+// Least significant digit radix sort, used by std::sort for large ranges of arithmetic values
+// compared with __less. Every value is mapped to an unsigned key whose ordering matches the
+// ordering of the values, and the keys are then sorted one byte at a time.
+
+#include <__algorithm/comp.h>
+#include <__config>
+#include <__memory/temporary_buffer.h>
+#include <__memory/unique_ptr.h>
+#include <__type_traits/conditional.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_floating_point.h>
+#include <__type_traits/is_integral.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/make_unsigned.h>
+#include <__utility/pair.h>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+template <class _Tp, class = void>
+struct __radix_sort_traits {
+  static const bool __sortable = false;
+};
+
+// Integers are ordered like their unsigned representation once the sign bit is flipped. Integers
+// wider than 64 bits are left to the comparison sort, and so are capabilities, whose tags can't be
+// carried through an integer key.
+template <class _Tp>
+struct __radix_sort_traits<
+    _Tp,
+    __enable_if_t<is_integral<_Tp>::value && !is_same<_Tp, bool>::value && sizeof(_Tp) <= sizeof(uint64_t)> > {
+  static const bool __sortable = true;
+  typedef typename make_unsigned<_Tp>::type __key_type;
+
+  _LIBCPP_HIDE_FROM_ABI static __key_type __key(_Tp __value) {
+    const __key_type __flip = numeric_limits<_Tp>::is_signed ? __key_type(1) << (sizeof(_Tp) * CHAR_BIT - 1) : 0;
+    return static_cast<__key_type>(__value) ^ __flip;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static _Tp __value(__key_type __key) {
+    const __key_type __flip = numeric_limits<_Tp>::is_signed ? __key_type(1) << (sizeof(_Tp) * CHAR_BIT - 1) : 0;
+    return static_cast<_Tp>(static_cast<__key_type>(__key ^ __flip));
+  }
+};
+
+// IEEE floating point values are ordered like their representation once the sign bit is set for
+// positive values and all the bits are flipped for negative values. This is a total order, which
+// agrees with operator< on everything except NaNs, for which __less is not a strict weak order
+// anyway, and zeros of different signs, which are equivalent.
+template <class _Tp>
+struct __radix_sort_traits<
+    _Tp,
+    __enable_if_t<is_floating_point<_Tp>::value && numeric_limits<_Tp>::is_iec559 &&
+                  (sizeof(_Tp) == sizeof(uint32_t) || sizeof(_Tp) == sizeof(uint64_t))> > {
+  static const bool __sortable = true;
+  typedef __conditional_t<sizeof(_Tp) == sizeof(uint32_t), uint32_t, uint64_t> __key_type;
+
+  _LIBCPP_HIDE_FROM_ABI static __key_type __key(_Tp __value) {
+    const __key_type __sign = __key_type(1) << (sizeof(_Tp) * CHAR_BIT - 1);
+    __key_type __bits;
+    std::memcpy(&__bits, &__value, sizeof(_Tp));
+    return (__bits & __sign) ? ~__bits : __bits | __sign;
+  }
+};
+
+// Below these sizes, introsort is faster than going over the whole range once per byte.
+template <class _Tp>
+struct __radix_sort_threshold
+    : integral_constant<ptrdiff_t, sizeof(_Tp) == 1 ? 256 : sizeof(_Tp) == 2 ? 512 : sizeof(_Tp) == 4 ? 1024 : 2048> {};
+
+// Values that are a single byte wide are sorted by counting them, without any buffer.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI void __counting_sort(_Tp* __first, _Tp* __last) {
+  typedef __radix_sort_traits<_Tp> _Traits;
+  size_t __counts[1 << CHAR_BIT] = {};
+  for (_Tp* __i = __first; __i != __last; ++__i)
+    ++__counts[_Traits::__key(*__i)];
+  for (size_t __key = 0; __key != (1 << CHAR_BIT); ++__key) {
+    _Tp __value = _Traits::__value(static_cast<typename _Traits::__key_type>(__key));
+    for (size_t __n = __counts[__key]; __n != 0; --__n)
+      *__first++ = __value;
+  }
+}
+
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI void __radix_sort(_Tp* __first, _Tp* __last, _Tp* __buffer) {
+  typedef __radix_sort_traits<_Tp> _Traits;
+  typedef typename _Traits::__key_type __key_type;
+  const size_t __radix  = 1 << CHAR_BIT;
+  const size_t __passes = sizeof(__key_type);
+  const size_t __len    = static_cast<size_t>(__last - __first);
+
+  // Build the histograms of all the digits in a single pass over the input.
+  size_t __counts[__passes][__radix] = {};
+  for (_Tp* __i = __first; __i != __last; ++__i) {
+    __key_type __key = _Traits::__key(*__i);
+    for (size_t __pass = 0; __pass != __passes; ++__pass)
+      ++__counts[__pass][(__key >> (__pass * CHAR_BIT)) & (__radix - 1)];
+  }
+
+  _Tp* __src = __first;
+  _Tp* __dst = __buffer;
+  for (size_t __pass = 0; __pass != __passes; ++__pass) {
+    const size_t __shift = __pass * CHAR_BIT;
+    size_t* __offsets    = __counts[__pass];
+    // A digit that is the same in every value doesn't reorder anything.
+    if (__offsets[(_Traits::__key(*__src) >> __shift) & (__radix - 1)] == __len)
+      continue;
+
+    size_t __sum = 0;
+    for (size_t __digit = 0; __digit != __radix; ++__digit) {
+      size_t __count     = __offsets[__digit];
+      __offsets[__digit] = __sum;
+      __sum += __count;
+    }
+    for (_Tp* __i = __src; __i != __src + __len; ++__i)
+      __dst[__offsets[(_Traits::__key(*__i) >> __shift) & (__radix - 1)]++] = *__i;
+
+    _Tp* __tmp = __src;
+    __src      = __dst;
+    __dst      = __tmp;
+  }
+
+  if (__src != __first)
+    std::memcpy(__first, __src, __len * sizeof(_Tp));
+}
+
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI bool __radix_sort_dispatch(_Tp* __first, _Tp* __last, true_type /* single byte */) {
+  std::__counting_sort(__first, __last);
+  return true;
+}
+
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI bool __radix_sort_dispatch(_Tp* __first, _Tp* __last, false_type /* single byte */) {
+  // Fall back to the comparison sort if there isn't enough memory for the buffer.
+  ptrdiff_t __len = __last - __first;
+  pair<_Tp*, ptrdiff_t> __buf = std::__get_temporary_buffer<_Tp>(__len);
+  unique_ptr<_Tp, __return_temporary_buffer> __h(__buf.first);
+  if (__buf.second < __len)
+    return false;
+  std::__radix_sort(__first, __last, __buf.first);
+  return true;
+}
+
+// Sorts [__first, __last) and returns true if a radix sort is worth it for this range, otherwise
+// returns false and leaves the range untouched.
+template <class _Comp, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI bool __radix_sort_if_profitable(_RandomAccessIterator, _RandomAccessIterator, _Comp&) {
+  return false;
+}
+
+template <class _Tp, __enable_if_t<__radix_sort_traits<_Tp>::__sortable, int> = 0>
+_LIBCPP_HIDE_FROM_ABI bool __radix_sort_if_profitable(_Tp* __first, _Tp* __last, __less<_Tp>&) {
+  if (__last - __first < __radix_sort_threshold<_Tp>::value)
+    return false;
+  return std::__radix_sort_dispatch(__first, __last, integral_constant<bool, sizeof(_Tp) == 1>());
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP___ALGORITHM_RADIX_SORT_H
@@ -11,6 +11,8 @@
 
 #include <__algorithm/copy.h>
 #include <__algorithm/in_out_result.h>
+#include <__bit_reference>
+#include <__concepts/same_as.h>
 #include <__config>
 #include <__functional/identity.h>
 #include <__iterator/concepts.h>
@@ -35,20 +37,32 @@ using copy_result = in_out_result<_InIter, _OutIter>;
 namespace __copy {
 struct __fn {
 
+  template <class _InIter, class _Sent, class _OutIter>
+  _LIBCPP_HIDE_FROM_ABI constexpr static
+  copy_result<_InIter, _OutIter> __copy_impl(_InIter __first, _Sent __last, _OutIter __result) {
+    if constexpr (__is_bit_iterator<_InIter>::value && __is_bit_iterator<_OutIter>::value && same_as<_InIter, _Sent>) {
+      // The bits of vector<bool> are copied a word at a time.
+      __result = std::copy(__first, __last, std::move(__result));
+      return {std::move(__last), std::move(__result)};
+    } else {
+      auto __ret = std::__copy(std::move(__first), std::move(__last), std::move(__result));
+      return {std::move(__ret.first), std::move(__ret.second)};
+    }
+  }
+
   template <input_iterator _InIter, sentinel_for<_InIter> _Sent, weakly_incrementable _OutIter>
     requires indirectly_copyable<_InIter, _OutIter>
   _LIBCPP_HIDE_FROM_ABI constexpr
   copy_result<_InIter, _OutIter> operator()(_InIter __first, _Sent __last, _OutIter __result) const {
-    auto __ret = std::__copy(std::move(__first), std::move(__last), std::move(__result));
-    return {std::move(__ret.first), std::move(__ret.second)};
+    return __copy_impl(std::move(__first), std::move(__last), std::move(__result));
   }
 
   template <input_range _Range, weakly_incrementable _OutIter>
     requires indirectly_copyable<iterator_t<_Range>, _OutIter>
   _LIBCPP_HIDE_FROM_ABI constexpr
   copy_result<borrowed_iterator_t<_Range>, _OutIter> operator()(_Range&& __r, _OutIter __result) const {
-    auto __ret = std::__copy(ranges::begin(__r), ranges::end(__r), std::move(__result));
-    return {std::move(__ret.first), std::move(__ret.second)};
+    auto __ret = __copy_impl(ranges::begin(__r), ranges::end(__r), std::move(__result));
+    return {std::move(__ret.in), std::move(__ret.out)};
   }
 };
 } // namespace __copy
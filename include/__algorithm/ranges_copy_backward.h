@@ -12,6 +12,8 @@
 #include <__algorithm/copy_backward.h>
 #include <__algorithm/in_out_result.h>
 #include <__algorithm/iterator_operations.h>
+#include <__bit_reference>
+#include <__concepts/same_as.h>
 #include <__config>
 #include <__iterator/concepts.h>
 #include <__iterator/reverse_iterator.h>
@@ -36,20 +38,33 @@ using copy_backward_result = in_out_result<_Ip, _Op>;
 namespace __copy_backward {
 struct __fn {
 
+  template <class _InIter1, class _Sent1, class _InIter2>
+  _LIBCPP_HIDE_FROM_ABI constexpr static
+  copy_backward_result<_InIter1, _InIter2> __copy_backward_impl(_InIter1 __first, _Sent1 __last, _InIter2 __result) {
+    if constexpr (__is_bit_iterator<_InIter1>::value && __is_bit_iterator<_InIter2>::value &&
+                  same_as<_InIter1, _Sent1>) {
+      // The bits of vector<bool> are copied a word at a time.
+      __result = std::copy_backward(__first, __last, std::move(__result));
+      return {std::move(__last), std::move(__result)};
+    } else {
+      auto __ret = std::__copy_backward<_RangeAlgPolicy>(std::move(__first), std::move(__last), std::move(__result));
+      return {std::move(__ret.first), std::move(__ret.second)};
+    }
+  }
+
   template <bidirectional_iterator _InIter1, sentinel_for<_InIter1> _Sent1, bidirectional_iterator _InIter2>
     requires indirectly_copyable<_InIter1, _InIter2>
   _LIBCPP_HIDE_FROM_ABI constexpr
   copy_backward_result<_InIter1, _InIter2> operator()(_InIter1 __first, _Sent1 __last, _InIter2 __result) const {
-    auto __ret = std::__copy_backward<_RangeAlgPolicy>(std::move(__first), std::move(__last), std::move(__result));
-    return {std::move(__ret.first), std::move(__ret.second)};
+    return __copy_backward_impl(std::move(__first), std::move(__last), std::move(__result));
   }
 
   template <bidirectional_range _Range, bidirectional_iterator _Iter>
     requires indirectly_copyable<iterator_t<_Range>, _Iter>
   _LIBCPP_HIDE_FROM_ABI constexpr
   copy_backward_result<borrowed_iterator_t<_Range>, _Iter> operator()(_Range&& __r, _Iter __result) const {
-    auto __ret = std::__copy_backward<_RangeAlgPolicy>(ranges::begin(__r), ranges::end(__r), std::move(__result));
-    return {std::move(__ret.first), std::move(__ret.second)};
+    auto __ret = __copy_backward_impl(ranges::begin(__r), ranges::end(__r), std::move(__result));
+    return {std::move(__ret.in), std::move(__ret.out)};
   }
 };
 } // namespace __copy_backward
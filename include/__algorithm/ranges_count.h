@@ -10,6 +10,8 @@
 #define _LIBCPP___ALGORITHM_RANGES_COUNT_H
 
 #include <__algorithm/ranges_count_if.h>
+#include <__bit_reference>
+#include <__concepts/same_as.h>
 #include <__config>
 #include <__functional/identity.h>
 #include <__functional/ranges_operations.h>
@@ -19,6 +21,7 @@
 #include <__iterator/projected.h>
 #include <__ranges/access.h>
 #include <__ranges/concepts.h>
+#include <__type_traits/is_arithmetic.h>
 #include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -32,20 +35,31 @@ _LIBCPP_BEGIN_NAMESPACE_STD
 namespace ranges {
 namespace __count {
 struct __fn {
+  template <class _Iter, class _Sent, class _Type, class _Proj>
+  _LIBCPP_HIDE_FROM_ABI constexpr static
+  iter_difference_t<_Iter> __count_impl(_Iter __first, _Sent __last, const _Type& __value, _Proj& __proj) {
+    if constexpr (__is_bit_iterator<_Iter>::value && same_as<_Iter, _Sent> && same_as<_Proj, identity> &&
+                  is_arithmetic_v<_Type>) {
+      // The bits of vector<bool> are counted a word at a time.
+      return std::__count_bool_equal_to(__first, __last, __value);
+    } else {
+      auto __pred = [&](auto&& __e) { return __e == __value; };
+      return ranges::__count_if_impl(std::move(__first), std::move(__last), __pred, __proj);
+    }
+  }
+
   template <input_iterator _Iter, sentinel_for<_Iter> _Sent, class _Type, class _Proj = identity>
     requires indirect_binary_predicate<ranges::equal_to, projected<_Iter, _Proj>, const _Type*>
   _LIBCPP_HIDE_FROM_ABI constexpr
   iter_difference_t<_Iter> operator()(_Iter __first, _Sent __last, const _Type& __value, _Proj __proj = {}) const {
-    auto __pred = [&](auto&& __e) { return __e == __value; };
-    return ranges::__count_if_impl(std::move(__first), std::move(__last), __pred, __proj);
+    return __count_impl(std::move(__first), std::move(__last), __value, __proj);
   }
 
   template <input_range _Range, class _Type, class _Proj = identity>
     requires indirect_binary_predicate<ranges::equal_to, projected<iterator_t<_Range>, _Proj>, const _Type*>
   _LIBCPP_HIDE_FROM_ABI constexpr
   range_difference_t<_Range> operator()(_Range&& __r, const _Type& __value, _Proj __proj = {}) const {
-    auto __pred = [&](auto&& __e) { return __e == __value; };
-    return ranges::__count_if_impl(ranges::begin(__r), ranges::end(__r), __pred, __proj);
+    return __count_impl(ranges::begin(__r), ranges::end(__r), __value, __proj);
   }
 };
 } // namespace __count
@@ -9,6 +9,8 @@
 #ifndef _LIBCPP___ALGORITHM_RANGES_EQUAL_H
 #define _LIBCPP___ALGORITHM_RANGES_EQUAL_H
 
+#include <__bit_reference>
+#include <__concepts/same_as.h>
 #include <__config>
 #include <__functional/identity.h>
 #include <__functional/invoke.h>
@@ -43,6 +45,12 @@ private:
                     _Pred& __pred,
                     _Proj1& __proj1,
                     _Proj2& __proj2) {
+    if constexpr (__is_bit_iterator<_Iter1>::value && same_as<_Iter1, _Sent1> &&
+                  same_as<_Iter2, _Iter1> && same_as<_Sent2, _Iter1> &&
+                  same_as<_Pred, ranges::equal_to> && same_as<_Proj1, identity> && same_as<_Proj2, identity>) {
+      // The bits of vector<bool> are compared a word at a time.
+      return __last1 - __first1 == __last2 - __first2 && std::equal(__first1, __last1, __first2);
+    }
     while (__first1 != __last1 && __first2 != __last2) {
       if (!std::invoke(__pred, std::invoke(__proj1, *__first1), std::invoke(__proj2, *__first2)))
         return false;
@@ -9,6 +9,7 @@
 #ifndef _LIBCPP___ALGORITHM_RANGES_FILL_N_H
 #define _LIBCPP___ALGORITHM_RANGES_FILL_N_H
 
+#include <__bit_reference>
 #include <__config>
 #include <__iterator/concepts.h>
 #include <__iterator/incrementable_traits.h>
@@ -27,11 +28,19 @@ struct __fn {
   template <class _Type, output_iterator<const _Type&> _Iter>
   _LIBCPP_HIDE_FROM_ABI constexpr
   _Iter operator()(_Iter __first, iter_difference_t<_Iter> __n, const _Type& __value) const {
-    for (; __n != 0; --__n) {
-      *__first = __value;
-      ++__first;
+    if constexpr (__is_bit_iterator<_Iter>::value) {
+      // The bits of vector<bool> are filled a word at a time.
+      if (__n <= 0)
+        return __first;
+      std::fill_n(__first, __n, __value);
+      return __first + __n;
+    } else {
+      for (; __n != 0; --__n) {
+        *__first = __value;
+        ++__first;
+      }
+      return __first;
     }
-    return __first;
   }
 };
 } // namespace __fill_n
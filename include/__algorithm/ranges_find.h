@@ -10,6 +10,8 @@
 #define _LIBCPP___ALGORITHM_RANGES_FIND_H
 
 #include <__algorithm/ranges_find_if.h>
+#include <__bit_reference>
+#include <__concepts/same_as.h>
 #include <__config>
 #include <__functional/identity.h>
 #include <__functional/invoke.h>
@@ -19,6 +21,7 @@
 #include <__ranges/access.h>
 #include <__ranges/concepts.h>
 #include <__ranges/dangling.h>
+#include <__type_traits/is_arithmetic.h>
 #include <__utility/forward.h>
 #include <__utility/move.h>
 
@@ -33,20 +36,31 @@ _LIBCPP_BEGIN_NAMESPACE_STD
 namespace ranges {
 namespace __find {
 struct __fn {
+  template <class _Ip, class _Sp, class _Tp, class _Proj>
+  _LIBCPP_HIDE_FROM_ABI constexpr static
+  _Ip __find_impl(_Ip __first, _Sp __last, const _Tp& __value, _Proj& __proj) {
+    if constexpr (__is_bit_iterator<_Ip>::value && same_as<_Ip, _Sp> && same_as<_Proj, identity> &&
+                  is_arithmetic_v<_Tp>) {
+      // The bits of vector<bool> are searched a word at a time.
+      return std::__find_bool_equal_to(__first, __last, __value);
+    } else {
+      auto __pred = [&](auto&& __e) { return std::forward<decltype(__e)>(__e) == __value; };
+      return ranges::__find_if_impl(std::move(__first), std::move(__last), __pred, __proj);
+    }
+  }
+
   template <input_iterator _Ip, sentinel_for<_Ip> _Sp, class _Tp, class _Proj = identity>
     requires indirect_binary_predicate<ranges::equal_to, projected<_Ip, _Proj>, const _Tp*>
   _LIBCPP_HIDE_FROM_ABI constexpr
   _Ip operator()(_Ip __first, _Sp __last, const _Tp& __value, _Proj __proj = {}) const {
-    auto __pred = [&](auto&& __e) { return std::forward<decltype(__e)>(__e) == __value; };
-    return ranges::__find_if_impl(std::move(__first), std::move(__last), __pred, __proj);
+    return __find_impl(std::move(__first), std::move(__last), __value, __proj);
   }
 
   template <input_range _Rp, class _Tp, class _Proj = identity>
     requires indirect_binary_predicate<ranges::equal_to, projected<iterator_t<_Rp>, _Proj>, const _Tp*>
   _LIBCPP_HIDE_FROM_ABI constexpr
   borrowed_iterator_t<_Rp> operator()(_Rp&& __r, const _Tp& __value, _Proj __proj = {}) const {
-    auto __pred = [&](auto&& __e) { return std::forward<decltype(__e)>(__e) == __value; };
-    return ranges::__find_if_impl(ranges::begin(__r), ranges::end(__r), __pred, __proj);
+    return __find_impl(ranges::begin(__r), ranges::end(__r), __value, __proj);
   }
 };
 } // namespace __find
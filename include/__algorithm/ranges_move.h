@@ -11,6 +11,8 @@
 
 #include <__algorithm/in_out_result.h>
 #include <__algorithm/move.h>
+#include <__bit_reference>
+#include <__concepts/same_as.h>
 #include <__config>
 #include <__iterator/concepts.h>
 #include <__iterator/iter_move.h>
@@ -46,12 +48,18 @@ struct __fn {
   template <class _InIter, class _Sent, class _OutIter>
   _LIBCPP_HIDE_FROM_ABI constexpr static
   move_result<_InIter, _OutIter> __move_impl(_InIter __first, _Sent __last, _OutIter __result) {
-    while (__first != __last) {
-      *__result = ranges::iter_move(__first);
-      ++__first;
-      ++__result;
+    if constexpr (__is_bit_iterator<_InIter>::value && __is_bit_iterator<_OutIter>::value && same_as<_InIter, _Sent>) {
+      // The bits of vector<bool> are moved a word at a time.
+      __result = std::move(__first, __last, std::move(__result));
+      return {std::move(__last), std::move(__result)};
+    } else {
+      while (__first != __last) {
+        *__result = ranges::iter_move(__first);
+        ++__first;
+        ++__result;
+      }
+      return {std::move(__first), std::move(__result)};
     }
-    return {std::move(__first), std::move(__result)};
   }
 
   template <input_iterator _InIter, sentinel_for<_InIter> _Sent, weakly_incrementable _OutIter>
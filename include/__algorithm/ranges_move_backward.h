@@ -11,6 +11,8 @@
 
 #include <__algorithm/in_out_result.h>
 #include <__algorithm/ranges_move.h>
+#include <__bit_reference>
+#include <__concepts/same_as.h>
 #include <__config>
 #include <__iterator/concepts.h>
 #include <__iterator/iter_move.h>
@@ -40,10 +42,16 @@ struct __fn {
   template <class _InIter, class _Sent, class _OutIter>
   _LIBCPP_HIDE_FROM_ABI constexpr static
   move_backward_result<_InIter, _OutIter> __move_backward_impl(_InIter __first, _Sent __last, _OutIter __result) {
-    auto __ret = ranges::move(std::make_reverse_iterator(ranges::next(__first, __last)),
-                              std::make_reverse_iterator(__first),
-                              std::make_reverse_iterator(__result));
-    return {std::move(__ret.in.base()), std::move(__ret.out.base())};
+    if constexpr (__is_bit_iterator<_InIter>::value && __is_bit_iterator<_OutIter>::value && same_as<_InIter, _Sent>) {
+      // The bits of vector<bool> are moved a word at a time.
+      __result = std::move_backward(__first, __last, std::move(__result));
+      return {std::move(__last), std::move(__result)};
+    } else {
+      auto __ret = ranges::move(std::make_reverse_iterator(ranges::next(__first, __last)),
+                                std::make_reverse_iterator(__first),
+                                std::make_reverse_iterator(__result));
+      return {std::move(__ret.in.base()), std::move(__ret.out.base())};
+    }
   }
 
   template <bidirectional_iterator _InIter, sentinel_for<_InIter> _Sent, bidirectional_iterator _OutIter>
@@ -10,6 +10,9 @@
 #define _LIBCPP___ALGORITHM_RANGES_SWAP_RANGES_H
 
 #include <__algorithm/in_in_result.h>
+#include <__algorithm/min.h>
+#include <__bit_reference>
+#include <__concepts/same_as.h>
 #include <__config>
 #include <__iterator/concepts.h>
 #include <__iterator/iter_swap.h>
@@ -22,6 +25,9 @@
 #  pragma GCC system_header
 #endif
 
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
 #if _LIBCPP_STD_VER > 17 && !defined(_LIBCPP_HAS_NO_INCOMPLETE_RANGES)
 
 _LIBCPP_BEGIN_NAMESPACE_STD
@@ -38,6 +44,13 @@ struct __fn {
     requires indirectly_swappable<_I1, _I2>
   _LIBCPP_HIDE_FROM_ABI constexpr swap_ranges_result<_I1, _I2>
   operator()(_I1 __first1, _S1 __last1, _I2 __first2, _S2 __last2) const {
+    if constexpr (__is_bit_iterator<_I1>::value && __is_bit_iterator<_I2>::value &&
+                  same_as<_I1, _S1> && same_as<_I2, _S2>) {
+      // The bits of vector<bool> are swapped a word at a time.
+      __last1 = __first1 + std::min(__last1 - __first1, __last2 - __first2);
+      __first2 = std::swap_ranges(__first1, __last1, std::move(__first2));
+      return {_VSTD::move(__last1), _VSTD::move(__first2)};
+    }
     while (__first1 != __last1 && __first2 != __last2) {
       ranges::iter_swap(__first1, __first2);
       ++__first1;
@@ -66,4 +79,6 @@ _LIBCPP_END_NAMESPACE_STD
 
 #endif // _LIBCPP_STD_VER > 17 && !defined(_LIBCPP_HAS_NO_INCOMPLETE_RANGES)
 
+_LIBCPP_POP_MACROS
+
 #endif // _LIBCPP___ALGORITHM_RANGES_SWAP_RANGES_H
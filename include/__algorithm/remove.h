@@ -11,7 +11,12 @@
 
 #include <__algorithm/find.h>
 #include <__algorithm/find_if.h>
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_constant_evaluated.h>
 #include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -21,8 +26,8 @@
 _LIBCPP_BEGIN_NAMESPACE_STD
 
 template <class _ForwardIterator, class _Tp>
-_LIBCPP_NODISCARD_EXT _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator
-remove(_ForwardIterator __first, _ForwardIterator __last, const _Tp& __value)
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator
+__remove(_ForwardIterator __first, _ForwardIterator __last, const _Tp& __value)
 {
     __first = _VSTD::find(__first, __last, __value);
     if (__first != __last)
@@ -40,6 +45,60 @@ remove(_ForwardIterator __first, _ForwardIterator __last, const _Tp& __value)
     return __first;
 }
 
+// Removes the elements after __first, the first element removed, without branching on them.
+template <class _ValueT, class _Tp>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _ValueT*
+__remove_after(_ValueT* __first, _ValueT* __last, const _Tp& __value, false_type /* vectorize */)
+{
+    for (_ValueT* __i = __first + 1; __i != __last; ++__i)
+    {
+        bool __keep = !(*__i == __value);
+        *__first = _VSTD::move(*__i);
+        __first += __keep;
+    }
+    return __first;
+}
+
+#ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+template <class _ValueT, class _Tp>
+struct __can_remove_vectorized
+    : integral_constant<bool, __can_find_bitwise<_ValueT, _Tp>::value && __has_simd_equality<_ValueT>::value> {};
+
+template <class _ValueT, class _Tp>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _ValueT*
+__remove_after(_ValueT* __first, _ValueT* __last, const _Tp& __value, true_type /* vectorize */)
+{
+    if (__libcpp_is_constant_evaluated())
+        return _VSTD::__remove_after(__first, __last, __value, false_type());
+    // *__first is equal to __value, so it is __value converted to _ValueT.
+    const _ValueT __removed = *__first;
+    return _VSTD::__simd_remove(__first, __first + 1, __last, __removed);
+}
+#else
+template <class _ValueT, class _Tp>
+struct __can_remove_vectorized : false_type {};
+#endif
+
+// Contiguous ranges of small trivially copyable elements are compacted by moving every element after
+// the first one removed, and only advancing the destination past the ones that are kept.
+template <class _ValueT, class _Tp, __enable_if_t<__can_compact_without_branches<_ValueT>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _ValueT*
+__remove(_ValueT* __first, _ValueT* __last, const _Tp& __value)
+{
+    __first = _VSTD::find(__first, __last, __value);
+    if (__first == __last)
+        return __first;
+    return _VSTD::__remove_after(__first, __last, __value, __can_remove_vectorized<_ValueT, _Tp>());
+}
+
+template <class _ForwardIterator, class _Tp>
+_LIBCPP_NODISCARD_EXT _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator
+remove(_ForwardIterator __first, _ForwardIterator __last, const _Tp& __value)
+{
+    return _VSTD::__rewrap_iter(
+        __first, _VSTD::__remove(_VSTD::__unwrap_iter(__first), _VSTD::__unwrap_iter(__last), __value));
+}
+
 _LIBCPP_END_NAMESPACE_STD
 
 #endif // _LIBCPP___ALGORITHM_REMOVE_H
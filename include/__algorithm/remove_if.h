@@ -9,8 +9,12 @@
 #ifndef _LIBCPP___ALGORITHM_REMOVE_IF_H
 #define _LIBCPP___ALGORITHM_REMOVE_IF_H
 
+#include <__algorithm/copy_if.h>
 #include <__algorithm/find_if.h>
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
+#include <__type_traits/enable_if.h>
 #include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -20,8 +24,8 @@
 _LIBCPP_BEGIN_NAMESPACE_STD
 
 template <class _ForwardIterator, class _Predicate>
-_LIBCPP_NODISCARD_EXT _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator
-remove_if(_ForwardIterator __first, _ForwardIterator __last, _Predicate __pred)
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator
+__remove_if(_ForwardIterator __first, _ForwardIterator __last, _Predicate& __pred)
 {
     __first = _VSTD::find_if<_ForwardIterator, _Predicate&>(__first, __last, __pred);
     if (__first != __last)
@@ -39,6 +43,35 @@ remove_if(_ForwardIterator __first, _ForwardIterator __last, _Predicate __pred)
     return __first;
 }
 
+// Contiguous ranges of small trivially copyable elements are compacted without branching on the elements
+// after the first one removed, a block at a time like copy_if, and then by moving every remaining element
+// and only advancing the destination past the ones that are kept.
+template <class _Tp, class _Predicate, __enable_if_t<__can_compact_by_blocks<_Tp>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp*
+__remove_if(_Tp* __first, _Tp* __last, _Predicate& __pred)
+{
+    __first = _VSTD::find_if<_Tp*, _Predicate&>(__first, __last, __pred);
+    if (__first == __last)
+        return __first;
+    _Tp* __i = __first + 1;
+    __first = _VSTD::__copy_if_by_blocks<false, true>(__i, __last, __first, __pred);
+    for (; __i != __last; ++__i)
+    {
+        bool __keep = !__pred(*__i);
+        *__first = _VSTD::move(*__i);
+        __first += __keep;
+    }
+    return __first;
+}
+
+template <class _ForwardIterator, class _Predicate>
+_LIBCPP_NODISCARD_EXT _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator
+remove_if(_ForwardIterator __first, _ForwardIterator __last, _Predicate __pred)
+{
+    return _VSTD::__rewrap_iter(
+        __first, _VSTD::__remove_if(_VSTD::__unwrap_iter(__first), _VSTD::__unwrap_iter(__last), __pred));
+}
+
 _LIBCPP_END_NAMESPACE_STD
 
 #endif // _LIBCPP___ALGORITHM_REMOVE_IF_H
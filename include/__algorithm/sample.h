@@ -14,7 +14,9 @@
 #include <__config>
 #include <__iterator/distance.h>
 #include <__iterator/iterator_traits.h>
+#include <__random/batched_uniform_int.h>
 #include <__random/uniform_int_distribution.h>
+#include <cstdint>
 #include <type_traits>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -26,6 +28,39 @@ _LIBCPP_PUSH_MACROS
 
 _LIBCPP_BEGIN_NAMESPACE_STD
 
+// Draws the uniform integers in [0, 1], [0, 2], ... of reservoir sampling, or the ones in [0, __size - 1],
+// [0, __size - 2], ... of selection sampling, from _UniformRandomNumberGenerator. Generators whose words are
+// all random bits give several of them per 64-bit word.
+template <class _UniformRandomNumberGenerator, class _Distance, bool _Ascending,
+          bool = __is_full_word_urng<_UniformRandomNumberGenerator>::value>
+class __sample_indices {
+  _UniformRandomNumberGenerator& __g_;
+  _Distance __bound_;
+
+public:
+  _LIBCPP_HIDE_FROM_ABI __sample_indices(_UniformRandomNumberGenerator& __g, _Distance __first_bound)
+      : __g_(__g), __bound_(__first_bound) {}
+
+  _LIBCPP_HIDE_FROM_ABI _Distance operator()() {
+    _Distance __r = uniform_int_distribution<_Distance>(0, __bound_ - 1)(__g_);
+    __bound_ = _Ascending ? __bound_ + 1 : __bound_ - 1;
+    return __r;
+  }
+};
+
+#if !defined(_LIBCPP_CXX03_LANG) && !defined(_LIBCPP_HAS_NO_INT128)
+template <class _UniformRandomNumberGenerator, class _Distance, bool _Ascending>
+class __sample_indices<_UniformRandomNumberGenerator, _Distance, _Ascending, true> {
+  __batched_uniform_int<_UniformRandomNumberGenerator, _Ascending> __uid_;
+
+public:
+  _LIBCPP_HIDE_FROM_ABI __sample_indices(_UniformRandomNumberGenerator& __g, _Distance __first_bound)
+      : __uid_(__g, static_cast<uint64_t>(__first_bound)) {}
+
+  _LIBCPP_HIDE_FROM_ABI _Distance operator()() { return static_cast<_Distance>(__uid_()); }
+};
+#endif
+
 template <class _PopulationIterator, class _SampleIterator, class _Distance,
           class _UniformRandomNumberGenerator>
 _LIBCPP_INLINE_VISIBILITY
@@ -39,8 +74,9 @@ _SampleIterator __sample(_PopulationIterator __first,
   for (; __first != __last && __k < __n; ++__first, (void) ++__k)
     __output_iter[__k] = *__first;
   _Distance __sz = __k;
+  __sample_indices<_UniformRandomNumberGenerator, _Distance, true> __uid(__g, __k + 1);
   for (; __first != __last; ++__first, (void) ++__k) {
-    _Distance __r = uniform_int_distribution<_Distance>(0, __k)(__g);
+    _Distance __r = __uid();
     if (__r < __sz)
       __output_iter[__r] = *__first;
   }
@@ -56,8 +92,9 @@ _SampleIterator __sample(_PopulationIterator __first,
                          _UniformRandomNumberGenerator& __g,
                          forward_iterator_tag) {
   _Distance __unsampled_sz = _VSTD::distance(__first, __last);
+  __sample_indices<_UniformRandomNumberGenerator, _Distance, false> __uid(__g, __unsampled_sz);
   for (__n = _VSTD::min(__n, __unsampled_sz); __n != 0; ++__first) {
-    _Distance __r = uniform_int_distribution<_Distance>(0, --__unsampled_sz)(__g);
+    _Distance __r = __uid();
     if (__r < __n) {
       *__output_iter++ = *__first;
       --__n;
@@ -12,6 +12,9 @@
 
 #include <__algorithm/comp.h>
 #include <__algorithm/iterator_operations.h>
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/two_way_search.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__functional/identity.h>
 #include <__iterator/advance.h>
@@ -169,6 +172,31 @@ pair<_Iter1, _Iter1> __search_impl(_Iter1 __first1, _Sent1 __last1,
                                                        __proj2);
 }
 
+template <class _Iter1, class _Iter2, class _BinaryPredicate>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11
+_Iter1 __search(_Iter1 __first1, _Iter1 __last1, _Iter2 __first2, _Iter2 __last2, _BinaryPredicate& __pred) {
+  auto __proj = __identity();
+  return std::__search_impl(__first1, __last1, __first2, __last2, __pred, __proj, __proj).first;
+}
+
+// Contiguous ranges of integers compared for equality are searched like strings, in linear time.
+template <class _Tp, class _Up, class _BinaryPredicate>
+struct __can_search_as_contiguous
+    : integral_constant<bool, is_same<_Tp, _Up>::value && __can_search_contiguous<_Tp>::value &&
+                                  __is_equal_to_predicate<__uncvref_t<_BinaryPredicate>, _Tp>::value> {};
+
+template <class _Tp,
+          class _Up,
+          class _BinaryPredicate,
+          __enable_if_t<__can_search_as_contiguous<typename remove_const<_Tp>::type,
+                                                   typename remove_const<_Up>::type,
+                                                   _BinaryPredicate>::value,
+                        int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11
+_Tp* __search(_Tp* __first1, _Tp* __last1, _Up* __first2, _Up* __last2, _BinaryPredicate&) {
+  return __first1 + (std::__search_contiguous(__first1, __last1, __first2, __last2) - __first1);
+}
+
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
 _LIBCPP_NODISCARD_EXT inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17
 _ForwardIterator1 search(_ForwardIterator1 __first1, _ForwardIterator1 __last1,
@@ -176,8 +204,12 @@ _ForwardIterator1 search(_ForwardIterator1 __first1, _ForwardIterator1 __last1,
                          _BinaryPredicate __pred) {
   static_assert(__is_callable<_BinaryPredicate, decltype(*__first1), decltype(*__first2)>::value,
                 "BinaryPredicate has to be callable");
-  auto __proj = __identity();
-  return std::__search_impl(__first1, __last1, __first2, __last2, __pred, __proj, __proj).first;
+  return std::__rewrap_iter(__first1,
+                            std::__search(std::__unwrap_iter(__first1),
+                                          std::__unwrap_iter(__last1),
+                                          std::__unwrap_iter(__first2),
+                                          std::__unwrap_iter(__last2),
+                                          __pred));
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -12,10 +12,14 @@
 #include <__algorithm/comp.h>
 #include <__algorithm/comp_ref_type.h>
 #include <__algorithm/copy.h>
+#include <__algorithm/lower_bound.h>
 #include <__config>
 #include <__functional/identity.h>
 #include <__functional/invoke.h>
 #include <__iterator/iterator_traits.h>
+#include <__iterator/next.h>
+#include <__type_traits/integral_constant.h>
+#include <__utility/forward.h>
 #include <__utility/move.h>
 #include <__utility/pair.h>
 #include <type_traits>
@@ -28,8 +32,13 @@ _LIBCPP_BEGIN_NAMESPACE_STD
 
 template < class _Comp, class _InIter1, class _Sent1, class _InIter2, class _Sent2, class _OutIter>
 _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 pair<__uncvref_t<_InIter1>, __uncvref_t<_OutIter> >
-__set_difference(
-    _InIter1&& __first1, _Sent1&& __last1, _InIter2&& __first2, _Sent2&& __last2, _OutIter&& __result, _Comp&& __comp) {
+__set_difference_impl(_InIter1&& __first1,
+                      _Sent1&& __last1,
+                      _InIter2&& __first2,
+                      _Sent2&& __last2,
+                      _OutIter&& __result,
+                      _Comp&& __comp,
+                      false_type /* can gallop */) {
   while (__first1 != __last1 && __first2 != __last2) {
     if (__comp(*__first1, *__first2)) {
       *__result = *__first1;
@@ -45,6 +54,74 @@ __set_difference(
   return std::__copy(std::move(__first1), std::move(__last1), std::move(__result));
 }
 
+// Runs of __gallop_threshold elements or more of either range ordered before the current element of the
+// other one are skipped with a one-sided binary search, and copied at once when they come from the
+// first range. See __set_intersection_impl.
+template < class _Comp, class _InIter1, class _Sent1, class _InIter2, class _Sent2, class _OutIter>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 pair<__uncvref_t<_InIter1>, __uncvref_t<_OutIter> >
+__set_difference_impl(_InIter1&& __first1,
+                      _Sent1&& __last1,
+                      _InIter2&& __first2,
+                      _Sent2&& __last2,
+                      _OutIter&& __result,
+                      _Comp&& __comp,
+                      true_type /* can gallop */) {
+  if (!std::__should_gallop(__first1, __last1, __first2, __last2))
+    return std::__set_difference_impl(
+        std::forward<_InIter1>(__first1),
+        std::forward<_Sent1>(__last1),
+        std::forward<_InIter2>(__first2),
+        std::forward<_Sent2>(__last2),
+        std::forward<_OutIter>(__result),
+        __comp,
+        false_type());
+
+  unsigned __run1 = 0;
+  unsigned __run2 = 0;
+  while (__first1 != __last1 && __first2 != __last2) {
+    if (__comp(*__first1, *__first2)) {
+      __run2 = 0;
+      if (++__run1 < __gallop_threshold) {
+        *__result = *__first1;
+        ++__first1;
+        ++__result;
+      } else {
+        __uncvref_t<_InIter1> __run_end = std::__lower_bound_onesided(std::next(__first1), __last1, *__first2, __comp);
+        __result = std::__copy(std::move(__first1), __run_end, std::move(__result)).second;
+        __first1 = std::move(__run_end);
+      }
+    } else if (__comp(*__first2, *__first1)) {
+      __run1 = 0;
+      if (++__run2 < __gallop_threshold)
+        ++__first2;
+      else
+        __first2 = std::__lower_bound_onesided(++__first2, __last2, *__first1, __comp);
+    } else {
+      __run1 = 0;
+      __run2 = 0;
+      ++__first1;
+      ++__first2;
+    }
+  }
+  return std::__copy(std::move(__first1), std::move(__last1), std::move(__result));
+}
+
+template < class _Comp, class _InIter1, class _Sent1, class _InIter2, class _Sent2, class _OutIter>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 pair<__uncvref_t<_InIter1>, __uncvref_t<_OutIter> >
+__set_difference(
+    _InIter1&& __first1, _Sent1&& __last1, _InIter2&& __first2, _Sent2&& __last2, _OutIter&& __result, _Comp&& __comp) {
+  return std::__set_difference_impl(
+      std::forward<_InIter1>(__first1),
+      std::forward<_Sent1>(__last1),
+      std::forward<_InIter2>(__first2),
+      std::forward<_Sent2>(__last2),
+      std::forward<_OutIter>(__result),
+      __comp,
+      integral_constant<bool,
+                        __can_gallop<__uncvref_t<_InIter1>, __uncvref_t<_Sent1> >::value &&
+                            __can_gallop<__uncvref_t<_InIter2>, __uncvref_t<_Sent2> >::value>());
+}
+
 template <class _InputIterator1, class _InputIterator2, class _OutputIterator, class _Compare>
 inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator set_difference(
     _InputIterator1 __first1,
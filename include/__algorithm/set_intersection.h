@@ -12,9 +12,11 @@
 #include <__algorithm/comp.h>
 #include <__algorithm/comp_ref_type.h>
 #include <__algorithm/iterator_operations.h>
+#include <__algorithm/lower_bound.h>
 #include <__config>
 #include <__iterator/iterator_traits.h>
 #include <__iterator/next.h>
+#include <__type_traits/integral_constant.h>
 #include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -37,8 +39,13 @@ struct __set_intersection_result {
 
 template <class _AlgPolicy, class _Compare, class _InIter1, class _Sent1, class _InIter2, class _Sent2, class _OutIter>
 _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 __set_intersection_result<_InIter1, _InIter2, _OutIter>
-__set_intersection(
-    _InIter1 __first1, _Sent1 __last1, _InIter2 __first2, _Sent2 __last2, _OutIter __result, _Compare&& __comp) {
+__set_intersection_impl(_InIter1 __first1,
+                        _Sent1 __last1,
+                        _InIter2 __first2,
+                        _Sent2 __last2,
+                        _OutIter __result,
+                        _Compare&& __comp,
+                        false_type /* can gallop */) {
   while (__first1 != __last1 && __first2 != __last2) {
     if (__comp(*__first1, *__first2))
       ++__first1;
@@ -58,6 +65,72 @@ __set_intersection(
       std::move(__result));
 }
 
+// When one range is much longer than the other one, once either range has had __gallop_threshold elements
+// in a row ordered before the current element of the other one, the rest of the run is skipped with a
+// one-sided binary search, so intersecting a short range with a much longer one takes a number of
+// comparisons proportional to the length of the short one times the logarithm of the ratio of their lengths.
+template <class _AlgPolicy, class _Compare, class _InIter1, class _Sent1, class _InIter2, class _Sent2, class _OutIter>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 __set_intersection_result<_InIter1, _InIter2, _OutIter>
+__set_intersection_impl(_InIter1 __first1,
+                        _Sent1 __last1,
+                        _InIter2 __first2,
+                        _Sent2 __last2,
+                        _OutIter __result,
+                        _Compare&& __comp,
+                        true_type /* can gallop */) {
+  if (!std::__should_gallop(__first1, __last1, __first2, __last2))
+    return std::__set_intersection_impl<_AlgPolicy>(
+        std::move(__first1),
+        std::move(__last1),
+        std::move(__first2),
+        std::move(__last2),
+        std::move(__result),
+        __comp,
+        false_type());
+
+  unsigned __run1 = 0;
+  unsigned __run2 = 0;
+  while (__first1 != __last1 && __first2 != __last2) {
+    if (__comp(*__first1, *__first2)) {
+      __run2 = 0;
+      if (++__run1 < __gallop_threshold)
+        ++__first1;
+      else
+        __first1 = std::__lower_bound_onesided(++__first1, __last1, *__first2, __comp);
+    } else if (__comp(*__first2, *__first1)) {
+      __run1 = 0;
+      if (++__run2 < __gallop_threshold)
+        ++__first2;
+      else
+        __first2 = std::__lower_bound_onesided(++__first2, __last2, *__first1, __comp);
+    } else {
+      __run1 = 0;
+      __run2 = 0;
+      *__result = *__first1;
+      ++__result;
+      ++__first1;
+      ++__first2;
+    }
+  }
+
+  return __set_intersection_result<_InIter1, _InIter2, _OutIter>(
+      std::move(__last1), std::move(__last2), std::move(__result));
+}
+
+template <class _AlgPolicy, class _Compare, class _InIter1, class _Sent1, class _InIter2, class _Sent2, class _OutIter>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 __set_intersection_result<_InIter1, _InIter2, _OutIter>
+__set_intersection(
+    _InIter1 __first1, _Sent1 __last1, _InIter2 __first2, _Sent2 __last2, _OutIter __result, _Compare&& __comp) {
+  return std::__set_intersection_impl<_AlgPolicy>(
+      std::move(__first1),
+      std::move(__last1),
+      std::move(__first2),
+      std::move(__last2),
+      std::move(__result),
+      __comp,
+      integral_constant<bool, __can_gallop<_InIter1, _Sent1>::value && __can_gallop<_InIter2, _Sent2>::value>());
+}
+
 template <class _InputIterator1, class _InputIterator2, class _OutputIterator, class _Compare>
 inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator set_intersection(
     _InputIterator1 __first1,
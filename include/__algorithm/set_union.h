@@ -12,8 +12,11 @@
 #include <__algorithm/comp.h>
 #include <__algorithm/comp_ref_type.h>
 #include <__algorithm/copy.h>
+#include <__algorithm/lower_bound.h>
 #include <__config>
 #include <__iterator/iterator_traits.h>
+#include <__iterator/next.h>
+#include <__type_traits/integral_constant.h>
 #include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -35,8 +38,14 @@ struct __set_union_result {
 };
 
 template <class _Compare, class _InIter1, class _Sent1, class _InIter2, class _Sent2, class _OutIter>
-_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 __set_union_result<_InIter1, _InIter2, _OutIter> __set_union(
-    _InIter1 __first1, _Sent1 __last1, _InIter2 __first2, _Sent2 __last2, _OutIter __result, _Compare&& __comp) {
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 __set_union_result<_InIter1, _InIter2, _OutIter>
+__set_union_impl(_InIter1 __first1,
+                 _Sent1 __last1,
+                 _InIter2 __first2,
+                 _Sent2 __last2,
+                 _OutIter __result,
+                 _Compare&& __comp,
+                 false_type /* can gallop */) {
   for (; __first1 != __last1; ++__result) {
     if (__first2 == __last2) {
       auto __ret1 = std::__copy_impl(std::move(__first1), std::move(__last1), std::move(__result));
@@ -59,6 +68,80 @@ _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 __set_union_result<_InIter1,
       std::move(__first1), std::move(__ret2.first), std::move((__ret2.second)));
 }
 
+// Runs of __gallop_threshold elements or more of either range ordered before the current element of the
+// other one are found with a one-sided binary search and copied at once. See __set_intersection_impl.
+template <class _Compare, class _InIter1, class _Sent1, class _InIter2, class _Sent2, class _OutIter>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 __set_union_result<_InIter1, _InIter2, _OutIter>
+__set_union_impl(_InIter1 __first1,
+                 _Sent1 __last1,
+                 _InIter2 __first2,
+                 _Sent2 __last2,
+                 _OutIter __result,
+                 _Compare&& __comp,
+                 true_type /* can gallop */) {
+  if (!std::__should_gallop(__first1, __last1, __first2, __last2))
+    return std::__set_union_impl(
+        std::move(__first1),
+        std::move(__last1),
+        std::move(__first2),
+        std::move(__last2),
+        std::move(__result),
+        __comp,
+        false_type());
+
+  unsigned __run1 = 0;
+  unsigned __run2 = 0;
+  while (__first1 != __last1 && __first2 != __last2) {
+    if (__comp(*__first2, *__first1)) {
+      __run1 = 0;
+      if (++__run2 < __gallop_threshold) {
+        *__result = *__first2;
+        ++__first2;
+        ++__result;
+      } else {
+        _InIter2 __run_end = std::__lower_bound_onesided(std::next(__first2), __last2, *__first1, __comp);
+        __result           = std::__copy_impl(std::move(__first2), __run_end, std::move(__result)).second;
+        __first2           = std::move(__run_end);
+      }
+    } else if (__comp(*__first1, *__first2)) {
+      __run2 = 0;
+      if (++__run1 < __gallop_threshold) {
+        *__result = *__first1;
+        ++__first1;
+        ++__result;
+      } else {
+        _InIter1 __run_end = std::__lower_bound_onesided(std::next(__first1), __last1, *__first2, __comp);
+        __result           = std::__copy_impl(std::move(__first1), __run_end, std::move(__result)).second;
+        __first1           = std::move(__run_end);
+      }
+    } else {
+      __run1    = 0;
+      __run2    = 0;
+      *__result = *__first1;
+      ++__first1;
+      ++__first2;
+      ++__result;
+    }
+  }
+  auto __ret1 = std::__copy_impl(std::move(__first1), std::move(__last1), std::move(__result));
+  auto __ret2 = std::__copy_impl(std::move(__first2), std::move(__last2), std::move(__ret1.second));
+  return __set_union_result<_InIter1, _InIter2, _OutIter>(
+      std::move(__ret1.first), std::move(__ret2.first), std::move(__ret2.second));
+}
+
+template <class _Compare, class _InIter1, class _Sent1, class _InIter2, class _Sent2, class _OutIter>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 __set_union_result<_InIter1, _InIter2, _OutIter> __set_union(
+    _InIter1 __first1, _Sent1 __last1, _InIter2 __first2, _Sent2 __last2, _OutIter __result, _Compare&& __comp) {
+  return std::__set_union_impl(
+      std::move(__first1),
+      std::move(__last1),
+      std::move(__first2),
+      std::move(__last2),
+      std::move(__result),
+      __comp,
+      integral_constant<bool, __can_gallop<_InIter1, _Sent1>::value && __can_gallop<_InIter2, _Sent2>::value>());
+}
+
 template <class _InputIterator1, class _InputIterator2, class _OutputIterator, class _Compare>
 _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator set_union(
     _InputIterator1 __first1,
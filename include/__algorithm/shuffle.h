@@ -13,7 +13,10 @@
 #include <__config>
 #include <__debug>
 #include <__iterator/iterator_traits.h>
+#include <__random/batched_uniform_int.h>
 #include <__random/uniform_int_distribution.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/remove_cvref.h>
 #include <__utility/forward.h>
 #include <__utility/move.h>
 #include <cstddef>
@@ -136,15 +139,13 @@ random_shuffle(_RandomAccessIterator __first, _RandomAccessIterator __last,
 }
 #endif
 
-template <class _AlgPolicy, class _RandomAccessIterator, class _Sentinel, class _UniformRandomNumberGenerator>
-_RandomAccessIterator __shuffle(
-    _RandomAccessIterator __first, _Sentinel __last_sentinel, _UniformRandomNumberGenerator&& __g) {
+template <class _AlgPolicy, class _RandomAccessIterator, class _UniformRandomNumberGenerator>
+void __shuffle_impl(_RandomAccessIterator __first, _RandomAccessIterator __last, _UniformRandomNumberGenerator& __g,
+                    false_type /* full words */) {
     typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
     typedef uniform_int_distribution<ptrdiff_t> _Dp;
     typedef typename _Dp::param_type _Pp;
 
-    auto __original_last = _IterOps<_AlgPolicy>::next(__first, __last_sentinel);
-    auto __last = __original_last;
     difference_type __d = __last - __first;
     if (__d > 1)
     {
@@ -156,7 +157,35 @@ _RandomAccessIterator __shuffle(
                 _IterOps<_AlgPolicy>::iter_swap(__first, __first + __i);
         }
     }
+}
+
+#if !defined(_LIBCPP_CXX03_LANG) && !defined(_LIBCPP_HAS_NO_INT128)
+// Generators whose words are all random bits give several indices per 64-bit word.
+template <class _AlgPolicy, class _RandomAccessIterator, class _UniformRandomNumberGenerator>
+void __shuffle_impl(_RandomAccessIterator __first, _RandomAccessIterator __last, _UniformRandomNumberGenerator& __g,
+                    true_type /* full words */) {
+    typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+
+    difference_type __d = __last - __first;
+    if (__d > 1)
+    {
+        __batched_uniform_int<_UniformRandomNumberGenerator> __uid(__g, static_cast<uint64_t>(__d));
+        for (--__last; __first < __last; ++__first)
+        {
+            difference_type __i = static_cast<difference_type>(__uid());
+            if (__i != difference_type(0))
+                _IterOps<_AlgPolicy>::iter_swap(__first, __first + __i);
+        }
+    }
+}
+#endif
 
+template <class _AlgPolicy, class _RandomAccessIterator, class _Sentinel, class _UniformRandomNumberGenerator>
+_RandomAccessIterator __shuffle(
+    _RandomAccessIterator __first, _Sentinel __last_sentinel, _UniformRandomNumberGenerator&& __g) {
+    typedef __uncvref_t<_UniformRandomNumberGenerator> _Gen;
+    auto __original_last = _IterOps<_AlgPolicy>::next(__first, __last_sentinel);
+    std::__shuffle_impl<_AlgPolicy>(std::move(__first), __original_last, __g, __is_full_word_urng<_Gen>());
     return __original_last;
 }
 
@@ -0,0 +1,520 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_SIMD_UTILS_H
+#define _LIBCPP___ALGORITHM_SIMD_UTILS_H
+
+#include <__algorithm/comp.h>
+#include <__config>
+#include <__functional/operations.h>
+#include <__functional/ranges_operations.h>
+#include <__type_traits/conditional.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_const.h>
+#include <__type_traits/is_floating_point.h>
+#include <__type_traits/is_integral.h>
+#include <__type_traits/is_pointer.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/is_signed.h>
+#include <__type_traits/is_trivially_copyable.h>
+#include <__type_traits/is_trivially_default_constructible.h>
+#include <__type_traits/is_volatile.h>
+#include <__type_traits/make_signed.h>
+#include <__type_traits/remove_const.h>
+#include <__type_traits/remove_cvref.h>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+// The vectorized algorithms are written with the vector extensions of GCC and Clang, and use vectors
+// as wide as the widest integer registers the target is known to have. Comparing 64-bit lanes for
+// equality takes SSE4.1 on x86 and AArch64 on ARM, ordering them takes SSE4.2 or AArch64, and only
+// x86 and AArch64 have vectors of doubles; without them, the vectors are slower than a scalar loop.
+#if !defined(_LIBCPP_COMPILER_MSVC) && !defined(__OPTIMIZE_SIZE__)
+#  if defined(__AVX2__)
+#    define _LIBCPP_ALGORITHM_VECTOR_BYTES 32
+#    define _LIBCPP_ALGORITHM_VECTOR_HAS_64_BIT_EQUALITY
+#    define _LIBCPP_ALGORITHM_VECTOR_HAS_64_BIT_ORDERING
+#    define _LIBCPP_ALGORITHM_VECTOR_HAS_DOUBLE
+#  elif defined(__SSE2__) || defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    define _LIBCPP_ALGORITHM_VECTOR_BYTES 16
+#    if defined(__SSE4_1__) || defined(__aarch64__)
+#      define _LIBCPP_ALGORITHM_VECTOR_HAS_64_BIT_EQUALITY
+#    endif
+#    if defined(__SSE4_2__) || defined(__aarch64__)
+#      define _LIBCPP_ALGORITHM_VECTOR_HAS_64_BIT_ORDERING
+#    endif
+#    if defined(__SSE2__) || defined(__aarch64__)
+#      define _LIBCPP_ALGORITHM_VECTOR_HAS_DOUBLE
+#    endif
+#  endif
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// Whether two values of type _Tp are equal if and only if their object representations are equal, in
+// which case ranges of them can be compared a whole vector or a whole word at a time. This is true of
+// integers and pointers, except capabilities: they don't fit in a word, and their tag isn't part of
+// their object representation.
+template <class _Tp>
+struct __is_bitwise_equality_comparable
+    : integral_constant<bool, (is_integral<_Tp>::value || is_pointer<_Tp>::value) && !is_same<_Tp, bool>::value &&
+                                  !is_volatile<_Tp>::value && sizeof(_Tp) <= sizeof(uint64_t)> {};
+
+// Whether the elements of a range of _Tp equal to a value of type _Up can be found by comparing their
+// object representations with the one of the value converted to _Tp. Converting an integer to a type
+// at most as wide as the type they are compared in is injective, so only the converted value can
+// match, and only if it compares equal to the original one (see __convert_searched_value).
+template <class _Tp, class _Up>
+struct __can_find_bitwise
+    : integral_constant<bool, __is_bitwise_equality_comparable<_Tp>::value &&
+                                  (is_integral<_Tp>::value ? is_integral<_Up>::value && !is_same<_Up, bool>::value
+                                                           : is_same<__uncvref_t<_Up>, _Tp>::value)> {};
+
+// Converts __value to the type of the elements it is searched among, and returns whether it can compare
+// equal to any of them.
+template <class _Tp, class _Up>
+inline _LIBCPP_HIDE_FROM_ABI bool __convert_searched_value(const _Up& __value, _Tp& __result) {
+  __result = static_cast<_Tp>(__value);
+  return __result == __value;
+}
+
+// Whether _Pred compares values of type _Tp with their operator==.
+template <class _Pred, class _Tp>
+struct __is_equal_to_predicate : false_type {};
+template <class _Tp>
+struct __is_equal_to_predicate<__equal_to<_Tp, _Tp>, _Tp> : true_type {};
+template <class _Tp>
+struct __is_equal_to_predicate<equal_to<_Tp>, _Tp> : true_type {};
+#if _LIBCPP_STD_VER > 11
+template <class _Tp>
+struct __is_equal_to_predicate<equal_to<void>, _Tp> : true_type {};
+#endif
+#if _LIBCPP_STD_VER > 17
+template <class _Tp>
+struct __is_equal_to_predicate<ranges::equal_to, _Tp> : true_type {};
+#endif
+
+// Whether comparing ranges of _Tp and _Up with _Pred amounts to comparing their object representations.
+template <class _Pred, class _Tp, class _Up>
+struct __can_compare_bitwise
+    : integral_constant<bool, is_same<_Tp, _Up>::value && __is_bitwise_equality_comparable<_Tp>::value &&
+                                  __is_equal_to_predicate<__uncvref_t<_Pred>, _Tp>::value> {};
+
+// Whether _Comp compares values of type _Tp with their operator<.
+template <class _Comp, class _Tp>
+struct __is_less_predicate : false_type {};
+template <class _Tp>
+struct __is_less_predicate<__less<_Tp, _Tp>, _Tp> : true_type {};
+template <class _Tp>
+struct __is_less_predicate<less<_Tp>, _Tp> : true_type {};
+#if _LIBCPP_STD_VER > 11
+template <class _Tp>
+struct __is_less_predicate<less<void>, _Tp> : true_type {};
+#endif
+#if _LIBCPP_STD_VER > 17
+template <class _Tp>
+struct __is_less_predicate<ranges::less, _Tp> : true_type {};
+#endif
+
+// Whether values of type _Tp are ordered like their object representations read as arrays of unsigned
+// bytes, in which case ranges of them can be ordered with memcmp. This is true of unsigned bytes, and of
+// wider unsigned integers on big-endian targets.
+template <class _Tp>
+struct __is_bytewise_ordered
+    : integral_constant<bool, is_integral<_Tp>::value && !is_signed<_Tp>::value && !is_same<_Tp, bool>::value &&
+#ifdef _LIBCPP_BIG_ENDIAN
+                                  !is_volatile<_Tp>::value> {};
+#else
+                                  !is_volatile<_Tp>::value && sizeof(_Tp) == 1> {};
+#endif
+
+// Whether the algorithms that compact a range of _Tp, like remove_if and unique, can move every element
+// they go through and only advance the destination past the ones they keep. Moving an element that is
+// small and trivially copyable costs less than the branch that would otherwise be mispredicted whenever
+// the elements kept and the elements dropped are interleaved unpredictably.
+template <class _Tp>
+struct __can_compact_without_branches
+    : integral_constant<bool, is_trivially_copyable<_Tp>::value && !is_const<_Tp>::value &&
+                                  !is_volatile<_Tp>::value && sizeof(_Tp) <= sizeof(uint64_t)> {};
+
+// Whether copy_if and remove_if can compact blocks of a range of _Tp in a local buffer.
+template <class _Tp>
+struct __can_compact_by_blocks
+    : integral_constant<bool, __can_compact_without_branches<_Tp>::value &&
+                                  is_trivially_default_constructible<_Tp>::value> {};
+
+#ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+
+template <size_t _Size>
+struct __simd_lane;
+template <>
+struct __simd_lane<1> { typedef uint8_t type; };
+template <>
+struct __simd_lane<2> { typedef uint16_t type; };
+template <>
+struct __simd_lane<4> { typedef uint32_t type; };
+template <>
+struct __simd_lane<8> { typedef uint64_t type; };
+
+// A vector of unsigned integers as wide as _Tp, unless _LaneSize says otherwise, and the number of
+// elements of type _Tp it holds.
+template <class _Tp, size_t _LaneSize = sizeof(_Tp)>
+struct __simd_vector {
+  typedef typename __simd_lane<_LaneSize>::type __lane_type;
+  typedef __lane_type type __attribute__((__vector_size__(_LIBCPP_ALGORITHM_VECTOR_BYTES)));
+  static const size_t __size = _LIBCPP_ALGORITHM_VECTOR_BYTES / sizeof(_Tp);
+};
+
+// Whether the elements of a range of _Tp can be compared to a value a vector at a time.
+template <class _Tp>
+struct __has_simd_equality
+#  ifdef _LIBCPP_ALGORITHM_VECTOR_HAS_64_BIT_EQUALITY
+    : true_type {};
+#  else
+    : integral_constant<bool, sizeof(_Tp) < sizeof(uint64_t)> {};
+#  endif
+
+template <class _Vec>
+inline _LIBCPP_HIDE_FROM_ABI _Vec __simd_load(const void* __ptr) {
+  _Vec __result;
+  __builtin_memcpy(&__result, __ptr, sizeof(_Vec));
+  return __result;
+}
+
+template <class _Tp>
+inline _LIBCPP_HIDE_FROM_ABI typename __simd_vector<_Tp>::type __simd_broadcast(const _Tp& __value) {
+  typename __simd_vector<_Tp>::__lane_type __lane;
+  __builtin_memcpy(&__lane, &__value, sizeof(_Tp));
+  return typename __simd_vector<_Tp>::type() + __lane;
+}
+
+// Whether any lane of a comparison result is set.
+template <class _Vec>
+inline _LIBCPP_HIDE_FROM_ABI bool __simd_any(_Vec __mask) {
+  uint64_t __words[sizeof(_Vec) / sizeof(uint64_t)];
+  __builtin_memcpy(__words, &__mask, sizeof(_Vec));
+  uint64_t __result = 0;
+  for (size_t __i = 0; __i != sizeof(_Vec) / sizeof(uint64_t); ++__i)
+    __result |= __words[__i];
+  return __result != 0;
+}
+
+// Returns a pointer to the first element of [__first, __last) equal to __value, or __last.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI _Tp* __simd_find(_Tp* __first, _Tp* __last, const typename remove_const<_Tp>::type& __value) {
+  typedef __simd_vector<_Tp> _Traits;
+  typedef typename _Traits::type _Vec;
+  const _Vec __needle = std::__simd_broadcast(__value);
+  // Look for the vector that holds the match, four vectors at a time while there are enough elements
+  // left. The match is then located in that vector by the scalar loop below.
+  for (; __last - __first >= static_cast<ptrdiff_t>(4 * _Traits::__size); __first += 4 * _Traits::__size) {
+    _Vec __eq0 = _Vec(std::__simd_load<_Vec>(__first) == __needle);
+    _Vec __eq1 = _Vec(std::__simd_load<_Vec>(__first + _Traits::__size) == __needle);
+    _Vec __eq2 = _Vec(std::__simd_load<_Vec>(__first + 2 * _Traits::__size) == __needle);
+    _Vec __eq3 = _Vec(std::__simd_load<_Vec>(__first + 3 * _Traits::__size) == __needle);
+    if (std::__simd_any((__eq0 | __eq1) | (__eq2 | __eq3)))
+      break;
+  }
+  for (; __last - __first >= static_cast<ptrdiff_t>(_Traits::__size); __first += _Traits::__size)
+    if (std::__simd_any(_Vec(std::__simd_load<_Vec>(__first) == __needle)))
+      break;
+  for (; __first != __last; ++__first)
+    if (*__first == __value)
+      break;
+  return __first;
+}
+
+// Returns the number of elements of [__first, __last) equal to __value.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI size_t __simd_count(_Tp* __first, _Tp* __last, const typename remove_const<_Tp>::type& __value) {
+  typedef __simd_vector<_Tp> _Traits;
+  typedef typename _Traits::__lane_type _Lane;
+  typedef typename _Traits::type _Vec;
+  const _Vec __needle = std::__simd_broadcast(__value);
+  // The lanes of the accumulator count the matches in their position, and are added up before they
+  // can overflow.
+  const size_t __max_vectors = sizeof(_Lane) < sizeof(size_t) ? static_cast<size_t>(_Lane(-1)) : size_t(-1);
+  size_t __result = 0;
+  while (__last - __first >= static_cast<ptrdiff_t>(_Traits::__size)) {
+    size_t __vectors = static_cast<size_t>(__last - __first) / _Traits::__size;
+    if (__vectors > __max_vectors)
+      __vectors = __max_vectors;
+    _Vec __counts = _Vec();
+    for (size_t __i = 0; __i != __vectors; ++__i, __first += _Traits::__size)
+      __counts -= _Vec(std::__simd_load<_Vec>(__first) == __needle);
+    for (size_t __i = 0; __i != _Traits::__size; ++__i)
+      __result += __counts[__i];
+  }
+  for (; __first != __last; ++__first)
+    if (*__first == __value)
+      ++__result;
+  return __result;
+}
+
+// Returns the index of the first position at which [__first1, __first1 + __n) and
+// [__first2, __first2 + __n) differ, or __n.
+template <class _Tp, class _Up>
+_LIBCPP_HIDE_FROM_ABI size_t __simd_mismatch(_Tp* __first1, _Up* __first2, size_t __n) {
+  // Two vectors differ if any of their 32-bit halves of 64-bit lanes do, so there's no need for 64-bit
+  // lanes here.
+  typedef __simd_vector<_Tp, sizeof(_Tp) < sizeof(uint32_t) ? sizeof(_Tp) : sizeof(uint32_t)> _Traits;
+  typedef typename _Traits::type _Vec;
+  size_t __i = 0;
+  for (; __n - __i >= 4 * _Traits::__size; __i += 4 * _Traits::__size) {
+    _Vec __ne0 = _Vec(std::__simd_load<_Vec>(__first1 + __i) != std::__simd_load<_Vec>(__first2 + __i));
+    _Vec __ne1 = _Vec(std::__simd_load<_Vec>(__first1 + __i + _Traits::__size) !=
+                      std::__simd_load<_Vec>(__first2 + __i + _Traits::__size));
+    _Vec __ne2 = _Vec(std::__simd_load<_Vec>(__first1 + __i + 2 * _Traits::__size) !=
+                      std::__simd_load<_Vec>(__first2 + __i + 2 * _Traits::__size));
+    _Vec __ne3 = _Vec(std::__simd_load<_Vec>(__first1 + __i + 3 * _Traits::__size) !=
+                      std::__simd_load<_Vec>(__first2 + __i + 3 * _Traits::__size));
+    if (std::__simd_any((__ne0 | __ne1) | (__ne2 | __ne3)))
+      break;
+  }
+  for (; __n - __i >= _Traits::__size; __i += _Traits::__size)
+    if (std::__simd_any(_Vec(std::__simd_load<_Vec>(__first1 + __i) != std::__simd_load<_Vec>(__first2 + __i))))
+      break;
+  for (; __i != __n; ++__i)
+    if (!(__first1[__i] == __first2[__i]))
+      break;
+  return __i;
+}
+
+// Moves the elements of [__first, __last) that aren't equal to __value to the range starting at __result,
+// which must not be after __first, and returns the end of the elements moved. Vectors that don't hold
+// __value are stored whole, and the others are compacted one element at a time without branching.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI _Tp* __simd_remove(_Tp* __result, _Tp* __first, _Tp* __last, const _Tp& __value) {
+  typedef __simd_vector<_Tp> _Traits;
+  typedef typename _Traits::type _Vec;
+  const _Vec __needle = std::__simd_broadcast(__value);
+  for (; __last - __first >= static_cast<ptrdiff_t>(_Traits::__size); __first += _Traits::__size) {
+    _Vec __values = std::__simd_load<_Vec>(__first);
+    _Vec __eq     = _Vec(__values == __needle);
+    if (!std::__simd_any(__eq)) {
+      __builtin_memcpy(__result, &__values, sizeof(_Vec));
+      __result += _Traits::__size;
+      continue;
+    }
+    for (size_t __i = 0; __i != _Traits::__size; ++__i) {
+      *__result = __first[__i];
+      __result += !__eq[__i];
+    }
+  }
+  for (; __first != __last; ++__first) {
+    bool __keep = !(*__first == __value);
+    *__result   = *__first;
+    __result += __keep;
+  }
+  return __result;
+}
+
+// Moves the elements of [__first, __last) that aren't equal to the element before them to the range
+// starting at __result + 1, where __result must be before __first and hold a value equal to __first[-1], and
+// returns a pointer to the last element moved, or __result if there are none. Works like __simd_remove.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI _Tp* __simd_unique(_Tp* __result, _Tp* __first, _Tp* __last) {
+  typedef __simd_vector<_Tp> _Traits;
+  typedef typename _Traits::type _Vec;
+  // The element before a vector is loaded along with the others before the vector gets compacted, and
+  // compacting a vector only writes to its own elements or to elements before it, so every element is
+  // compared with the element it followed in the original range.
+  for (; __last - __first >= static_cast<ptrdiff_t>(_Traits::__size); __first += _Traits::__size) {
+    _Vec __values = std::__simd_load<_Vec>(__first);
+    _Vec __eq     = _Vec(__values == std::__simd_load<_Vec>(__first - 1));
+    if (!std::__simd_any(__eq)) {
+      __builtin_memcpy(__result + 1, &__values, sizeof(_Vec));
+      __result += _Traits::__size;
+      continue;
+    }
+    for (size_t __i = 0; __i != _Traits::__size; ++__i) {
+      __result[1] = __first[__i];
+      __result += !__eq[__i];
+    }
+  }
+  for (; __first != __last; ++__first) {
+    bool __keep = !(*__result == *__first);
+    __result[1] = *__first;
+    __result += __keep;
+  }
+  return __result;
+}
+
+// Whether ranges of _Tp can be ordered a vector at a time, in which case their elements are loaded into
+// vectors of __simd_ordered_vector<_Tp>.
+template <class _Tp>
+struct __has_simd_ordering
+    : integral_constant<bool, is_integral<_Tp>::value && !is_same<_Tp, bool>::value && !is_volatile<_Tp>::value &&
+#  ifdef _LIBCPP_ALGORITHM_VECTOR_HAS_64_BIT_ORDERING
+                                  sizeof(_Tp) <= sizeof(uint64_t)> {};
+#  else
+                                  sizeof(_Tp) < sizeof(uint64_t)> {};
+#  endif
+template <>
+struct __has_simd_ordering<float> : integral_constant<bool, numeric_limits<float>::is_iec559> {};
+#  ifdef _LIBCPP_ALGORITHM_VECTOR_HAS_DOUBLE
+template <>
+struct __has_simd_ordering<double> : integral_constant<bool, numeric_limits<double>::is_iec559> {};
+#  endif
+
+// A vector of values ordered like _Tp, the vector of masks comparing them yields, and the number of
+// elements of type _Tp it holds.
+template <class _Tp, bool = is_floating_point<_Tp>::value>
+struct __simd_ordered_vector {
+  typedef typename __simd_lane<sizeof(_Tp)>::type __unsigned_lane_type;
+  typedef __conditional_t<is_signed<_Tp>::value, typename make_signed<__unsigned_lane_type>::type, __unsigned_lane_type>
+      __lane_type;
+  typedef __lane_type type __attribute__((__vector_size__(_LIBCPP_ALGORITHM_VECTOR_BYTES)));
+  typedef typename make_signed<__unsigned_lane_type>::type __mask_lane_type;
+  typedef __mask_lane_type __mask __attribute__((__vector_size__(_LIBCPP_ALGORITHM_VECTOR_BYTES)));
+  static const size_t __size = _LIBCPP_ALGORITHM_VECTOR_BYTES / sizeof(_Tp);
+};
+
+template <class _Tp>
+struct __simd_ordered_vector<_Tp, true> {
+  typedef _Tp __lane_type;
+  typedef _Tp type __attribute__((__vector_size__(_LIBCPP_ALGORITHM_VECTOR_BYTES)));
+  typedef typename make_signed<typename __simd_lane<sizeof(_Tp)>::type>::type __mask_lane_type;
+  typedef __mask_lane_type __mask __attribute__((__vector_size__(_LIBCPP_ALGORITHM_VECTOR_BYTES)));
+  static const size_t __size = _LIBCPP_ALGORITHM_VECTOR_BYTES / sizeof(_Tp);
+};
+
+// Returns the lanes of __if_true for which __mask is set, and the lanes of __if_false for the others.
+template <class _Mask, class _Vec>
+inline _LIBCPP_HIDE_FROM_ABI _Vec __simd_select(_Mask __mask, _Vec __if_false, _Vec __if_true) {
+  _Mask __false_bits = _Mask(__if_false);
+  return _Vec(__false_bits ^ ((__false_bits ^ _Mask(__if_true)) & __mask));
+}
+
+// Returns, lane by lane, the smallest of __acc and __value or with _Greater the largest, keeping __acc
+// if they are equivalent or if __value is a NaN.
+template <bool _Greater, class _Tp, class _Vec>
+inline _LIBCPP_HIDE_FROM_ABI _Vec __simd_extremum_lanes(_Vec __acc, _Vec __value) {
+  typedef typename __simd_ordered_vector<_Tp>::__mask _Mask;
+  return std::__simd_select(_Greater ? _Mask(__acc < __value) : _Mask(__value < __acc), __acc, __value);
+}
+
+// Returns the smallest or with _Greater the largest of __init and the elements of
+// [__first, __first + __vectors * __simd_ordered_vector<_Tp>::__size), ignoring NaNs. __init must not be
+// a NaN.
+template <bool _Greater, class _Tp>
+_LIBCPP_HIDE_FROM_ABI _Tp __simd_extremum(const _Tp* __first, size_t __vectors, _Tp __init) {
+  typedef __simd_ordered_vector<_Tp> _Traits;
+  typedef typename _Traits::type _Vec;
+  // Four accumulators keep four comparisons in flight.
+  _Vec __acc0 = _Vec() + static_cast<typename _Traits::__lane_type>(__init);
+  _Vec __acc1 = __acc0, __acc2 = __acc0, __acc3 = __acc0;
+  size_t __i = 0;
+  for (; __vectors - __i >= 4; __i += 4, __first += 4 * _Traits::__size) {
+    __acc0 = std::__simd_extremum_lanes<_Greater, _Tp>(__acc0, std::__simd_load<_Vec>(__first));
+    __acc1 = std::__simd_extremum_lanes<_Greater, _Tp>(__acc1, std::__simd_load<_Vec>(__first + _Traits::__size));
+    __acc2 = std::__simd_extremum_lanes<_Greater, _Tp>(__acc2, std::__simd_load<_Vec>(__first + 2 * _Traits::__size));
+    __acc3 = std::__simd_extremum_lanes<_Greater, _Tp>(__acc3, std::__simd_load<_Vec>(__first + 3 * _Traits::__size));
+  }
+  for (; __i != __vectors; ++__i, __first += _Traits::__size)
+    __acc0 = std::__simd_extremum_lanes<_Greater, _Tp>(__acc0, std::__simd_load<_Vec>(__first));
+  __acc0 = std::__simd_extremum_lanes<_Greater, _Tp>(__acc0, __acc1);
+  __acc2 = std::__simd_extremum_lanes<_Greater, _Tp>(__acc2, __acc3);
+  __acc0 = std::__simd_extremum_lanes<_Greater, _Tp>(__acc0, __acc2);
+  _Tp __result = __init;
+  for (size_t __lane = 0; __lane != _Traits::__size; ++__lane) {
+    _Tp __value = static_cast<_Tp>(__acc0[__lane]);
+    if (_Greater ? __result < __value : __value < __result)
+      __result = __value;
+  }
+  return __result;
+}
+
+// Sets __min and __max to the smallest and the largest elements of
+// [__first, __first + __vectors * __simd_ordered_vector<_Tp>::__size), unless one of them is a NaN, in
+// which case it returns false. __vectors must not be zero.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI bool __simd_minmax(const _Tp* __first, size_t __vectors, _Tp& __min, _Tp& __max) {
+  typedef __simd_ordered_vector<_Tp> _Traits;
+  typedef typename _Traits::type _Vec;
+  typedef typename _Traits::__mask _Mask;
+  _Vec __min0 = std::__simd_load<_Vec>(__first), __min1 = __min0;
+  _Vec __max0 = __min0, __max1 = __min0;
+  _Mask __unordered = _Mask(__min0 != __min0);
+  size_t __i = 1;
+  __first += _Traits::__size;
+  for (; __vectors - __i >= 2; __i += 2, __first += 2 * _Traits::__size) {
+    _Vec __v0 = std::__simd_load<_Vec>(__first);
+    _Vec __v1 = std::__simd_load<_Vec>(__first + _Traits::__size);
+    __min0 = std::__simd_extremum_lanes<false, _Tp>(__min0, __v0);
+    __min1 = std::__simd_extremum_lanes<false, _Tp>(__min1, __v1);
+    __max0 = std::__simd_extremum_lanes<true, _Tp>(__max0, __v0);
+    __max1 = std::__simd_extremum_lanes<true, _Tp>(__max1, __v1);
+    __unordered |= _Mask(__v0 != __v0) | _Mask(__v1 != __v1);
+  }
+  if (__i != __vectors) {
+    _Vec __v0 = std::__simd_load<_Vec>(__first);
+    __min0 = std::__simd_extremum_lanes<false, _Tp>(__min0, __v0);
+    __max0 = std::__simd_extremum_lanes<true, _Tp>(__max0, __v0);
+    __unordered |= _Mask(__v0 != __v0);
+  }
+  if (std::__simd_any(__unordered))
+    return false;
+  __min0 = std::__simd_extremum_lanes<false, _Tp>(__min0, __min1);
+  __max0 = std::__simd_extremum_lanes<true, _Tp>(__max0, __max1);
+  __min = static_cast<_Tp>(__min0[0]);
+  __max = static_cast<_Tp>(__max0[0]);
+  for (size_t __lane = 1; __lane != _Traits::__size; ++__lane) {
+    if (static_cast<_Tp>(__min0[__lane]) < __min)
+      __min = static_cast<_Tp>(__min0[__lane]);
+    if (__max < static_cast<_Tp>(__max0[__lane]))
+      __max = static_cast<_Tp>(__max0[__lane]);
+  }
+  return true;
+}
+
+// The number of vectors the algorithms below look at before checking whether they hold a new extremum.
+// The extremum is located in the last chunk that held one once the whole range has been looked at.
+const size_t __simd_extremum_chunk_vectors = 32;
+
+// Returns a pointer to the first smallest element of [__first, __last) or with _Greater, to the first
+// largest, like std::min_element and std::max_element with operator<. NaNs are never picked, unless
+// the first element is one: nothing is ordered before or after it, so it is the result.
+template <bool _Greater, class _Tp>
+_LIBCPP_HIDE_FROM_ABI _Tp* __simd_min_element(_Tp* __first, _Tp* __last) {
+  typedef typename remove_const<_Tp>::type _Value;
+  typedef __simd_ordered_vector<_Value> _Traits;
+  if (__first == __last || !(*__first == *__first))
+    return __first;
+  _Value __best = *__first;
+  _Tp* __best_chunk = __first;
+  _Tp* __i = __first;
+  while (static_cast<size_t>(__last - __i) >= _Traits::__size) {
+    size_t __vectors = static_cast<size_t>(__last - __i) / _Traits::__size;
+    if (__vectors > __simd_extremum_chunk_vectors)
+      __vectors = __simd_extremum_chunk_vectors;
+    _Value __chunk_best = std::__simd_extremum<_Greater>(__i, __vectors, __best);
+    if (_Greater ? __best < __chunk_best : __chunk_best < __best) {
+      __best       = __chunk_best;
+      __best_chunk = __i;
+    }
+    __i += __vectors * _Traits::__size;
+  }
+  while (!(*__best_chunk == __best))
+    ++__best_chunk;
+  for (; __i != __last; ++__i)
+    if (_Greater ? *__best_chunk < *__i : *__i < *__best_chunk)
+      __best_chunk = __i;
+  return __best_chunk;
+}
+
+#endif // _LIBCPP_ALGORITHM_VECTOR_BYTES
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP___ALGORITHM_SIMD_UTILS_H
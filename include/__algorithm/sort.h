@@ -12,8 +12,10 @@
 #include <__algorithm/comp.h>
 #include <__algorithm/comp_ref_type.h>
 #include <__algorithm/iterator_operations.h>
+#include <__algorithm/make_heap.h>
 #include <__algorithm/min_element.h>
-#include <__algorithm/partial_sort.h>
+#include <__algorithm/radix_sort.h>
+#include <__algorithm/sort_heap.h>
 #include <__algorithm/unwrap_iter.h>
 #include <__bits>
 #include <__config>
@@ -22,7 +24,9 @@
 #include <__functional/operations.h>
 #include <__functional/ranges_operations.h>
 #include <__iterator/iterator_traits.h>
+#include <__utility/pair.h>
 #include <climits>
+#include <cstdint>
 #include <memory>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -416,17 +420,332 @@ void __insertion_sort_move(_BidirectionalIterator __first1, _BidirectionalIterat
   }
 }
 
+// Sorts [__first, __last) with insertion sort, assuming that the element right before __first
+// is not greater than any of the elements in the range, so that it guards the inner loop.
 template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
-void __introsort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp,
-                 typename iterator_traits<_RandomAccessIterator>::difference_type __depth) {
+void __insertion_sort_unguarded(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp) {
   using _Ops = _IterOps<_AlgPolicy>;
 
   typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
   typedef typename iterator_traits<_RandomAccessIterator>::value_type value_type;
-  const difference_type __limit =
-      is_trivially_copy_constructible<value_type>::value && is_trivially_copy_assignable<value_type>::value ? 30 : 6;
+  if (__first == __last)
+    return;
+  for (_RandomAccessIterator __i = __first + difference_type(1); __i != __last; ++__i) {
+    _RandomAccessIterator __j = __i - difference_type(1);
+    if (__comp(*__i, *__j)) {
+      value_type __t(_Ops::__iter_move(__i));
+      _RandomAccessIterator __k = __j;
+      __j = __i;
+      do {
+        *__j = _Ops::__iter_move(__k);
+        __j = __k;
+      } while (__comp(__t, *--__k));
+      *__j = _VSTD::move(__t);
+    }
+  }
+}
+
+// Number of elements whose comparison outcomes are recorded at once by the block partition.
+const int __partition_block_size = sizeof(uint64_t) * CHAR_BIT;
+
+// Swaps the elements at the positions recorded in __left_bitset (counted up from __first) with the
+// ones recorded in __right_bitset (counted down from __lm1), until one of the bitsets runs out.
+template <class _AlgPolicy, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI void __swap_bitmap_pos(_RandomAccessIterator __first, _RandomAccessIterator __lm1,
+                                                    uint64_t& __left_bitset, uint64_t& __right_bitset) {
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  while (__left_bitset != 0 && __right_bitset != 0) {
+    difference_type __tz_left = __libcpp_ctz(__left_bitset);
+    __left_bitset &= __left_bitset - 1;
+    difference_type __tz_right = __libcpp_ctz(__right_bitset);
+    __right_bitset &= __right_bitset - 1;
+    _Ops::iter_swap(__first + __tz_left, __lm1 - __tz_right);
+  }
+}
+
+// Records in __left_bitset which of the __size elements starting at __first don't belong before
+// the pivot. The loop has no branches, which lets the compiler vectorize it.
+template <class _Compare, class _RandomAccessIterator, class _Tp>
+inline _LIBCPP_HIDE_FROM_ABI void __populate_left_bitset(_RandomAccessIterator __first, int __size, _Compare __comp,
+                                                         const _Tp& __pivot, uint64_t& __left_bitset) {
+  for (int __j = 0; __j < __size; ++__j, (void)++__first)
+    __left_bitset |= static_cast<uint64_t>(!__comp(*__first, __pivot)) << __j;
+}
+
+// Records in __right_bitset which of the __size elements ending at __lm1 (inclusive) belong before
+// the pivot.
+template <class _Compare, class _RandomAccessIterator, class _Tp>
+inline _LIBCPP_HIDE_FROM_ABI void __populate_right_bitset(_RandomAccessIterator __lm1, int __size, _Compare __comp,
+                                                          const _Tp& __pivot, uint64_t& __right_bitset) {
+  for (int __j = 0; __j < __size; ++__j, (void)--__lm1)
+    __right_bitset |= static_cast<uint64_t>(__comp(*__lm1, __pivot)) << __j;
+}
+
+// Partitions the last elements of [__first, __lm1], when less than two full blocks are left. One of
+// the sides may still have a block whose comparison outcomes have been recorded in its bitset.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, class _Tp>
+inline _LIBCPP_HIDE_FROM_ABI void
+__bitset_partition_partial_blocks(_RandomAccessIterator& __first, _RandomAccessIterator& __lm1, _Compare __comp,
+                                  const _Tp& __pivot, uint64_t& __left_bitset, uint64_t& __right_bitset) {
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  difference_type __remaining_len = __lm1 - __first + 1;
+  difference_type __l_size;
+  difference_type __r_size;
+  if (__left_bitset == 0 && __right_bitset == 0) {
+    __l_size = __remaining_len / 2;
+    __r_size = __remaining_len - __l_size;
+  } else if (__left_bitset == 0) {
+    // The right side still has a full block.
+    __l_size = __remaining_len - __partition_block_size;
+    __r_size = __partition_block_size;
+  } else {
+    // The left side still has a full block.
+    __l_size = __partition_block_size;
+    __r_size = __remaining_len - __partition_block_size;
+  }
+  if (__left_bitset == 0)
+    std::__populate_left_bitset<_Compare>(__first, static_cast<int>(__l_size), __comp, __pivot, __left_bitset);
+  if (__right_bitset == 0)
+    std::__populate_right_bitset<_Compare>(__lm1, static_cast<int>(__r_size), __comp, __pivot, __right_bitset);
+  std::__swap_bitmap_pos<_AlgPolicy>(__first, __lm1, __left_bitset, __right_bitset);
+  __first += __left_bitset == 0 ? __l_size : difference_type(0);
+  __lm1 -= __right_bitset == 0 ? __r_size : difference_type(0);
+}
+
+// At most one of the bitsets is left non-empty once the blocks have been exhausted, and [__first, __lm1]
+// is exactly the block it describes. Moves the elements recorded in it to the other end of the block.
+template <class _AlgPolicy, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI void __swap_bitmap_pos_within(_RandomAccessIterator& __first,
+                                                           _RandomAccessIterator& __lm1, uint64_t& __left_bitset,
+                                                           uint64_t& __right_bitset) {
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  if (__left_bitset) {
+    // Move the elements that don't belong before the pivot to the end of the block, starting from
+    // the rightmost one.
+    while (__left_bitset != 0) {
+      difference_type __tz_left = __partition_block_size - 1 - __libcpp_clz(__left_bitset);
+      __left_bitset &= (static_cast<uint64_t>(1) << __tz_left) - 1;
+      _RandomAccessIterator __it = __first + __tz_left;
+      if (__it != __lm1)
+        _Ops::iter_swap(__it, __lm1);
+      --__lm1;
+    }
+    __first = __lm1 + difference_type(1);
+  } else if (__right_bitset) {
+    // Move the elements that belong before the pivot to the beginning of the block, starting from
+    // the leftmost one.
+    while (__right_bitset != 0) {
+      difference_type __tz_right = __partition_block_size - 1 - __libcpp_clz(__right_bitset);
+      __right_bitset &= (static_cast<uint64_t>(1) << __tz_right) - 1;
+      _RandomAccessIterator __it = __lm1 - __tz_right;
+      if (__it != __first)
+        _Ops::iter_swap(__it, __first);
+      ++__first;
+    }
+  }
+}
+
+// Partitions [__first, __last) around the pivot *__first, as BlockQuicksort does: the outcomes of the
+// comparisons are first recorded in bitsets for a block of elements on each side, and the elements are
+// then swapped according to the bitsets. Neither step branches on the outcome of a comparison, so this
+// is only worth it when comparing elements is cheap and doesn't branch either.
+//
+// Assumes that the range holds an element not less than the pivot, and that [__first, __last) holds
+// at least 3 elements. Returns the final position of the pivot, which is such that
+// [__first, __pivot) < *__pivot and *__pivot <= [__pivot + 1, __last), and whether the range was
+// already partitioned.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+pair<_RandomAccessIterator, bool> __bitset_partition(_RandomAccessIterator __first, _RandomAccessIterator __last,
+                                                     _Compare __comp) {
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  typedef typename iterator_traits<_RandomAccessIterator>::value_type value_type;
+  const _RandomAccessIterator __begin = __first;
+  value_type __pivot(_Ops::__iter_move(__first));
+  // Find the first element not less than the pivot. The median selection guarantees that there is one.
+  do {
+    ++__first;
+  } while (__comp(*__first, __pivot));
+  // Find the last element less than the pivot. Unless an element less than the pivot was found above,
+  // nothing guards this search.
+  if (__begin == __first - difference_type(1)) {
+    while (__first < __last && !__comp(*--__last, __pivot))
+      ;
+  } else {
+    while (!__comp(*--__last, __pivot))
+      ;
+  }
+  // If these two elements are already in order, no element needs to move.
+  bool __already_partitioned = __first >= __last;
+  if (!__already_partitioned) {
+    _Ops::iter_swap(__first, __last);
+    ++__first;
+  }
+
+  // From now on, [__first, __lm1] is the part of the range that hasn't been partitioned yet.
+  _RandomAccessIterator __lm1 = __last - difference_type(1);
+  uint64_t __left_bitset = 0;
+  uint64_t __right_bitset = 0;
+  while (__lm1 - __first >= 2 * __partition_block_size - 1) {
+    if (__left_bitset == 0)
+      std::__populate_left_bitset<_Compare>(__first, __partition_block_size, __comp, __pivot, __left_bitset);
+    if (__right_bitset == 0)
+      std::__populate_right_bitset<_Compare>(__lm1, __partition_block_size, __comp, __pivot, __right_bitset);
+    std::__swap_bitmap_pos<_AlgPolicy>(__first, __lm1, __left_bitset, __right_bitset);
+    // Only move past a block once all of its misplaced elements have been swapped.
+    __first += __left_bitset == 0 ? difference_type(__partition_block_size) : difference_type(0);
+    __lm1 -= __right_bitset == 0 ? difference_type(__partition_block_size) : difference_type(0);
+  }
+  std::__bitset_partition_partial_blocks<_AlgPolicy, _Compare>(
+      __first, __lm1, __comp, __pivot, __left_bitset, __right_bitset);
+  std::__swap_bitmap_pos_within<_AlgPolicy>(__first, __lm1, __left_bitset, __right_bitset);
+
+  // Move the pivot to its final position.
+  _RandomAccessIterator __pivot_pos = __first - difference_type(1);
+  if (__begin != __pivot_pos)
+    *__begin = _Ops::__iter_move(__pivot_pos);
+  *__pivot_pos = _VSTD::move(__pivot);
+  return pair<_RandomAccessIterator, bool>(__pivot_pos, __already_partitioned);
+}
+
+// Partitions [__first, __last) around the pivot *__first, with the same preconditions and results as
+// __bitset_partition, using the classic Hoare partition scheme.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+pair<_RandomAccessIterator, bool> __partition_with_equals_on_right(_RandomAccessIterator __first,
+                                                                   _RandomAccessIterator __last, _Compare __comp) {
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  typedef typename iterator_traits<_RandomAccessIterator>::value_type value_type;
+  const _RandomAccessIterator __begin = __first;
+  value_type __pivot(_Ops::__iter_move(__first));
+  // Find the first element not less than the pivot. The median selection guarantees that there is one.
+  do {
+    ++__first;
+  } while (__comp(*__first, __pivot));
+  // Find the last element less than the pivot. Unless an element less than the pivot was found above,
+  // nothing guards this search.
+  if (__begin == __first - difference_type(1)) {
+    while (__first < __last && !__comp(*--__last, __pivot))
+      ;
+  } else {
+    while (!__comp(*--__last, __pivot))
+      ;
+  }
+  // If these two elements are already in order, no element needs to move.
+  bool __already_partitioned = __first >= __last;
+  // From now on, the elements swapped so far guard both searches.
+  while (__first < __last) {
+    _Ops::iter_swap(__first, __last);
+    do {
+      ++__first;
+    } while (__comp(*__first, __pivot));
+    do {
+      --__last;
+    } while (!__comp(*__last, __pivot));
+  }
+
+  // Move the pivot to its final position.
+  _RandomAccessIterator __pivot_pos = __first - difference_type(1);
+  if (__begin != __pivot_pos)
+    *__begin = _Ops::__iter_move(__pivot_pos);
+  *__pivot_pos = _VSTD::move(__pivot);
+  return pair<_RandomAccessIterator, bool>(__pivot_pos, __already_partitioned);
+}
+
+// Partitions [__first, __last) around the pivot *__first such that [__first, __result) <= pivot and
+// pivot < [__result, __last). This is used when the pivot is equivalent to the element right before
+// __first, which is not greater than any element of the range: [__first, __result) then only holds
+// elements equivalent to the pivot, which don't need to be sorted any further. Ranges with many
+// duplicates are sorted in linear time this way.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_RandomAccessIterator __partition_with_equals_on_left(_RandomAccessIterator __first, _RandomAccessIterator __last,
+                                                      _Compare __comp) {
+  using _Ops = _IterOps<_AlgPolicy>;
+
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  typedef typename iterator_traits<_RandomAccessIterator>::value_type value_type;
+  const _RandomAccessIterator __begin = __first;
+  value_type __pivot(_Ops::__iter_move(__first));
+  // Find the first element greater than the pivot.
+  if (__comp(__pivot, *(__last - difference_type(1)))) {
+    while (!__comp(__pivot, *++__first))
+      ;
+  } else {
+    while (++__first < __last && !__comp(__pivot, *__first))
+      ;
+  }
+  // Find the last element not greater than the pivot. The median selection guarantees that there is
+  // one after __begin.
+  if (__first < __last) {
+    while (__comp(__pivot, *--__last))
+      ;
+  }
+  while (__first < __last) {
+    _Ops::iter_swap(__first, __last);
+    while (!__comp(__pivot, *++__first))
+      ;
+    while (__comp(__pivot, *--__last))
+      ;
+  }
+
+  // Move the pivot to its final position.
+  _RandomAccessIterator __pivot_pos = __first - difference_type(1);
+  if (__begin != __pivot_pos)
+    *__begin = _Ops::__iter_move(__pivot_pos);
+  *__pivot_pos = _VSTD::move(__pivot);
+  return __first;
+}
+
+// Ranges up to this length are sorted with insertion sort rather than partitioned further.
+template <class _Tp>
+struct __insertion_sort_limit
+    : integral_constant<int, is_trivially_copy_constructible<_Tp>::value && is_trivially_copy_assignable<_Tp>::value
+                                 ? 30
+                                 : 6> {};
+
+// Moves the pivot for partitioning [__first, __last), which holds more than 5 elements, to *__first: the
+// median of three elements, or Tukey's ninther above 128 elements. The selection leaves an element not less
+// than the pivot and an element not greater than the pivot in the rest of the range, which guard the
+// partitions.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+inline _LIBCPP_HIDE_FROM_ABI void
+__choose_pivot(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp) {
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  const difference_type __ninther_threshold = 128;
+  difference_type __len = __last - __first;
+  difference_type __half_len = __len / 2;
+  if (__len > __ninther_threshold) {
+    std::__sort3<_AlgPolicy, _Compare>(__first, __first + __half_len, __last - difference_type(1), __comp);
+    std::__sort3<_AlgPolicy, _Compare>(
+        __first + difference_type(1), __first + (__half_len - 1), __last - difference_type(2), __comp);
+    std::__sort3<_AlgPolicy, _Compare>(
+        __first + difference_type(2), __first + (__half_len + 1), __last - difference_type(3), __comp);
+    std::__sort3<_AlgPolicy, _Compare>(
+        __first + (__half_len - 1), __first + __half_len, __first + (__half_len + 1), __comp);
+    _IterOps<_AlgPolicy>::iter_swap(__first, __first + __half_len);
+  } else {
+    std::__sort3<_AlgPolicy, _Compare>(__first + __half_len, __first, __last - difference_type(1), __comp);
+  }
+}
+
+// Sorts [__first, __last) with a pattern-defeating quicksort: ranges that are already partitioned
+// around the pivot are finished with an insertion sort that gives up if too many elements are out
+// of place, which makes ascending and descending inputs linear, and runs of elements equivalent to
+// an earlier pivot are set aside in a single pass. __leftmost is false when the element right before
+// __first is not greater than any element of the range, and can be used as a sentinel.
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, bool _UseBitSetPartition>
+void __introsort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp,
+                 typename iterator_traits<_RandomAccessIterator>::difference_type __depth, bool __leftmost = true) {
+  typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
+  typedef typename iterator_traits<_RandomAccessIterator>::value_type value_type;
+  const difference_type __limit = __insertion_sort_limit<value_type>::value;
   while (true) {
-  __restart:
     difference_type __len = __last - __first;
     switch (__len) {
     case 0:
@@ -450,126 +769,34 @@ void __introsort(_RandomAccessIterator __first, _RandomAccessIterator __last, _C
       return;
     }
     if (__len <= __limit) {
-      std::__insertion_sort_3<_AlgPolicy, _Compare>(__first, __last, __comp);
+      if (__leftmost)
+        std::__insertion_sort_3<_AlgPolicy, _Compare>(__first, __last, __comp);
+      else
+        std::__insertion_sort_unguarded<_AlgPolicy, _Compare>(__first, __last, __comp);
       return;
     }
     // __len > 5
     if (__depth == 0) {
       // Fallback to heap sort as Introsort suggests.
-      std::__partial_sort<_AlgPolicy, _Compare>(__first, __last, __last, __comp);
+      std::__make_heap<_AlgPolicy, _Compare>(__first, __last, __comp);
+      std::__sort_heap<_AlgPolicy, _Compare>(__first, __last, __comp);
       return;
     }
     --__depth;
-    _RandomAccessIterator __m = __first;
-    _RandomAccessIterator __lm1 = __last;
-    --__lm1;
-    unsigned __n_swaps;
-    {
-      difference_type __delta;
-      if (__len >= 1000) {
-        __delta = __len / 2;
-        __m += __delta;
-        __delta /= 2;
-        __n_swaps = std::__sort5_wrap_policy<_AlgPolicy, _Compare>(
-            __first, __first + __delta, __m, __m + __delta, __lm1, __comp);
-      } else {
-        __delta = __len / 2;
-        __m += __delta;
-        __n_swaps = std::__sort3<_AlgPolicy, _Compare>(__first, __m, __lm1, __comp);
-      }
-    }
-    // *__m is median
-    // partition [__first, __m) < *__m and *__m <= [__m, __last)
-    // (this inhibits tossing elements equivalent to __m around unnecessarily)
-    _RandomAccessIterator __i = __first;
-    _RandomAccessIterator __j = __lm1;
-    // j points beyond range to be tested, *__m is known to be <= *__lm1
-    // The search going up is known to be guarded but the search coming down isn't.
-    // Prime the downward search with a guard.
-    if (!__comp(*__i, *__m)) // if *__first == *__m
-    {
-      // *__first == *__m, *__first doesn't go in first part
-      // manually guard downward moving __j against __i
-      while (true) {
-        if (__i == --__j) {
-          // *__first == *__m, *__m <= all other elements
-          // Parition instead into [__first, __i) == *__first and *__first < [__i, __last)
-          ++__i; // __first + 1
-          __j = __last;
-          if (!__comp(*__first, *--__j)) // we need a guard if *__first == *(__last-1)
-          {
-            while (true) {
-              if (__i == __j)
-                return; // [__first, __last) all equivalent elements
-              if (__comp(*__first, *__i)) {
-                _Ops::iter_swap(__i, __j);
-                ++__n_swaps;
-                ++__i;
-                break;
-              }
-              ++__i;
-            }
-          }
-          // [__first, __i) == *__first and *__first < [__j, __last) and __j == __last - 1
-          if (__i == __j)
-            return;
-          while (true) {
-            while (!__comp(*__first, *__i))
-              ++__i;
-            while (__comp(*__first, *--__j))
-              ;
-            if (__i >= __j)
-              break;
-            _Ops::iter_swap(__i, __j);
-            ++__n_swaps;
-            ++__i;
-          }
-          // [__first, __i) == *__first and *__first < [__i, __last)
-          // The first part is sorted, sort the second part
-          // _VSTD::__sort<_Compare>(__i, __last, __comp);
-          __first = __i;
-          goto __restart;
-        }
-        if (__comp(*__j, *__m)) {
-          _Ops::iter_swap(__i, __j);
-          ++__n_swaps;
-          break; // found guard for downward moving __j, now use unguarded partition
-        }
-      }
-    }
-    // It is known that *__i < *__m
-    ++__i;
-    // j points beyond range to be tested, *__m is known to be <= *__lm1
-    // if not yet partitioned...
-    if (__i < __j) {
-      // known that *(__i - 1) < *__m
-      // known that __i <= __m
-      while (true) {
-        // __m still guards upward moving __i
-        while (__comp(*__i, *__m))
-          ++__i;
-        // It is now known that a guard exists for downward moving __j
-        while (!__comp(*--__j, *__m))
-          ;
-        if (__i > __j)
-          break;
-        _Ops::iter_swap(__i, __j);
-        ++__n_swaps;
-        // It is known that __m != __j
-        // If __m just moved, follow it
-        if (__m == __i)
-          __m = __j;
-        ++__i;
-      }
-    }
-    // [__first, __i) < *__m and *__m <= [__i, __last)
-    if (__i != __m && __comp(*__m, *__i)) {
-      _Ops::iter_swap(__i, __m);
-      ++__n_swaps;
+    std::__choose_pivot<_AlgPolicy, _Compare>(__first, __last, __comp);
+    // If the pivot is equivalent to the element right before the range, which is not greater than
+    // any element of the range, all the elements not greater than the pivot are equivalent to it.
+    if (!__leftmost && !__comp(*(__first - difference_type(1)), *__first)) {
+      __first = std::__partition_with_equals_on_left<_AlgPolicy, _Compare>(__first, __last, __comp);
+      continue;
     }
+    pair<_RandomAccessIterator, bool> __ret =
+        _UseBitSetPartition ? std::__bitset_partition<_AlgPolicy, _Compare>(__first, __last, __comp)
+                            : std::__partition_with_equals_on_right<_AlgPolicy, _Compare>(__first, __last, __comp);
+    _RandomAccessIterator __i = __ret.first;
     // [__first, __i) < *__i and *__i <= [__i+1, __last)
-    // If we were given a perfect partition, see if insertion sort is quick...
-    if (__n_swaps == 0) {
+    // If the range was already partitioned, see if insertion sort is quick...
+    if (__ret.second) {
       using _WrappedComp = typename _WrapAlgPolicy<_AlgPolicy, _Compare>::type;
       _WrappedComp __wrapped_comp(__comp);
       bool __fs = std::__insertion_sort_incomplete<_WrappedComp>(__first, __i, __wrapped_comp);
@@ -585,14 +812,12 @@ void __introsort(_RandomAccessIterator __first, _RandomAccessIterator __last, _C
         }
       }
     }
-    // sort smaller range with recursive call and larger with tail recursion elimination
-    if (__i - __first < __last - __i) {
-      std::__introsort<_AlgPolicy, _Compare>(__first, __i, __comp, __depth);
-      __first = ++__i;
-    } else {
-      std::__introsort<_AlgPolicy, _Compare>(__i + difference_type(1), __last, __comp, __depth);
-      __last = __i;
-    }
+    // Sort the left part with a recursive call, and the right part, which the pivot guards, with tail
+    // recursion elimination.
+    std::__introsort<_AlgPolicy, _Compare, _RandomAccessIterator, _UseBitSetPartition>(
+        __first, __i, __comp, __depth, __leftmost);
+    __leftmost = false;
+    __first = ++__i;
   }
 }
 
@@ -617,6 +842,11 @@ inline _LIBCPP_HIDE_FROM_ABI _Number __log2i(_Number __n) {
 
 template <class _WrappedComp, class _RandomAccessIterator>
 void __sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _WrappedComp __wrapped_comp) {
+  // Large ranges of arithmetic values, including the ones the dylib provides instantiations for,
+  // are radix sorted.
+  if (std::__radix_sort_if_profitable(__first, __last, __wrapped_comp))
+    return;
+
   typedef typename iterator_traits<_RandomAccessIterator>::difference_type difference_type;
   difference_type __depth_limit = 2 * __log2i(__last - __first);
 
@@ -624,7 +854,10 @@ void __sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Wrappe
   using _AlgPolicy = typename _Unwrap::_AlgPolicy;
   using _Compare = typename _Unwrap::_Comp;
   _Compare __comp = _Unwrap::__get_comp(__wrapped_comp);
-  std::__introsort<_AlgPolicy, _Compare>(__first, __last, __comp, __depth_limit);
+  // The block partition only pays off when the comparisons are cheap and don't branch themselves.
+  std::__introsort<_AlgPolicy, _Compare, _RandomAccessIterator,
+                   __use_branchless_sort<_Compare, _RandomAccessIterator>::value>(
+      __first, __last, __comp, __depth_limit);
 }
 
 template <class _Compare, class _Tp>
@@ -678,8 +911,8 @@ void __sort_impl(_RandomAccessIterator __first, _RandomAccessIterator __last, _C
 
   using _Comp_ref = typename __comp_ref_type<_Comp>::type;
   if (__libcpp_is_constant_evaluated()) {
-    std::__partial_sort<_AlgPolicy>(__first, __last, __last, __comp);
-
+    std::__make_heap<_AlgPolicy, _Comp>(__first, __last, __comp);
+    std::__sort_heap<_AlgPolicy, _Comp>(__first, __last, __comp);
   } else {
     using _WrappedComp = typename _WrapAlgPolicy<_AlgPolicy, _Comp_ref>::type;
     _Comp_ref __comp_ref(__comp);
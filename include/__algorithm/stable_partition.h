@@ -113,10 +113,10 @@ __second_half_done:
     //         |
 }
 
-template <class _AlgPolicy, class _Predicate, class _ForwardIterator>
+template <class _AlgPolicy, class _Predicate, class _ForwardIterator, class _BufferSource>
 _ForwardIterator
 __stable_partition_impl(_ForwardIterator __first, _ForwardIterator __last, _Predicate __pred,
-                   forward_iterator_tag)
+                   _BufferSource __source, forward_iterator_tag)
 {
     const unsigned __alloc_limit = 3;  // might want to make this a function of trivial assignment
     // Either prove all true and return __first or point to first false
@@ -133,16 +133,8 @@ __stable_partition_impl(_ForwardIterator __first, _ForwardIterator __last, _Pred
     typedef typename iterator_traits<_ForwardIterator>::difference_type difference_type;
     typedef typename iterator_traits<_ForwardIterator>::value_type value_type;
     difference_type __len = _IterOps<_AlgPolicy>::distance(__first, __last);
-    pair<value_type*, ptrdiff_t> __p(0, 0);
-    unique_ptr<value_type, __return_temporary_buffer> __h;
-    if (__len >= __alloc_limit)
-    {
-// TODO: Remove the use of std::get_temporary_buffer
-_LIBCPP_SUPPRESS_DEPRECATED_PUSH
-        __p = _VSTD::get_temporary_buffer<value_type>(__len);
-_LIBCPP_SUPPRESS_DEPRECATED_POP
-        __h.reset(__p.first);
-    }
+    __temporary_buffer<value_type, _BufferSource> __buf(__source, __len >= __alloc_limit ? __len : 0);
+    pair<value_type*, ptrdiff_t> __p(__buf.__data(), __buf.__size());
     return std::__stable_partition_impl<_AlgPolicy, _Predicate&>(
         std::move(__first), std::move(__last), __pred, __len, __p, forward_iterator_tag());
 }
@@ -258,10 +250,10 @@ __second_half_done:
     //         |
 }
 
-template <class _AlgPolicy, class _Predicate, class _BidirectionalIterator>
+template <class _AlgPolicy, class _Predicate, class _BidirectionalIterator, class _BufferSource>
 _BidirectionalIterator
 __stable_partition_impl(_BidirectionalIterator __first, _BidirectionalIterator __last, _Predicate __pred,
-                   bidirectional_iterator_tag)
+                   _BufferSource __source, bidirectional_iterator_tag)
 {
     typedef typename iterator_traits<_BidirectionalIterator>::difference_type difference_type;
     typedef typename iterator_traits<_BidirectionalIterator>::value_type value_type;
@@ -287,26 +279,26 @@ __stable_partition_impl(_BidirectionalIterator __first, _BidirectionalIterator _
     // *__last is known to be true
     // __len >= 2
     difference_type __len = _IterOps<_AlgPolicy>::distance(__first, __last) + 1;
-    pair<value_type*, ptrdiff_t> __p(0, 0);
-    unique_ptr<value_type, __return_temporary_buffer> __h;
-    if (__len >= __alloc_limit)
-    {
-// TODO: Remove the use of std::get_temporary_buffer
-_LIBCPP_SUPPRESS_DEPRECATED_PUSH
-        __p = _VSTD::get_temporary_buffer<value_type>(__len);
-_LIBCPP_SUPPRESS_DEPRECATED_POP
-        __h.reset(__p.first);
-    }
+    __temporary_buffer<value_type, _BufferSource> __buf(__source, __len >= __alloc_limit ? __len : 0);
+    pair<value_type*, ptrdiff_t> __p(__buf.__data(), __buf.__size());
     return std::__stable_partition_impl<_AlgPolicy, _Predicate&>(
         std::move(__first), std::move(__last), __pred, __len, __p, bidirectional_iterator_tag());
 }
 
+template <class _AlgPolicy, class _Predicate, class _ForwardIterator, class _BufferSource, class _IterCategory>
+_LIBCPP_HIDE_FROM_ABI
+_ForwardIterator __stable_partition(_ForwardIterator __first, _ForwardIterator __last, _Predicate&& __pred,
+                                    _BufferSource __source, _IterCategory __iter_category) {
+  return std::__stable_partition_impl<_AlgPolicy, __uncvref_t<_Predicate>&>(
+      std::move(__first), std::move(__last), __pred, __source, __iter_category);
+}
+
 template <class _AlgPolicy, class _Predicate, class _ForwardIterator, class _IterCategory>
 _LIBCPP_HIDE_FROM_ABI
 _ForwardIterator __stable_partition(
     _ForwardIterator __first, _ForwardIterator __last, _Predicate&& __pred, _IterCategory __iter_category) {
-  return std::__stable_partition_impl<_AlgPolicy, __uncvref_t<_Predicate>&>(
-      std::move(__first), std::move(__last), __pred, __iter_category);
+  return std::__stable_partition<_AlgPolicy>(
+      std::move(__first), std::move(__last), __pred, __temporary_buffer_source(), __iter_category);
 }
 
 template <class _ForwardIterator, class _Predicate>
@@ -0,0 +1,253 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_TWO_WAY_SEARCH_H
+#define _LIBCPP___ALGORITHM_TWO_WAY_SEARCH_H
+
+#include <__algorithm/find.h>
+#include <__algorithm/simd_utils.h>
+#include <__config>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/is_integral.h>
+#include <cstddef>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// Whether a contiguous range of _Tp can be searched for a subrange with __search_contiguous, which
+// compares the elements with their operator== and orders them with their operator<.
+template <class _Tp>
+struct __can_search_contiguous
+    : integral_constant<bool, __is_bitwise_equality_comparable<_Tp>::value && is_integral<_Tp>::value> {};
+
+// Returns the start of the maximal suffix of [__needle, __needle + __n) for operator<, or for the
+// reverse order with _Reversed, minus one, and stores the period of that suffix in __period.
+template <bool _Reversed, class _Tp>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 ptrdiff_t
+__maximal_suffix(const _Tp* __needle, ptrdiff_t __n, ptrdiff_t& __period) {
+  ptrdiff_t __suffix = -1;
+  ptrdiff_t __j      = 0;
+  ptrdiff_t __k      = 1;
+  __period           = 1;
+  while (__j + __k < __n) {
+    _Tp __a = __needle[__j + __k];
+    _Tp __b = __needle[__suffix + __k];
+    if (_Reversed ? __b < __a : __a < __b) {
+      __j += __k;
+      __k      = 1;
+      __period = __j - __suffix;
+    } else if (__a == __b) {
+      if (__k != __period) {
+        ++__k;
+      } else {
+        __j += __period;
+        __k = 1;
+      }
+    } else {
+      __suffix = __j++;
+      __k = __period = 1;
+    }
+  }
+  return __suffix;
+}
+
+// Returns the first occurrence of [__first2, __last2), which must not be empty, in [__first1, __last1),
+// or __last1, with the algorithm of Crochemore and Perrin. The needle is split at a critical factorization
+// in a left and a right part. Each candidate position is checked by matching the right part from left to
+// right and then the left part from right to left, and a mismatch lets the search skip as many positions
+// as the part of the needle that matched, which keeps the search linear even on repetitive inputs.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 const _Tp*
+__two_way_search(const _Tp* __first1, const _Tp* __last1, const _Tp* __first2, const _Tp* __last2) {
+  const ptrdiff_t __n   = __last2 - __first2;
+  const ptrdiff_t __end = __last1 - __first1 - __n; // The last position the needle can start at.
+  ptrdiff_t __period;
+  ptrdiff_t __suffix = std::__maximal_suffix<false>(__first2, __n, __period);
+  ptrdiff_t __reversed_period;
+  ptrdiff_t __reversed_suffix = std::__maximal_suffix<true>(__first2, __n, __reversed_period);
+  if (__suffix < __reversed_suffix) {
+    __suffix = __reversed_suffix;
+    __period = __reversed_period;
+  }
+  ++__suffix;
+
+  bool __periodic = true;
+  for (ptrdiff_t __i = 0; __i != __suffix; ++__i) {
+    if (!(__first2[__i] == __first2[__i + __period])) {
+      __periodic = false;
+      break;
+    }
+  }
+
+  if (__periodic) {
+    // After a full match of the right part, the next candidate is a period further, and the first
+    // __memory elements of the needle are already known to match there.
+    ptrdiff_t __memory = 0;
+    for (ptrdiff_t __j = 0; __j <= __end;) {
+      ptrdiff_t __i = __suffix < __memory ? __memory : __suffix;
+      while (__i < __n && __first2[__i] == __first1[__j + __i])
+        ++__i;
+      if (__i < __n) {
+        __j += __i - __suffix + 1;
+        __memory = 0;
+        continue;
+      }
+      __i = __suffix - 1;
+      while (__memory <= __i && __first2[__i] == __first1[__j + __i])
+        --__i;
+      if (__i < __memory)
+        return __first1 + __j;
+      __j += __period;
+      __memory = __n - __period;
+    }
+  } else {
+    // Otherwise, the left and the right part have no common period, and a full match of the right part
+    // followed by a mismatch in the left part rules out the next max(|left|, |right|) positions.
+    __period = (__suffix < __n - __suffix ? __n - __suffix : __suffix) + 1;
+    for (ptrdiff_t __j = 0; __j <= __end;) {
+      ptrdiff_t __i = __suffix;
+      while (__i < __n && __first2[__i] == __first1[__j + __i])
+        ++__i;
+      if (__i < __n) {
+        __j += __i - __suffix + 1;
+        continue;
+      }
+      __i = __suffix - 1;
+      while (__i >= 0 && __first2[__i] == __first1[__j + __i])
+        --__i;
+      if (__i < 0)
+        return __first1 + __j;
+      __j += __period;
+    }
+  }
+  return __last1;
+}
+
+// The prefilters below look for the positions where the first and the last elements of the needle match,
+// and compare the rest of the needle there. That finds most needles much faster than the two-way
+// algorithm, but can take quadratic time, so they give up once comparing the candidates has cost more than
+// __search_prefilter_budget(__scanned), and the search resumes with the two-way algorithm from where they
+// stopped. Each candidate costs the elements compared, plus a constant for the candidate itself.
+const size_t __search_candidate_cost = 8;
+
+inline _LIBCPP_HIDE_FROM_ABI size_t __search_prefilter_budget(size_t __scanned) { return 2 * __scanned + 256; }
+
+// Searches [__first, __last) for [__needle, __needle + __n), where __n is at least two, one position at a
+// time. Returns true with __first at the match, or at __last if there is none, or false with __first at
+// the position the search must resume at if the prefilter gave up.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI bool
+__search_prefiltered(const _Tp*& __first, const _Tp* __last, const _Tp* __needle, size_t __n, false_type /* vectorize */) {
+  const _Tp* const __start = __first;
+  const _Tp* const __end   = __last - (__n - 1); // One past the last position the needle can start at.
+  const _Tp __head         = __needle[0];
+  const _Tp __tail         = __needle[__n - 1];
+  size_t __cost            = 0;
+  for (; __first != __end; ++__first) {
+    if (sizeof(_Tp) == 1) {
+      // memchr is usually much faster than a loop at finding the next candidate.
+      const void* __found = __builtin_memchr(__first, static_cast<unsigned char>(__head), __end - __first);
+      if (__found == nullptr)
+        break;
+      __first = static_cast<const _Tp*>(__found);
+    } else if (!(*__first == __head)) {
+      continue;
+    }
+    if (!(__first[__n - 1] == __tail))
+      continue;
+    size_t __i = 1;
+    while (__i != __n - 1 && __first[__i] == __needle[__i])
+      ++__i;
+    if (__i == __n - 1)
+      return true;
+    __cost += __i + __search_candidate_cost;
+    if (__cost > std::__search_prefilter_budget(__first - __start)) {
+      ++__first;
+      return false;
+    }
+  }
+  __first = __last;
+  return true;
+}
+
+#ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI bool
+__search_prefiltered(const _Tp*& __first, const _Tp* __last, const _Tp* __needle, size_t __n, true_type /* vectorize */) {
+  typedef __simd_vector<_Tp> _Traits;
+  typedef typename _Traits::type _Vec;
+  const _Tp* const __start = __first;
+  const _Tp* const __end   = __last - (__n - 1);
+  const _Vec __head        = std::__simd_broadcast(__needle[0]);
+  const _Vec __tail        = std::__simd_broadcast(__needle[__n - 1]);
+  size_t __cost            = 0;
+  for (; __end - __first >= static_cast<ptrdiff_t>(_Traits::__size); __first += _Traits::__size) {
+    _Vec __candidates = _Vec(std::__simd_load<_Vec>(__first) == __head) &
+                        _Vec(std::__simd_load<_Vec>(__first + (__n - 1)) == __tail);
+    if (!std::__simd_any(__candidates))
+      continue;
+    for (size_t __lane = 0; __lane != _Traits::__size; ++__lane) {
+      if (!__candidates[__lane])
+        continue;
+      size_t __matched = std::__simd_mismatch(__first + __lane + 1, __needle + 1, __n - 2);
+      if (__matched == __n - 2) {
+        __first += __lane;
+        return true;
+      }
+      __cost += __matched + __search_candidate_cost;
+    }
+    if (__cost > std::__search_prefilter_budget(__first - __start)) {
+      __first += _Traits::__size;
+      return false;
+    }
+  }
+  // There are fewer positions left than a vector holds, so they can't cost much.
+  for (; __first != __end; ++__first)
+    if (*__first == __needle[0] && __first[__n - 1] == __needle[__n - 1] &&
+        std::__simd_mismatch(__first + 1, __needle + 1, __n - 2) == __n - 2)
+      return true;
+  __first = __last;
+  return true;
+}
+
+template <class _Tp>
+struct __can_search_prefiltered_vectorized : __has_simd_equality<_Tp> {};
+#else
+template <class _Tp>
+struct __can_search_prefiltered_vectorized : false_type {};
+#endif
+
+// Returns the first occurrence of [__first2, __last2) in [__first1, __last1), or __last1, where _Tp
+// satisfies __can_search_contiguous.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 const _Tp*
+__search_contiguous(const _Tp* __first1, const _Tp* __last1, const _Tp* __first2, const _Tp* __last2) {
+  const ptrdiff_t __n = __last2 - __first2;
+  if (__n == 0)
+    return __first1;
+  if (__last1 - __first1 < __n)
+    return __last1;
+  if (!__libcpp_is_constant_evaluated()) {
+    if (__n == 1)
+      return std::find(__first1, __last1, *__first2);
+    if (std::__search_prefiltered(
+            __first1, __last1, __first2, static_cast<size_t>(__n), __can_search_prefiltered_vectorized<_Tp>()))
+      return __first1;
+    if (__last1 - __first1 < __n)
+      return __last1;
+  }
+  return std::__two_way_search(__first1, __last1, __first2, __last2);
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP___ALGORITHM_TWO_WAY_SEARCH_H
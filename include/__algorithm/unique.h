@@ -11,8 +11,14 @@
 
 #include <__algorithm/adjacent_find.h>
 #include <__algorithm/comp.h>
+#include <__algorithm/simd_utils.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__iterator/iterator_traits.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/remove_cvref.h>
 #include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -24,8 +30,8 @@ _LIBCPP_BEGIN_NAMESPACE_STD
 // unique
 
 template <class _ForwardIterator, class _BinaryPredicate>
-_LIBCPP_NODISCARD_EXT _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator
-unique(_ForwardIterator __first, _ForwardIterator __last, _BinaryPredicate __pred)
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator
+__unique(_ForwardIterator __first, _ForwardIterator __last, _BinaryPredicate& __pred)
 {
     __first = _VSTD::adjacent_find<_ForwardIterator, _BinaryPredicate&>(__first, __last, __pred);
     if (__first != __last)
@@ -41,6 +47,75 @@ unique(_ForwardIterator __first, _ForwardIterator __last, _BinaryPredicate __pre
     return __first;
 }
 
+// Moves the elements of [__i, __last) that aren't equivalent to the last element kept, *__first, right
+// after it, without branching on them. Returns a pointer to the last element kept.
+template <class _Tp, class _BinaryPredicate>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp*
+__unique_after(_Tp* __first, _Tp* __i, _Tp* __last, _BinaryPredicate& __pred, false_type /* vectorize */)
+{
+    // The last element kept is held in a local variable rather than read back from the range, where it may
+    // just have been written.
+    _Tp __kept = *__first;
+    for (; __i != __last; ++__i)
+    {
+        _Tp __value = *__i;
+        bool __keep = !__pred(__kept, __value);
+        __first[1] = __value;
+        __first += __keep;
+        __kept = __keep ? __value : __kept;
+    }
+    return __first;
+}
+
+#ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+// With equality, an element is equal to the last element kept if and only if it is equal to the element
+// before it, so contiguous ranges of integers and pointers are compared with their neighbours a vector at
+// a time.
+template <class _Tp, class _BinaryPredicate>
+struct __can_unique_vectorized
+    : integral_constant<bool, __is_bitwise_equality_comparable<_Tp>::value && __has_simd_equality<_Tp>::value &&
+                                  __is_equal_to_predicate<__uncvref_t<_BinaryPredicate>, _Tp>::value> {};
+
+template <class _Tp, class _BinaryPredicate>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp*
+__unique_after(_Tp* __first, _Tp* __i, _Tp* __last, _BinaryPredicate& __pred, true_type /* vectorize */)
+{
+    if (__libcpp_is_constant_evaluated())
+        return _VSTD::__unique_after(__first, __i, __last, __pred, false_type());
+    return _VSTD::__simd_unique(__first, __i, __last);
+}
+#else
+template <class _Tp, class _BinaryPredicate>
+struct __can_unique_vectorized : false_type {};
+#endif
+
+// Contiguous ranges of integers and pointers are compacted by moving every element after the first
+// duplicate, and only advancing the destination past the ones that are kept. Compilers turn the selection
+// of the last element kept back into a branch for other types.
+template <class _Tp,
+          class _BinaryPredicate,
+          __enable_if_t<__can_compact_without_branches<_Tp>::value && __is_bitwise_equality_comparable<_Tp>::value,
+                        int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp*
+__unique(_Tp* __first, _Tp* __last, _BinaryPredicate& __pred)
+{
+    __first = _VSTD::adjacent_find<_Tp*, _BinaryPredicate&>(__first, __last, __pred);
+    if (__first == __last)
+        return __first;
+    // ...  a  a  ?  ...
+    //      f     i
+    return _VSTD::__unique_after(
+               __first, __first + 2, __last, __pred, __can_unique_vectorized<_Tp, _BinaryPredicate>()) + 1;
+}
+
+template <class _ForwardIterator, class _BinaryPredicate>
+_LIBCPP_NODISCARD_EXT _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator
+unique(_ForwardIterator __first, _ForwardIterator __last, _BinaryPredicate __pred)
+{
+    return _VSTD::__rewrap_iter(
+        __first, _VSTD::__unique(_VSTD::__unwrap_iter(__first), _VSTD::__unwrap_iter(__last), __pred));
+}
+
 template <class _ForwardIterator>
 _LIBCPP_NODISCARD_EXT inline
 _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17
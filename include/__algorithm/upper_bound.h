@@ -12,14 +12,22 @@
 #include <__algorithm/comp.h>
 #include <__algorithm/half_positive.h>
 #include <__algorithm/iterator_operations.h>
+#include <__algorithm/lower_bound.h>
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__functional/identity.h>
 #include <__functional/invoke.h>
 #include <__iterator/advance.h>
 #include <__iterator/distance.h>
 #include <__iterator/iterator_traits.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/is_constant_evaluated.h>
 #include <__type_traits/is_copy_constructible.h>
+#include <__type_traits/remove_const.h>
+#include <__type_traits/remove_cvref.h>
+#include <__utility/forward.h>
 #include <__utility/move.h>
+#include <cstddef>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -44,13 +52,40 @@ __upper_bound(_Iter __first, _Sent __last, const _Tp& __value, _Compare&& __comp
   return __first;
 }
 
+// The branchless counterpart of the loop above, see __lower_bound_impl.
+template <class _AlgPolicy,
+          class _Compare,
+          class _Tp,
+          class _Type,
+          __enable_if_t<__use_branchless_search<__uncvref_t<_Compare>, typename remove_const<_Tp>::type, _Type>::value,
+                        int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp*
+__upper_bound(_Tp* __first, _Tp* __last, const _Type& __value, _Compare&& __comp, __identity&& __proj) {
+  if (__libcpp_is_constant_evaluated())
+    return std::__upper_bound<_AlgPolicy, _Compare, _Tp*, _Tp*, _Type, __identity>(
+        __first, __last, __value, std::forward<_Compare>(__comp), std::move(__proj));
+
+  size_t __len = static_cast<size_t>(__last - __first);
+  if (__len == 0)
+    return __first;
+  while (__len > 1) {
+    size_t __half = __len / 2;
+    std::__prefetch_next_midpoints(__first, __half, (__len - __half) / 2);
+    __first += __comp(__value, __first[__half]) ? 0 : __half;
+    __len -= __half;
+  }
+  return __first + (__comp(__value, *__first) ? 0 : 1);
+}
+
 template <class _ForwardIterator, class _Tp, class _Compare>
 _LIBCPP_NODISCARD_EXT inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _ForwardIterator
 upper_bound(_ForwardIterator __first, _ForwardIterator __last, const _Tp& __value, _Compare __comp) {
   static_assert(is_copy_constructible<_ForwardIterator>::value,
                 "Iterator has to be copy constructible");
-  return std::__upper_bound<_ClassicAlgPolicy>(
-      std::move(__first), std::move(__last), __value, std::move(__comp), std::__identity());
+  return std::__rewrap_iter(
+      __first,
+      std::__upper_bound<_ClassicAlgPolicy>(
+          std::__unwrap_iter(__first), std::__unwrap_iter(__last), __value, std::move(__comp), std::__identity()));
 }
 
 template <class _ForwardIterator, class _Tp>
@@ -39,7 +39,11 @@ template <class _Key,
           bool /*useArray*/>
 class _BMSkipTable;
 
-// General case for BM data searching; use a map
+// Both searchers store in the table the distance between the last occurrence of each element of the pattern
+// and its end, which is the pattern length for the elements that don't occur in it.
+
+// General case for BM data searching; use a map. It is built once by the constructor of a searcher and
+// shared by its copies, which only read it.
 template <class _Key,
           class _Value,
           class _Hash,
@@ -49,26 +53,29 @@ private:
   using value_type = _Value;
   using key_type = _Key;
 
-  const value_type __default_value_;
-  unordered_map<_Key, _Value, _Hash, _BinaryPredicate> __table_;
+  value_type __default_value_;
+  shared_ptr<unordered_map<_Key, _Value, _Hash, _BinaryPredicate>> __table_;
 
 public:
   _LIBCPP_HIDE_FROM_ABI
   explicit _BMSkipTable(size_t __sz, value_type __default_value, _Hash __hash, _BinaryPredicate __pred)
       : __default_value_(__default_value),
-        __table_(__sz, __hash, __pred) {}
+        __table_(std::make_shared<unordered_map<_Key, _Value, _Hash, _BinaryPredicate>>(__sz, __hash, __pred)) {}
 
   _LIBCPP_HIDE_FROM_ABI void insert(const key_type& __key, value_type __val) {
-    __table_[__key] = __val;
+    (*__table_)[__key] = __val;
   }
 
   _LIBCPP_HIDE_FROM_ABI value_type operator[](const key_type& __key) const {
-    auto __it = __table_.find(__key);
-    return __it == __table_.end() ? __default_value_ : __it->second;
+    auto __it = __table_->find(__key);
+    return __it == __table_->end() ? __default_value_ : __it->second;
   }
 };
 
-// Special case small numeric values; use an array
+// Special case small numeric values; use an array. Its entries saturate at the largest unsigned char, which
+// only makes the searchers skip less than they could after a mismatch with a pattern that long, and keeps
+// the table small enough to be held by value: searchers don't allocate it, and are copied without touching
+// a reference count.
 template <class _Key,
           class _Value,
           class _Hash,
@@ -79,16 +86,21 @@ private:
   using key_type = _Key;
 
   using unsigned_key_type = make_unsigned_t<key_type>;
-  std::array<value_type, 256> __table_;
+  std::array<unsigned char, 256> __table_;
   static_assert(numeric_limits<unsigned_key_type>::max() < 256);
 
+  _LIBCPP_HIDE_FROM_ABI static unsigned char __saturate(value_type __val) {
+    return __val < numeric_limits<unsigned char>::max() ? static_cast<unsigned char>(__val)
+                                                        : numeric_limits<unsigned char>::max();
+  }
+
 public:
   _LIBCPP_HIDE_FROM_ABI explicit _BMSkipTable(size_t, value_type __default_value, _Hash, _BinaryPredicate) {
-    std::fill_n(__table_.data(), __table_.size(), __default_value);
+    std::fill_n(__table_.data(), __table_.size(), __saturate(__default_value));
   }
 
   _LIBCPP_HIDE_FROM_ABI void insert(key_type __key, value_type __val) {
-    __table_[static_cast<unsigned_key_type>(__key)] = __val;
+    __table_[static_cast<unsigned_key_type>(__key)] = __saturate(__val);
   }
 
   _LIBCPP_HIDE_FROM_ABI value_type operator[](key_type __key) const {
@@ -96,6 +108,16 @@ public:
   }
 };
 
+// The array is used for the character types, and the other integer types of the same size, whenever the
+// searcher compares their values.
+template <class _Key, class _Hash, class _BinaryPredicate>
+inline constexpr bool __bm_use_array_v = is_integral_v<_Key>
+                                      && sizeof(_Key) == 1
+                                      && !is_same_v<_Key, bool>
+                                      && is_same_v<_Hash, hash<_Key>>
+                                      && (is_same_v<_BinaryPredicate, equal_to<>>
+                                       || is_same_v<_BinaryPredicate, equal_to<_Key>>);
+
 template <class _RandomAccessIterator1,
           class _Hash = hash<typename iterator_traits<_RandomAccessIterator1>::value_type>,
           class _BinaryPredicate = equal_to<>>
@@ -107,10 +129,7 @@ private:
                                          difference_type,
                                          _Hash,
                                          _BinaryPredicate,
-                                         is_integral_v<value_type>
-                                      && sizeof(value_type) == 1
-                                      && is_same_v<_Hash, hash<value_type>>
-                                      && is_same_v<_BinaryPredicate, equal_to<>>>;
+                                         __bm_use_array_v<value_type, _Hash, _BinaryPredicate>>;
 
 public:
   boyer_moore_searcher(_RandomAccessIterator1 __first,
@@ -121,12 +140,12 @@ public:
       __last_(__last),
       __pred_(__pred),
       __pattern_length_(__last - __first),
-      __skip_table_(std::make_shared<__skip_table_type>(__pattern_length_, -1, __hash, __pred_)),
+      __skip_table_(__pattern_length_, __pattern_length_, __hash, __pred_),
       __suffix_(std::__allocate_shared_unbounded_array<difference_type[]>(
           allocator<difference_type>(), __pattern_length_ + 1)) {
     difference_type __i = 0;
     while (__first != __last) {
-      __skip_table_->insert(*__first, __i);
+      __skip_table_.insert(*__first, __pattern_length_ - 1 - __i);
       ++__first;
       ++__i;
     }
@@ -154,7 +173,7 @@ private:
   _RandomAccessIterator1 __last_;
   _BinaryPredicate __pred_;
   difference_type __pattern_length_;
-  shared_ptr<__skip_table_type> __skip_table_;
+  __skip_table_type __skip_table_;
   shared_ptr<difference_type[]> __suffix_;
 
   template <class _RandomAccessIterator2>
@@ -162,7 +181,6 @@ private:
   __search(_RandomAccessIterator2 __f, _RandomAccessIterator2 __l) const {
     _RandomAccessIterator2 __current = __f;
     const _RandomAccessIterator2 __last = __l - __pattern_length_;
-    const __skip_table_type& __skip_table = *__skip_table_;
 
     while (__current <= __last) {
       difference_type __j = __pattern_length_;
@@ -172,7 +190,9 @@ private:
           return std::make_pair(__current, __current + __pattern_length_);
       }
 
-      difference_type __k = __skip_table[__current[__j - 1]];
+      // The last occurrence of the mismatched element in the pattern, or -1. A saturated distance gives a
+      // later position, and a shorter shift.
+      difference_type __k = __pattern_length_ - 1 - __skip_table_[__current[__j - 1]];
       difference_type __m = __j - __k - 1;
       if (__k < __j && __m > __suffix_[__j])
         __current += __m;
@@ -235,10 +255,7 @@ private:
                                          difference_type,
                                          _Hash,
                                          _BinaryPredicate,
-                                         is_integral_v<value_type>
-                                      && sizeof(value_type) == 1
-                                      && is_same_v<_Hash, hash<value_type>>
-                                      && is_same_v<_BinaryPredicate, equal_to<>>>;
+                                         __bm_use_array_v<value_type, _Hash, _BinaryPredicate>>;
 public:
   boyer_moore_horspool_searcher(_RandomAccessIterator1 __first,
                                 _RandomAccessIterator1 __last,
@@ -248,13 +265,13 @@ public:
       __last_(__last),
       __pred_(__pred),
       __pattern_length_(__last - __first),
-      __skip_table_(std::make_shared<__skip_table_type>(__pattern_length_, __pattern_length_, __hash, __pred_)) {
+      __skip_table_(__pattern_length_, __pattern_length_, __hash, __pred_) {
     if (__first == __last)
       return;
     --__last;
     difference_type __i = 0;
     while (__first != __last) {
-      __skip_table_->insert(*__first, __pattern_length_ - 1 - __i);
+      __skip_table_.insert(*__first, __pattern_length_ - 1 - __i);
       ++__first;
       ++__i;
     }
@@ -282,14 +299,13 @@ private:
   _RandomAccessIterator1 __last_;
   _BinaryPredicate __pred_;
   difference_type __pattern_length_;
-  shared_ptr<__skip_table_type> __skip_table_;
+  __skip_table_type __skip_table_;
 
   template <class _RandomAccessIterator2>
   pair<_RandomAccessIterator2, _RandomAccessIterator2>
   __search(_RandomAccessIterator2 __f, _RandomAccessIterator2 __l) const {
     _RandomAccessIterator2 __current = __f;
     const _RandomAccessIterator2 __last = __l - __pattern_length_;
-    const __skip_table_type& __skip_table = *__skip_table_;
 
     while (__current <= __last) {
       difference_type __j = __pattern_length_;
@@ -298,7 +314,7 @@ private:
         if (__j == 0)
           return std::make_pair(__current, __current + __pattern_length_);
       }
-      __current += __skip_table[__current[__pattern_length_ - 1]];
+      __current += __skip_table_[__current[__pattern_length_ - 1]];
     }
     return std::make_pair(__l, __l);
   }
@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ITERATOR_SEGMENTED_ITERATOR_H
+#define _LIBCPP___ITERATOR_SEGMENTED_ITERATOR_H
+
+// Segmented iterators are iterators over (not necessarily contiguous) sub-ranges, like the blocks of a
+// deque. Algorithms can go through such a range one segment at a time, with the iterators of the segments,
+// which are often pointers, instead of paying for the bookkeeping of the segmented iterator at every
+// element.
+//
+// A segmented iterator type _Iterator is declared by specializing __segmented_iterator_traits<_Iterator>
+// with these members:
+//
+// struct __segmented_iterator_traits<_Iterator> {
+//   typedef ... __segment_iterator; // An iterator over the segments
+//   typedef ... __local_iterator;   // An iterator over the elements of a segment
+//
+//   // Returns the segment __it is in, or the one after its end if __it is the end of a range.
+//   static __segment_iterator __segment(_Iterator __it);
+//   // Returns __it as an iterator of the segment it is in.
+//   static __local_iterator __local(_Iterator __it);
+//   // Return the beginning and the end of a segment.
+//   static __local_iterator __begin(__segment_iterator __segment);
+//   static __local_iterator __end(__segment_iterator __segment);
+//   // Returns the segmented iterator to __local, which must be an element of __segment.
+//   static _Iterator __compose(__segment_iterator __segment, __local_iterator __local);
+// };
+
+#include <__config>
+#include <__type_traits/integral_constant.h>
+#include <cstddef>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+template <class _Iterator>
+struct __segmented_iterator_traits;
+
+template <class _Tp, size_t = 0>
+struct __has_specialization : false_type {};
+
+template <class _Tp>
+struct __has_specialization<_Tp, sizeof(_Tp) * 0> : true_type {};
+
+template <class _Iterator>
+struct __is_segmented_iterator : __has_specialization<__segmented_iterator_traits<_Iterator> > {};
+
+// Calls __func with the beginning and the end of each of the segments that make up [__first, __last), in
+// order, as local iterators.
+template <class _SegmentedIterator, class _Functor>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX11 void
+__for_each_segment(_SegmentedIterator __first, _SegmentedIterator __last, _Functor& __func) {
+  typedef __segmented_iterator_traits<_SegmentedIterator> _Traits;
+  typename _Traits::__segment_iterator __sfirst = _Traits::__segment(__first);
+  typename _Traits::__segment_iterator __slast  = _Traits::__segment(__last);
+
+  // The range is in a single segment, and may neither start at its beginning nor end at its end.
+  if (__sfirst == __slast) {
+    __func(_Traits::__local(__first), _Traits::__local(__last));
+    return;
+  }
+
+  __func(_Traits::__local(__first), _Traits::__end(__sfirst));
+  for (++__sfirst; __sfirst != __slast; ++__sfirst)
+    __func(_Traits::__begin(__sfirst), _Traits::__end(__sfirst));
+  __func(_Traits::__begin(__slast), _Traits::__local(__last));
+}
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP___ITERATOR_SEGMENTED_ITERATOR_H
@@ -13,6 +13,7 @@
 #include <__config>
 #include <__memory/construct_at.h>
 #include <__memory/pointer_traits.h>
+#include <__type_traits/is_trivially_relocatable.h>
 #include <__utility/forward.h>
 #include <limits>
 #include <type_traits>
@@ -396,6 +397,21 @@ struct __is_cpp17_copy_insertable<_Alloc, __enable_if_t<
     : __is_cpp17_move_insertable<_Alloc>
 { };
 
+// __is_trivially_relocatable_allocator
+//
+// Moving a container that owns its storage through _Alloc only copies the allocator and the pointers
+// to the storage, so the container is trivially relocatable when they are. Move-assigning it copies the
+// elements instead when the allocators may differ and don't propagate, so those allocators are left out.
+template <class _Alloc>
+struct __is_trivially_relocatable_allocator
+    : integral_constant<bool,
+        __libcpp_is_trivially_relocatable<_Alloc>::value &&
+        __libcpp_is_trivially_relocatable<typename allocator_traits<_Alloc>::pointer>::value &&
+        (allocator_traits<_Alloc>::propagate_on_container_move_assignment::value ||
+         allocator_traits<_Alloc>::is_always_equal::value)
+    >
+{ };
+
 #undef _LIBCPP_ALLOCATOR_TRAITS_HAS_XXX
 
 _LIBCPP_END_NAMESPACE_STD
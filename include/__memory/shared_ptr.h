@@ -425,6 +425,10 @@ public:
     typedef _Tp element_type;
 #endif
 
+    // Moving a shared_ptr leaves the original empty, so the use count doesn't change when it is
+    // relocated.
+    typedef shared_ptr __trivially_relocatable;
+
 private:
     element_type*      __ptr_;
     __shared_weak_count* __cntrl_;
@@ -1393,6 +1397,8 @@ public:
     typedef _Tp element_type;
 #endif
 
+    typedef weak_ptr __trivially_relocatable;
+
 private:
     element_type*        __ptr_;
     __shared_weak_count* __cntrl_;
@@ -22,10 +22,12 @@
 
 _LIBCPP_BEGIN_NAMESPACE_STD
 
+// The implementation of get_temporary_buffer, for the algorithms of the library to use without
+// the deprecation warning.
 template <class _Tp>
-_LIBCPP_NODISCARD_EXT _LIBCPP_NO_CFI _LIBCPP_DEPRECATED_IN_CXX17
+_LIBCPP_NO_CFI _LIBCPP_HIDE_FROM_ABI
 pair<_Tp*, ptrdiff_t>
-get_temporary_buffer(ptrdiff_t __n) _NOEXCEPT
+__get_temporary_buffer(ptrdiff_t __n) _NOEXCEPT
 {
     pair<_Tp*, ptrdiff_t> __r(0, 0);
     const ptrdiff_t __m = (~ptrdiff_t(0) ^
@@ -67,6 +69,14 @@ get_temporary_buffer(ptrdiff_t __n) _NOEXCEPT
     return __r;
 }
 
+template <class _Tp>
+_LIBCPP_NODISCARD_EXT _LIBCPP_NO_CFI _LIBCPP_DEPRECATED_IN_CXX17
+pair<_Tp*, ptrdiff_t>
+get_temporary_buffer(ptrdiff_t __n) _NOEXCEPT
+{
+    return _VSTD::__get_temporary_buffer<_Tp>(__n);
+}
+
 template <class _Tp>
 inline _LIBCPP_INLINE_VISIBILITY _LIBCPP_DEPRECATED_IN_CXX17
 void return_temporary_buffer(_Tp* __p) _NOEXCEPT
@@ -76,10 +86,73 @@ void return_temporary_buffer(_Tp* __p) _NOEXCEPT
 
 struct __return_temporary_buffer
 {
-_LIBCPP_SUPPRESS_DEPRECATED_PUSH
     template <class _Tp>
-    _LIBCPP_INLINE_VISIBILITY void operator()(_Tp* __p) const {_VSTD::return_temporary_buffer(__p);}
-_LIBCPP_SUPPRESS_DEPRECATED_POP
+    _LIBCPP_INLINE_VISIBILITY void operator()(_Tp* __p) const
+    {_VSTD::__libcpp_deallocate_unsized((void*)__p, _LIBCPP_ALIGNOF(_Tp));}
+};
+
+// Where stable_sort, stable_partition and inplace_merge get their buffers from. The memory_resource
+// overloads of <experimental/algorithm> provide another source with the same members.
+struct __temporary_buffer_source
+{
+    template <class _Tp>
+    _LIBCPP_HIDE_FROM_ABI pair<_Tp*, ptrdiff_t> __get_buffer(ptrdiff_t __n) const _NOEXCEPT
+    {return _VSTD::__get_temporary_buffer<_Tp>(__n);}
+
+    template <class _Tp>
+    _LIBCPP_HIDE_FROM_ABI void __return_buffer(_Tp* __p, ptrdiff_t) const _NOEXCEPT
+    {_VSTD::__libcpp_deallocate_unsized((void*)__p, _LIBCPP_ALIGNOF(_Tp));}
+};
+
+// Uninitialized storage for up to __n elements, taken from __source. Requests that fit in a
+// kilobyte are served from storage inside the object, without allocating, and so are requests
+// that __source cannot satisfy at all: the merging algorithms still merge blocks of that size
+// through the buffer, rather than falling back to rotating every element into place.
+template <class _Tp, class _Source = __temporary_buffer_source>
+class __temporary_buffer
+{
+    static const ptrdiff_t __inline_size = 1024 / sizeof(_Tp);
+
+    _Source __source_;
+    pair<_Tp*, ptrdiff_t> __allocated_;
+    _ALIGNAS_TYPE(_Tp) unsigned char __inline_[__inline_size > 0 ? __inline_size * sizeof(_Tp) : 1];
+
+    __temporary_buffer(const __temporary_buffer&);
+    __temporary_buffer& operator=(const __temporary_buffer&);
+
+public:
+    _LIBCPP_HIDE_FROM_ABI __temporary_buffer(_Source __source, ptrdiff_t __n)
+        : __source_(__source), __allocated_(nullptr, 0)
+    {
+        if (__n <= __inline_size)
+            return;
+        __allocated_ = __source_.template __get_buffer<_Tp>(__n);
+        if (__allocated_.first != nullptr && __allocated_.second <= __inline_size)
+        {
+            __source_.__return_buffer(__allocated_.first, __allocated_.second);
+            __allocated_ = pair<_Tp*, ptrdiff_t>(nullptr, 0);
+        }
+    }
+
+    _LIBCPP_HIDE_FROM_ABI ~__temporary_buffer()
+    {
+        if (__allocated_.first != nullptr)
+            __source_.__return_buffer(__allocated_.first, __allocated_.second);
+    }
+
+    _LIBCPP_HIDE_FROM_ABI _Tp* __data() _NOEXCEPT
+    {
+        if (__allocated_.first != nullptr)
+            return __allocated_.first;
+        return reinterpret_cast<_Tp*>(__inline_);
+    }
+
+    _LIBCPP_HIDE_FROM_ABI ptrdiff_t __size() const _NOEXCEPT
+    {
+        if (__allocated_.first != nullptr)
+            return __allocated_.second;
+        return __inline_size;
+    }
 };
 
 _LIBCPP_END_NAMESPACE_STD
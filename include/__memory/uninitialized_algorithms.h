@@ -21,6 +21,7 @@
 #include <__memory/pointer_traits.h>
 #include <__memory/voidify.h>
 #include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/is_trivially_relocatable.h>
 #include <__utility/move.h>
 #include <__utility/pair.h>
 #include <__utility/transaction.h>
@@ -636,6 +637,31 @@ __uninitialized_allocator_move_if_noexcept(_Alloc&, _Iter1 __first1, _Iter1 __la
 }
 #endif // _LIBCPP_COMPILER_GCC
 
+template <class _Alloc, class _Type>
+struct __allocator_has_trivial_destroy : _Not<__has_destroy<_Alloc, _Type*> > {};
+
+template <class _Type, class _Up>
+struct __allocator_has_trivial_destroy<allocator<_Type>, _Up> : true_type {};
+
+// Whether the elements of a container using _Alloc can be relocated by copying their bytes. That skips the
+// construct and destroy members of the allocator, so it has to use the default ones.
+template <class _Alloc, class _Type>
+struct __allocator_has_trivial_relocate
+    : integral_constant<bool,
+                        __libcpp_is_trivially_relocatable<_Type>::value &&
+                            __allocator_has_trivial_move_construct<_Alloc, _Type>::value &&
+                            __allocator_has_trivial_destroy<_Alloc, _Type>::value> {};
+
+// Copy the bytes of the trivially relocatable objects [__first, __last) to __result, which may overlap them. The
+// objects at __result must be uninitialized, and the ones in [__first, __last) that aren't overwritten must be
+// treated as uninitialized afterwards. memmove copies the tags of capabilities on CHERI, so pointers stay valid.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI void __relocate_bytes(_Tp* __first, _Tp* __last, _Tp* __result) _NOEXCEPT {
+  if (__first != __last)
+    ::__builtin_memmove(static_cast<void*>(__result), static_cast<const void*>(__first),
+                        static_cast<size_t>(__last - __first) * sizeof(_Tp));
+}
+
 _LIBCPP_END_NAMESPACE_STD
 
 #endif // _LIBCPP___MEMORY_UNINITIALIZED_ALGORITHMS_H
@@ -16,6 +16,7 @@
 #include <__memory/allocator_traits.h> // __pointer
 #include <__memory/auto_ptr.h>
 #include <__memory/compressed_pair.h>
+#include <__type_traits/is_trivially_relocatable.h>
 #include <__utility/forward.h>
 #include <__utility/move.h>
 #include <cstddef>
@@ -115,6 +116,14 @@ public:
   static_assert(!is_rvalue_reference<deleter_type>::value,
                 "the specified deleter type cannot be an rvalue reference");
 
+  // A unique_ptr is trivially relocatable when its pointer and deleter are: the moved-from pointer is
+  // null, so it is never deleted.
+  typedef __conditional_t<__libcpp_is_trivially_relocatable<pointer>::value &&
+                              __libcpp_is_trivially_relocatable<deleter_type>::value,
+                          unique_ptr,
+                          void>
+      __trivially_relocatable;
+
 private:
   __compressed_pair<pointer, deleter_type> __ptr_;
 
@@ -319,6 +328,12 @@ public:
   typedef _Dp deleter_type;
   typedef typename __pointer<_Tp, deleter_type>::type pointer;
 
+  typedef __conditional_t<__libcpp_is_trivially_relocatable<pointer>::value &&
+                              __libcpp_is_trivially_relocatable<deleter_type>::value,
+                          unique_ptr,
+                          void>
+      __trivially_relocatable;
+
 private:
   __compressed_pair<pointer, deleter_type> __ptr_;
 
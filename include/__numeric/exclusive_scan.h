@@ -10,8 +10,13 @@
 #ifndef _LIBCPP___NUMERIC_EXCLUSIVE_SCAN_H
 #define _LIBCPP___NUMERIC_EXCLUSIVE_SCAN_H
 
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__functional/operations.h>
+#include <__numeric/inclusive_scan.h>
+#include <__numeric/simd_arithmetic.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/is_constant_evaluated.h>
 #include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -23,8 +28,8 @@ _LIBCPP_BEGIN_NAMESPACE_STD
 #if _LIBCPP_STD_VER > 14
 
 template <class _InputIterator, class _OutputIterator, class _Tp, class _BinaryOp>
-_LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator
-exclusive_scan(_InputIterator __first, _InputIterator __last, _OutputIterator __result, _Tp __init, _BinaryOp __b) {
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator
+__exclusive_scan(_InputIterator __first, _InputIterator __last, _OutputIterator __result, _Tp __init, _BinaryOp& __b) {
   if (__first != __last) {
     _Tp __tmp(__b(__init, *__first));
     while (true) {
@@ -40,6 +45,28 @@ exclusive_scan(_InputIterator __first, _InputIterator __last, _OutputIterator __
   return __result;
 }
 
+#  ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+template <class _ValueT,
+          class _OutValueT,
+          class _Tp,
+          class _BinaryOp,
+          __enable_if_t<__can_scan_contiguous<_ValueT, _OutValueT, _Tp, _BinaryOp>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutValueT*
+__exclusive_scan(_ValueT* __first, _ValueT* __last, _OutValueT* __result, _Tp __init, _BinaryOp& __b) {
+  if (__libcpp_is_constant_evaluated())
+    return _VSTD::__exclusive_scan<_ValueT*, _OutValueT*>(__first, __last, __result, _VSTD::move(__init), __b);
+  return _VSTD::__simd_exclusive_scan<_Tp>(__first, __last, __result, __init, __b);
+}
+#  endif
+
+template <class _InputIterator, class _OutputIterator, class _Tp, class _BinaryOp>
+_LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator
+exclusive_scan(_InputIterator __first, _InputIterator __last, _OutputIterator __result, _Tp __init, _BinaryOp __b) {
+  return _VSTD::__rewrap_iter(__result,
+                              _VSTD::__exclusive_scan(_VSTD::__unwrap_iter(__first), _VSTD::__unwrap_iter(__last),
+                                                      _VSTD::__unwrap_iter(__result), _VSTD::move(__init), __b));
+}
+
 template <class _InputIterator, class _OutputIterator, class _Tp>
 _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator
 exclusive_scan(_InputIterator __first, _InputIterator __last, _OutputIterator __result, _Tp __init) {
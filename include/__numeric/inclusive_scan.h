@@ -10,9 +10,16 @@
 #ifndef _LIBCPP___NUMERIC_INCLUSIVE_SCAN_H
 #define _LIBCPP___NUMERIC_INCLUSIVE_SCAN_H
 
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__functional/operations.h>
 #include <__iterator/iterator_traits.h>
+#include <__numeric/simd_arithmetic.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/remove_const.h>
 #include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -24,8 +31,8 @@ _LIBCPP_BEGIN_NAMESPACE_STD
 #if _LIBCPP_STD_VER > 14
 
 template <class _InputIterator, class _OutputIterator, class _Tp, class _BinaryOp>
-_LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator
-inclusive_scan(_InputIterator __first, _InputIterator __last, _OutputIterator __result, _BinaryOp __b, _Tp __init) {
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator
+__inclusive_scan(_InputIterator __first, _InputIterator __last, _OutputIterator __result, _BinaryOp& __b, _Tp __init) {
   for (; __first != __last; ++__first, (void)++__result) {
     __init = __b(__init, *__first);
     *__result = __init;
@@ -33,6 +40,35 @@ inclusive_scan(_InputIterator __first, _InputIterator __last, _OutputIterator __
   return __result;
 }
 
+#  ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+// Contiguous ranges of integers are scanned with plus and multiplies to contiguous ranges a vector at a
+// time.
+template <class _ValueT, class _OutValueT, class _Tp, class _BinaryOp>
+struct __can_scan_contiguous
+    : integral_constant<bool, is_same<typename remove_const<_ValueT>::type, _Tp>::value &&
+                                  is_same<_OutValueT, _Tp>::value && __can_scan_vectorized<_Tp, _BinaryOp>::value> {};
+
+template <class _ValueT,
+          class _OutValueT,
+          class _Tp,
+          class _BinaryOp,
+          __enable_if_t<__can_scan_contiguous<_ValueT, _OutValueT, _Tp, _BinaryOp>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutValueT*
+__inclusive_scan(_ValueT* __first, _ValueT* __last, _OutValueT* __result, _BinaryOp& __b, _Tp __init) {
+  if (__libcpp_is_constant_evaluated())
+    return _VSTD::__inclusive_scan<_ValueT*, _OutValueT*>(__first, __last, __result, __b, __init);
+  return _VSTD::__simd_inclusive_scan<_Tp>(__first, __last, __result, __init, __b);
+}
+#  endif
+
+template <class _InputIterator, class _OutputIterator, class _Tp, class _BinaryOp>
+_LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator
+inclusive_scan(_InputIterator __first, _InputIterator __last, _OutputIterator __result, _BinaryOp __b, _Tp __init) {
+  return _VSTD::__rewrap_iter(__result,
+                              _VSTD::__inclusive_scan(_VSTD::__unwrap_iter(__first), _VSTD::__unwrap_iter(__last),
+                                                      _VSTD::__unwrap_iter(__result), __b, _VSTD::move(__init)));
+}
+
 template <class _InputIterator, class _OutputIterator, class _BinaryOp>
 _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _OutputIterator
 inclusive_scan(_InputIterator __first, _InputIterator __last, _OutputIterator __result, _BinaryOp __b) {
@@ -10,9 +10,18 @@
 #ifndef _LIBCPP___NUMERIC_REDUCE_H
 #define _LIBCPP___NUMERIC_REDUCE_H
 
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
+#include <__functional/identity.h>
 #include <__functional/operations.h>
 #include <__iterator/iterator_traits.h>
+#include <__numeric/simd_arithmetic.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/remove_const.h>
+#include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -22,13 +31,54 @@ _LIBCPP_BEGIN_NAMESPACE_STD
 
 #if _LIBCPP_STD_VER > 14
 template <class _InputIterator, class _Tp, class _BinaryOp>
-_LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp reduce(_InputIterator __first, _InputIterator __last,
-                                                                   _Tp __init, _BinaryOp __b) {
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp
+__reduce(_InputIterator __first, _InputIterator __last, _Tp __init, _BinaryOp& __b) {
   for (; __first != __last; ++__first)
     __init = __b(__init, *__first);
   return __init;
 }
 
+template <class _Tp, class _BinaryOp>
+_LIBCPP_HIDE_FROM_ABI _Tp
+__reduce_contiguous(const _Tp* __first, const _Tp* __last, _Tp __init, _BinaryOp& __b, false_type /* vectorize */) {
+  __identity __u;
+  return _VSTD::__reduce_with_accumulators(__first, __last, _VSTD::move(__init), __b, __u);
+}
+
+#  ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+template <class _Tp, class _BinaryOp>
+_LIBCPP_HIDE_FROM_ABI _Tp
+__reduce_contiguous(const _Tp* __first, const _Tp* __last, _Tp __init, _BinaryOp& __b, true_type /* vectorize */) {
+  return _VSTD::__simd_reduce(__first, __last, __init, __b);
+}
+#  endif
+
+// Contiguous ranges of arithmetic types are reduced with plus and multiplies a vector at a time, or in
+// several accumulators for the floating-point types that don't fit in vectors.
+template <class _ValueT, class _Tp, class _BinaryOp>
+struct __can_reduce_contiguous
+    : integral_constant<bool, is_same<typename remove_const<_ValueT>::type, _Tp>::value &&
+                                  (__can_reduce_vectorized<_Tp, _BinaryOp>::value ||
+                                   __can_reduce_with_accumulators<_Tp, _BinaryOp>::value)> {};
+
+template <class _ValueT,
+          class _Tp,
+          class _BinaryOp,
+          __enable_if_t<__can_reduce_contiguous<_ValueT, _Tp, _BinaryOp>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp
+__reduce(_ValueT* __first, _ValueT* __last, _Tp __init, _BinaryOp& __b) {
+  if (__libcpp_is_constant_evaluated())
+    return _VSTD::__reduce<_ValueT*>(__first, __last, _VSTD::move(__init), __b);
+  return _VSTD::__reduce_contiguous<_Tp>(
+      __first, __last, _VSTD::move(__init), __b, __can_reduce_vectorized<_Tp, _BinaryOp>());
+}
+
+template <class _InputIterator, class _Tp, class _BinaryOp>
+_LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp reduce(_InputIterator __first, _InputIterator __last,
+                                                                   _Tp __init, _BinaryOp __b) {
+  return _VSTD::__reduce(_VSTD::__unwrap_iter(__first), _VSTD::__unwrap_iter(__last), _VSTD::move(__init), __b);
+}
+
 template <class _InputIterator, class _Tp>
 _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp reduce(_InputIterator __first, _InputIterator __last,
                                                                    _Tp __init) {
@@ -0,0 +1,301 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___NUMERIC_SIMD_ARITHMETIC_H
+#define _LIBCPP___NUMERIC_SIMD_ARITHMETIC_H
+
+#include <__algorithm/simd_utils.h>
+#include <__config>
+#include <__functional/operations.h>
+#include <__tuple>
+#include <__type_traits/conditional.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_floating_point.h>
+#include <__type_traits/is_integral.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/is_volatile.h>
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER > 14
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// The operations reduce, transform_reduce and the scans apply to a whole vector, or to several scalar
+// accumulators, when they are given plus or multiplies: both are associative and commutative on
+// integers, and reduce and transform_reduce may regroup and reorder their operands for any operation.
+struct __simd_add {
+  static const int __neutral = 0;
+
+  template <class _Tp>
+  _LIBCPP_HIDE_FROM_ABI static _Tp __apply(_Tp __x, _Tp __y) {
+    return __x + __y;
+  }
+};
+
+struct __simd_multiply {
+  static const int __neutral = 1;
+
+  template <class _Tp>
+  _LIBCPP_HIDE_FROM_ABI static _Tp __apply(_Tp __x, _Tp __y) {
+    return __x * __y;
+  }
+};
+
+// The operation among the above that _BinaryOp performs on two values of type _Tp, or void.
+template <class _BinaryOp, class _Tp>
+struct __simd_arithmetic_operation { typedef void type; };
+template <class _Tp>
+struct __simd_arithmetic_operation<plus<_Tp>, _Tp> { typedef __simd_add type; };
+template <class _Tp>
+struct __simd_arithmetic_operation<plus<void>, _Tp> { typedef __simd_add type; };
+template <class _Tp>
+struct __simd_arithmetic_operation<multiplies<_Tp>, _Tp> { typedef __simd_multiply type; };
+template <class _Tp>
+struct __simd_arithmetic_operation<multiplies<void>, _Tp> { typedef __simd_multiply type; };
+
+template <class _BinaryOp, class _Tp>
+struct __is_simd_arithmetic_operation
+    : integral_constant<bool, !is_same<typename __simd_arithmetic_operation<_BinaryOp, _Tp>::type, void>::value> {};
+
+// Whether reduce and transform_reduce can reduce the (transformed) elements of a range into a _Tp with
+// _BinaryOp in several accumulators, which keeps several operations in flight. Floating-point operations take several
+// cycles each, but a single accumulator must wait for the previous one to complete, while the compiler
+// already reorders integer reductions by itself.
+template <class _Tp, class _BinaryOp>
+struct __can_reduce_with_accumulators
+    : integral_constant<bool,
+                        is_floating_point<_Tp>::value && __is_simd_arithmetic_operation<_BinaryOp, _Tp>::value> {};
+
+// Returns the generalized sum with __b of __init and the __u(*__i) for the __i in [__first, __last), the
+// last two of which must be convertible to _Tp, in four accumulators. Like the parallel backends, each
+// accumulator is seeded with two transformed elements, so that __init is only accounted for once.
+template <class _RandomAccessIterator, class _Tp, class _BinaryOp, class _UnaryOp>
+_LIBCPP_HIDE_FROM_ABI _Tp __reduce_with_accumulators(
+    _RandomAccessIterator __first, _RandomAccessIterator __last, _Tp __init, _BinaryOp& __b, _UnaryOp& __u) {
+  if (__last - __first >= 8) {
+    _Tp __acc0(__b(__u(__first[0]), __u(__first[1])));
+    _Tp __acc1(__b(__u(__first[2]), __u(__first[3])));
+    _Tp __acc2(__b(__u(__first[4]), __u(__first[5])));
+    _Tp __acc3(__b(__u(__first[6]), __u(__first[7])));
+    for (__first += 8; __last - __first >= 4; __first += 4) {
+      __acc0 = __b(__acc0, __u(__first[0]));
+      __acc1 = __b(__acc1, __u(__first[1]));
+      __acc2 = __b(__acc2, __u(__first[2]));
+      __acc3 = __b(__acc3, __u(__first[3]));
+    }
+    __acc0 = __b(__acc0, __acc1);
+    __acc2 = __b(__acc2, __acc3);
+    __init = __b(__init, __b(__acc0, __acc2));
+  }
+  for (; __first != __last; ++__first)
+    __init = __b(__init, __u(*__first));
+  return __init;
+}
+
+#  ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+
+// Whether values of type _Tp can be added and multiplied a vector at a time.
+template <class _Tp>
+struct __has_simd_arithmetic
+    : integral_constant<bool, is_integral<_Tp>::value && !is_same<_Tp, bool>::value && !is_volatile<_Tp>::value &&
+                                  sizeof(_Tp) <= sizeof(uint64_t)> {};
+template <>
+struct __has_simd_arithmetic<float> : true_type {};
+#    ifdef _LIBCPP_ALGORITHM_VECTOR_HAS_DOUBLE
+template <>
+struct __has_simd_arithmetic<double> : true_type {};
+#    endif
+
+// A vector in which values of type _Tp are added and multiplied, and the number of elements of type _Tp
+// it holds. Integers are held in unsigned lanes, which wrap around like two's complement integers rather
+// than overflow, so the low bits of their sums and products are the same whatever their order.
+template <class _Tp>
+struct __simd_arithmetic_vector
+    : __conditional_t<is_floating_point<_Tp>::value, __simd_ordered_vector<_Tp>, __simd_vector<_Tp> > {};
+
+// Whether reduce and transform_reduce can reduce contiguous ranges of _Tp into a _Tp with _BinaryOp a
+// vector at a time.
+template <class _Tp, class _BinaryOp>
+struct __can_reduce_vectorized
+    : integral_constant<bool,
+                        __has_simd_arithmetic<_Tp>::value && __is_simd_arithmetic_operation<_BinaryOp, _Tp>::value> {};
+
+// Whether inclusive_scan and exclusive_scan can scan contiguous ranges of _Tp with _BinaryOp a vector at a
+// time. Floating-point scans are left in order, so that they round like partial_sum.
+template <class _Tp, class _BinaryOp>
+struct __can_scan_vectorized
+    : integral_constant<bool, __can_reduce_vectorized<_Tp, _BinaryOp>::value && is_integral<_Tp>::value> {};
+
+// Returns the lane by lane generalized sum with _Op of __load(0), ..., __load(__vectors - 1). __vectors
+// must not be zero. Four accumulators keep four operations in flight.
+template <class _Op, class _Vec, class _Load>
+_LIBCPP_HIDE_FROM_ABI _Vec __simd_reduce_vectors(size_t __vectors, _Load __load) {
+  _Vec __acc0 = __load(0);
+  size_t __i  = 1;
+  if (__vectors >= 4) {
+    _Vec __acc1 = __load(1), __acc2 = __load(2), __acc3 = __load(3);
+    for (__i = 4; __vectors - __i >= 4; __i += 4) {
+      __acc0 = _Op::__apply(__acc0, __load(__i));
+      __acc1 = _Op::__apply(__acc1, __load(__i + 1));
+      __acc2 = _Op::__apply(__acc2, __load(__i + 2));
+      __acc3 = _Op::__apply(__acc3, __load(__i + 3));
+    }
+    __acc0 = _Op::__apply(_Op::__apply(__acc0, __acc1), _Op::__apply(__acc2, __acc3));
+  }
+  for (; __i != __vectors; ++__i)
+    __acc0 = _Op::__apply(__acc0, __load(__i));
+  return __acc0;
+}
+
+// Returns the generalized sum with __b of __init and the elements of [__first, __last).
+template <class _Tp, class _BinaryOp>
+_LIBCPP_HIDE_FROM_ABI _Tp __simd_reduce(const _Tp* __first, const _Tp* __last, _Tp __init, _BinaryOp& __b) {
+  typedef __simd_arithmetic_vector<_Tp> _Traits;
+  typedef typename _Traits::type _Vec;
+  typedef typename __simd_arithmetic_operation<_BinaryOp, _Tp>::type _Op;
+  const size_t __vectors = static_cast<size_t>(__last - __first) / _Traits::__size;
+  if (__vectors != 0) {
+    _Vec __acc = std::__simd_reduce_vectors<_Op, _Vec>(
+        __vectors, [__first](size_t __i) { return std::__simd_load<_Vec>(__first + __i * _Traits::__size); });
+    for (size_t __lane = 0; __lane != _Traits::__size; ++__lane)
+      __init = __b(__init, static_cast<_Tp>(__acc[__lane]));
+    __first += __vectors * _Traits::__size;
+  }
+  for (; __first != __last; ++__first)
+    __init = __b(__init, *__first);
+  return __init;
+}
+
+// Returns the generalized sum with __b1 of __init and the __b2(*__i, *__j) for the __i in
+// [__first1, __last1) and the __j in the range of the same length starting at __first2.
+template <class _Tp, class _BinaryOp1, class _BinaryOp2>
+_LIBCPP_HIDE_FROM_ABI _Tp __simd_transform_reduce(
+    const _Tp* __first1, const _Tp* __last1, const _Tp* __first2, _Tp __init, _BinaryOp1& __b1, _BinaryOp2& __b2) {
+  typedef __simd_arithmetic_vector<_Tp> _Traits;
+  typedef typename _Traits::type _Vec;
+  typedef typename __simd_arithmetic_operation<_BinaryOp1, _Tp>::type _Op1;
+  typedef typename __simd_arithmetic_operation<_BinaryOp2, _Tp>::type _Op2;
+  const size_t __vectors = static_cast<size_t>(__last1 - __first1) / _Traits::__size;
+  if (__vectors != 0) {
+    _Vec __acc = std::__simd_reduce_vectors<_Op1, _Vec>(__vectors, [__first1, __first2](size_t __i) {
+      return _Op2::__apply(std::__simd_load<_Vec>(__first1 + __i * _Traits::__size),
+                           std::__simd_load<_Vec>(__first2 + __i * _Traits::__size));
+    });
+    for (size_t __lane = 0; __lane != _Traits::__size; ++__lane)
+      __init = __b1(__init, static_cast<_Tp>(__acc[__lane]));
+    __first1 += __vectors * _Traits::__size;
+    __first2 += __vectors * _Traits::__size;
+  }
+  for (; __first1 != __last1; ++__first1, (void)++__first2)
+    __init = __b1(__init, __b2(*__first1, *__first2));
+  return __init;
+}
+
+// Returns __v with its lanes moved _Shift lanes up, and the lanes of __fill below them.
+template <size_t _Shift, class _Vec, size_t... _Lanes>
+_LIBCPP_HIDE_FROM_ABI _Vec __simd_shift_lanes_up(_Vec __v, _Vec __fill, __tuple_indices<_Lanes...>) {
+  return __builtin_shufflevector(__v, __fill, (_Lanes < _Shift ? sizeof...(_Lanes) + _Lanes : _Lanes - _Shift)...);
+}
+
+// Returns a vector holding the last lane of __v in each lane.
+template <class _Vec, size_t... _Lanes>
+_LIBCPP_HIDE_FROM_ABI _Vec __simd_broadcast_last_lane(_Vec __v, __tuple_indices<_Lanes...>) {
+  return __builtin_shufflevector(__v, __v, (sizeof...(_Lanes) - 1 + 0 * _Lanes)...);
+}
+
+// Returns the inclusive scan of the lanes of __v with _Op, in log2(_Size) steps that each combine every
+// lane with the one _Shift lanes below it.
+template <class _Op, size_t _Size, size_t _Shift = 1, class _Vec>
+_LIBCPP_HIDE_FROM_ABI _Vec __simd_scan_lanes(_Vec __v, _Vec __neutral) {
+  if constexpr (_Shift < _Size) {
+    typedef typename __make_tuple_indices<_Size>::type _Lanes;
+    __v = _Op::__apply(__v, std::__simd_shift_lanes_up<_Shift>(__v, __neutral, _Lanes()));
+    return std::__simd_scan_lanes<_Op, _Size, 2 * _Shift>(__v, __neutral);
+  } else {
+    return __v;
+  }
+}
+
+// Stores the inclusive scan with __b of [__first, __last), starting from __init, to __result, which may
+// be __first, and returns the end of the output. Each vector is scanned by itself, and then combined with
+// the sum of all the vectors before it, which is kept in every lane of __carry. Only combining the vectors
+// with __carry depends on the previous ones, so the scans of several vectors are in flight at once.
+template <class _Tp, class _BinaryOp>
+_LIBCPP_HIDE_FROM_ABI _Tp*
+__simd_inclusive_scan(const _Tp* __first, const _Tp* __last, _Tp* __result, _Tp __init, _BinaryOp& __b) {
+  typedef __simd_arithmetic_vector<_Tp> _Traits;
+  typedef typename _Traits::type _Vec;
+  typedef typename __simd_arithmetic_operation<_BinaryOp, _Tp>::type _Op;
+  typedef typename __make_tuple_indices<_Traits::__size>::type _Lanes;
+  if (static_cast<size_t>(__last - __first) >= _Traits::__size) {
+    const _Vec __neutral = _Vec() + _Op::__neutral;
+    _Vec __carry         = _Vec() + static_cast<typename _Traits::__lane_type>(__init);
+    for (; static_cast<size_t>(__last - __first) >= _Traits::__size;
+         __first += _Traits::__size, __result += _Traits::__size) {
+      _Vec __v   = std::__simd_scan_lanes<_Op, _Traits::__size>(std::__simd_load<_Vec>(__first), __neutral);
+      _Vec __res = _Op::__apply(__v, __carry);
+      __builtin_memcpy(__result, &__res, sizeof(_Vec));
+      __carry = _Op::__apply(__carry, std::__simd_broadcast_last_lane(__v, _Lanes()));
+    }
+    __init = static_cast<_Tp>(__carry[0]);
+  }
+  for (; __first != __last; ++__first, (void)++__result) {
+    __init    = __b(__init, *__first);
+    *__result = __init;
+  }
+  return __result;
+}
+
+// Stores the exclusive scan with __b of [__first, __last), starting from __init, to __result, which may
+// be __first, and returns the end of the output. Works like __simd_inclusive_scan, with the scan of each
+// vector moved one lane up.
+template <class _Tp, class _BinaryOp>
+_LIBCPP_HIDE_FROM_ABI _Tp*
+__simd_exclusive_scan(const _Tp* __first, const _Tp* __last, _Tp* __result, _Tp __init, _BinaryOp& __b) {
+  typedef __simd_arithmetic_vector<_Tp> _Traits;
+  typedef typename _Traits::type _Vec;
+  typedef typename __simd_arithmetic_operation<_BinaryOp, _Tp>::type _Op;
+  typedef typename __make_tuple_indices<_Traits::__size>::type _Lanes;
+  if (static_cast<size_t>(__last - __first) >= _Traits::__size) {
+    const _Vec __neutral = _Vec() + _Op::__neutral;
+    _Vec __carry         = _Vec() + static_cast<typename _Traits::__lane_type>(__init);
+    for (; static_cast<size_t>(__last - __first) >= _Traits::__size;
+         __first += _Traits::__size, __result += _Traits::__size) {
+      _Vec __v   = std::__simd_scan_lanes<_Op, _Traits::__size>(std::__simd_load<_Vec>(__first), __neutral);
+      _Vec __res = _Op::__apply(std::__simd_shift_lanes_up<1>(__v, __neutral, _Lanes()), __carry);
+      __builtin_memcpy(__result, &__res, sizeof(_Vec));
+      __carry = _Op::__apply(__carry, std::__simd_broadcast_last_lane(__v, _Lanes()));
+    }
+    __init = static_cast<_Tp>(__carry[0]);
+  }
+  for (; __first != __last; ++__first, (void)++__result) {
+    _Tp __value = *__first;
+    *__result   = __init;
+    __init      = __b(__init, __value);
+  }
+  return __result;
+}
+
+#  else
+template <class _Tp, class _BinaryOp>
+struct __can_reduce_vectorized : false_type {};
+
+template <class _Tp, class _BinaryOp>
+struct __can_scan_vectorized : false_type {};
+#  endif // _LIBCPP_ALGORITHM_VECTOR_BYTES
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER > 14
+
+#endif // _LIBCPP___NUMERIC_SIMD_ARITHMETIC_H
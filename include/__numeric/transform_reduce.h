@@ -10,8 +10,15 @@
 #ifndef _LIBCPP___NUMERIC_TRANSFORM_REDUCE_H
 #define _LIBCPP___NUMERIC_TRANSFORM_REDUCE_H
 
+#include <__algorithm/unwrap_iter.h>
 #include <__config>
 #include <__functional/operations.h>
+#include <__numeric/simd_arithmetic.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_constant_evaluated.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/remove_const.h>
 #include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
@@ -21,23 +28,78 @@
 _LIBCPP_BEGIN_NAMESPACE_STD
 
 #if _LIBCPP_STD_VER > 14
+template <class _InputIterator, class _Tp, class _BinaryOp, class _UnaryOp>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp
+__transform_reduce(_InputIterator __first, _InputIterator __last, _Tp __init, _BinaryOp& __b, _UnaryOp& __u) {
+  for (; __first != __last; ++__first)
+    __init = __b(__init, __u(*__first));
+  return __init;
+}
+
+// The transformed elements of contiguous ranges are reduced into a floating-point type with plus and
+// multiplies in several accumulators.
+template <class _ValueT,
+          class _Tp,
+          class _BinaryOp,
+          class _UnaryOp,
+          __enable_if_t<__can_reduce_with_accumulators<_Tp, _BinaryOp>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp
+__transform_reduce(_ValueT* __first, _ValueT* __last, _Tp __init, _BinaryOp& __b, _UnaryOp& __u) {
+  if (__libcpp_is_constant_evaluated())
+    return _VSTD::__transform_reduce<_ValueT*>(__first, __last, _VSTD::move(__init), __b, __u);
+  return _VSTD::__reduce_with_accumulators(__first, __last, _VSTD::move(__init), __b, __u);
+}
+
 template <class _InputIterator, class _Tp, class _BinaryOp, class _UnaryOp>
 _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp transform_reduce(_InputIterator __first,
                                                                              _InputIterator __last, _Tp __init,
                                                                              _BinaryOp __b, _UnaryOp __u) {
-  for (; __first != __last; ++__first)
-    __init = __b(__init, __u(*__first));
+  return _VSTD::__transform_reduce(
+      _VSTD::__unwrap_iter(__first), _VSTD::__unwrap_iter(__last), _VSTD::move(__init), __b, __u);
+}
+
+template <class _InputIterator1, class _InputIterator2, class _Tp, class _BinaryOp1, class _BinaryOp2>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp __transform_reduce(
+    _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _Tp __init, _BinaryOp1& __b1,
+    _BinaryOp2& __b2) {
+  for (; __first1 != __last1; ++__first1, (void)++__first2)
+    __init = __b1(__init, __b2(*__first1, *__first2));
   return __init;
 }
 
+#  ifdef _LIBCPP_ALGORITHM_VECTOR_BYTES
+// Pairs of contiguous ranges of arithmetic types, like the ones of an inner product, are transformed and
+// reduced with plus and multiplies a vector at a time.
+template <class _ValueT1, class _ValueT2, class _Tp, class _BinaryOp1, class _BinaryOp2>
+struct __can_transform_reduce_vectorized
+    : integral_constant<bool, is_same<typename remove_const<_ValueT1>::type, _Tp>::value &&
+                                  is_same<typename remove_const<_ValueT2>::type, _Tp>::value &&
+                                  __can_reduce_vectorized<_Tp, _BinaryOp1>::value &&
+                                  __is_simd_arithmetic_operation<_BinaryOp2, _Tp>::value> {};
+
+template <class _ValueT1,
+          class _ValueT2,
+          class _Tp,
+          class _BinaryOp1,
+          class _BinaryOp2,
+          __enable_if_t<__can_transform_reduce_vectorized<_ValueT1, _ValueT2, _Tp, _BinaryOp1, _BinaryOp2>::value,
+                        int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp __transform_reduce(
+    _ValueT1* __first1, _ValueT1* __last1, _ValueT2* __first2, _Tp __init, _BinaryOp1& __b1, _BinaryOp2& __b2) {
+  if (__libcpp_is_constant_evaluated())
+    return _VSTD::__transform_reduce<_ValueT1*, _ValueT2*>(
+        __first1, __last1, __first2, _VSTD::move(__init), __b1, __b2);
+  return _VSTD::__simd_transform_reduce<_Tp>(__first1, __last1, __first2, __init, __b1, __b2);
+}
+#  endif
+
 template <class _InputIterator1, class _InputIterator2, class _Tp, class _BinaryOp1, class _BinaryOp2>
 _LIBCPP_INLINE_VISIBILITY _LIBCPP_CONSTEXPR_AFTER_CXX17 _Tp transform_reduce(_InputIterator1 __first1,
                                                                              _InputIterator1 __last1,
                                                                              _InputIterator2 __first2, _Tp __init,
                                                                              _BinaryOp1 __b1, _BinaryOp2 __b2) {
-  for (; __first1 != __last1; ++__first1, (void)++__first2)
-    __init = __b1(__init, __b2(*__first1, *__first2));
-  return __init;
+  return _VSTD::__transform_reduce(_VSTD::__unwrap_iter(__first1), _VSTD::__unwrap_iter(__last1),
+                                   _VSTD::__unwrap_iter(__first2), _VSTD::move(__init), __b1, __b2);
 }
 
 template <class _InputIterator1, class _InputIterator2, class _Tp>
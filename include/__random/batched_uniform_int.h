@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___RANDOM_BATCHED_UNIFORM_INT_H
+#define _LIBCPP___RANDOM_BATCHED_UNIFORM_INT_H
+
+#include <__config>
+#include <__random/is_valid.h>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if !defined(_LIBCPP_CXX03_LANG) && !defined(_LIBCPP_HAS_NO_INT128)
+
+// Whether every bit of a word of _URNG is uniformly random, and there are at least 32 of them, so
+// that __batched_uniform_int can take all of its bits from one or two words.
+template <class _URNG, class = void>
+struct __is_full_word_urng : false_type {};
+
+template <class _URNG>
+struct __is_full_word_urng<_URNG, __enable_if_t<__libcpp_random_is_valid_urng<_URNG>::value> >
+    : integral_constant<bool, ((_URNG::max() - _URNG::min()) & (_URNG::max() - _URNG::min() + 1)) == 0 &&
+                                  _URNG::max() - _URNG::min() >= 0xFFFFFFFF> {};
+
+// Hands out uniform random integers in [0, __bound) for a bound that goes down by one after each
+// one, as in a Fisher-Yates shuffle, or up by one if _Ascending, as in reservoir sampling.
+//
+// Rather than paying a division or rejection loop for each, it uses the batched form of Lemire's
+// nearly-divisionless method, from Brackett-Rozinsky and Lemire's "Batched Ranged Random Integer
+// Generation": multiplying a 64-bit random word by the first bound gives the first integer in the
+// high half of the product and the bits left for the next in the low half, and so on for as many
+// bounds as multiply to at most 2^60. Only when the bits left at the end are below that product
+// can the integers be biased; the word is then rejected if they are below 2^64 mod the product,
+// which is the only division, and needed at most once every 16 batches.
+template <class _URNG, bool _Ascending = false>
+class __batched_uniform_int {
+  static const size_t __max_batch = 6;
+
+  _URNG& __g_;
+  uint64_t __bound_;
+  size_t __next_;
+  size_t __size_;
+  uint64_t __results_[__max_batch];
+
+  _LIBCPP_HIDE_FROM_ABI uint64_t __word(true_type /* 64 bits */) {
+    return static_cast<uint64_t>(__g_() - _URNG::min());
+  }
+
+  _LIBCPP_HIDE_FROM_ABI uint64_t __word(false_type /* 64 bits */) {
+    uint64_t __high = static_cast<uint64_t>(__g_() - _URNG::min()) << 32;
+    return __high | static_cast<uint32_t>(__g_() - _URNG::min());
+  }
+
+  _LIBCPP_HIDE_FROM_ABI uint64_t __word() {
+    return __word(integral_constant<bool, _URNG::max() - _URNG::min() >= 0xFFFFFFFFFFFFFFFF>());
+  }
+
+  // The largest bound that batches of __n bounds may have, for their product to be at most 2^60.
+  _LIBCPP_HIDE_FROM_ABI static uint64_t __max_bound(size_t __n) {
+    switch (__n) {
+    case 1:
+      return ~uint64_t(0);
+    case 2:
+      return uint64_t(1) << 30;
+    case 3:
+      return uint64_t(1) << 20;
+    case 4:
+      return uint64_t(1) << 15;
+    case 5:
+      return uint64_t(1) << 12;
+    default:
+      return uint64_t(1) << 10;
+    }
+  }
+
+  _LIBCPP_HIDE_FROM_ABI uint64_t __multiply(uint64_t __x) {
+    uint64_t __b = __bound_;
+    for (size_t __i = 0; __i != __size_; ++__i) {
+      __uint128_t __m = static_cast<__uint128_t>(__x) * __b;
+      __results_[__i] = static_cast<uint64_t>(__m >> 64);
+      __x = static_cast<uint64_t>(__m);
+      __b = _Ascending ? __b + 1 : __b - 1;
+    }
+    return __x;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __refill() _LIBCPP_DISABLE_UBSAN_UNSIGNED_INTEGER_CHECK {
+    __size_ = __max_batch;
+    if (_Ascending) {
+      while (__size_ > 1 && __bound_ + (__size_ - 1) > __max_bound(__size_))
+        --__size_;
+    } else {
+      while (__size_ > 1 && (__bound_ > __max_bound(__size_) || __bound_ <= __size_))
+        --__size_;
+    }
+    uint64_t __left = __multiply(__word());
+    if (__left < (__size_ == 1 ? __bound_ : uint64_t(1) << 60)) {
+      uint64_t __product = __bound_;
+      for (size_t __i = 1; __i != __size_; ++__i)
+        __product *= _Ascending ? __bound_ + __i : __bound_ - __i;
+      if (__left < __product) {
+        uint64_t __threshold = -__product % __product;
+        while (__left < __threshold)
+          __left = __multiply(__word());
+      }
+    }
+    __next_ = 0;
+  }
+
+public:
+  _LIBCPP_HIDE_FROM_ABI __batched_uniform_int(_URNG& __g, uint64_t __first_bound)
+      : __g_(__g), __bound_(__first_bound), __next_(0), __size_(0) {}
+
+  _LIBCPP_HIDE_FROM_ABI uint64_t operator()() {
+    if (__next_ == __size_) {
+      __refill();
+      __bound_ = _Ascending ? __bound_ + __size_ : __bound_ - __size_;
+    }
+    return __results_[__next_++];
+  }
+};
+
+#else // !defined(_LIBCPP_CXX03_LANG) && !defined(_LIBCPP_HAS_NO_INT128)
+
+template <class _URNG>
+struct __is_full_word_urng : false_type {};
+
+#endif // !defined(_LIBCPP_CXX03_LANG) && !defined(_LIBCPP_HAS_NO_INT128)
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___RANDOM_BATCHED_UNIFORM_INT_H
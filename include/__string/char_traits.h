@@ -14,6 +14,7 @@
 #include <__algorithm/find_end.h>
 #include <__algorithm/find_first_of.h>
 #include <__algorithm/min.h>
+#include <__algorithm/two_way_search.h>
 #include <__config>
 #include <__functional/hash.h>
 #include <__iterator/iterator_traits.h>
@@ -715,7 +716,7 @@ __str_find(const _CharT *__p, _SizeT __sz,
 template <class _CharT, class _Traits>
 inline _LIBCPP_CONSTEXPR_AFTER_CXX11 const _CharT *
 __search_substring(const _CharT *__first1, const _CharT *__last1,
-                   const _CharT *__first2, const _CharT *__last2) _NOEXCEPT {
+                   const _CharT *__first2, const _CharT *__last2, false_type) _NOEXCEPT {
   // Take advantage of knowing source and pattern lengths.
   // Stop short when source is smaller than pattern.
   const ptrdiff_t __len2 = __last2 - __first2;
@@ -751,6 +752,25 @@ __search_substring(const _CharT *__first1, const _CharT *__last1,
   }
 }
 
+// The standard character traits compare characters like their operator==, so the search can be done
+// without them, in linear time.
+template <class _CharT, class _Traits>
+inline _LIBCPP_CONSTEXPR_AFTER_CXX11 const _CharT *
+__search_substring(const _CharT *__first1, const _CharT *__last1,
+                   const _CharT *__first2, const _CharT *__last2, true_type) _NOEXCEPT {
+  return _VSTD::__search_contiguous(__first1, __last1, __first2, __last2);
+}
+
+template <class _CharT, class _Traits>
+inline _LIBCPP_CONSTEXPR_AFTER_CXX11 const _CharT *
+__search_substring(const _CharT *__first1, const _CharT *__last1,
+                   const _CharT *__first2, const _CharT *__last2) _NOEXCEPT {
+  return _VSTD::__search_substring<_CharT, _Traits>(
+      __first1, __last1, __first2, __last2,
+      integral_constant<bool, is_same<_Traits, char_traits<_CharT> >::value &&
+                                  __can_search_contiguous<_CharT>::value>());
+}
+
 template<class _CharT, class _SizeT, class _Traits, _SizeT __npos>
 inline _SizeT _LIBCPP_CONSTEXPR_AFTER_CXX11 _LIBCPP_INLINE_VISIBILITY
 __str_find(const _CharT *__p, _SizeT __sz,
@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___TYPE_TRAITS_IS_TRIVIALLY_RELOCATABLE_H
+#define _LIBCPP___TYPE_TRAITS_IS_TRIVIALLY_RELOCATABLE_H
+
+#include <__config>
+#include <__type_traits/enable_if.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_same.h>
+#include <__type_traits/is_trivially_copyable.h>
+#include <__type_traits/remove_cv.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// A type is trivially relocatable if copying the bytes of an object to new storage, and forgetting the
+// original without destroying it, has the same effect as move-constructing the new object from it and
+// destroying it. Move-assigning an object and destroying the source must likewise have the same effect
+// as destroying the target and copying the bytes of the source over it. Containers then move such
+// elements around with memmove, which also copies the tags of capabilities on CHERI.
+//
+// Trivially copyable types are trivially relocatable. Libc++ types declare that they are with a
+// __trivially_relocatable member typedef naming the type itself, and other types can opt in by
+// specializing __libcpp_is_trivially_relocatable to derive from true_type.
+template <class _Tp, class = void>
+struct __libcpp_is_trivially_relocatable : is_trivially_copyable<_Tp> {};
+
+template <class _Tp>
+struct __libcpp_is_trivially_relocatable<
+    _Tp,
+    __enable_if_t<is_same<typename remove_cv<_Tp>::type, typename _Tp::__trivially_relocatable>::value> >
+    : true_type {};
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP___TYPE_TRAITS_IS_TRIVIALLY_RELOCATABLE_H
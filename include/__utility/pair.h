@@ -45,6 +45,12 @@ struct _LIBCPP_TEMPLATE_VIS pair
     typedef _T1 first_type;
     typedef _T2 second_type;
 
+    typedef __conditional_t<__libcpp_is_trivially_relocatable<_T1>::value &&
+                                __libcpp_is_trivially_relocatable<_T2>::value,
+                            pair,
+                            void>
+        __trivially_relocatable;
+
     _T1 first;
     _T2 second;
 
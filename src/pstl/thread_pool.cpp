@@ -0,0 +1,163 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <__config>
+
+#ifndef _LIBCPP_HAS_NO_THREADS
+
+#include <__algorithm/pstl_backends/cpu_backends/backend.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+namespace __par_backend {
+
+namespace {
+
+struct __job {
+  void* __context_;
+  void (*__func_)(void*, size_t);
+  size_t __count_;
+  unsigned __max_helpers_;
+  atomic<size_t> __next_;
+
+  void __run() noexcept {
+    for (size_t __i = __next_.fetch_add(1, memory_order_relaxed); __i < __count_;
+         __i        = __next_.fetch_add(1, memory_order_relaxed))
+      __func_(__context_, __i);
+  }
+};
+
+// Set on the threads that are executing a job. Parallel algorithms called from inside an element
+// access function run serially instead of waiting for the pool they are running on.
+thread_local bool __in_parallel_region = false;
+
+atomic<unsigned> __requested_concurrency(0);
+
+unsigned __hardware_concurrency() {
+  static const unsigned __n = std::max(thread::hardware_concurrency(), 1u);
+  return __n;
+}
+
+// A fixed set of worker threads that help the submitting thread to run one job at a time. The
+// workers sleep on a condition variable between jobs.
+class __thread_pool {
+public:
+  __thread_pool() {
+    for (unsigned __i = 1; __i < __hardware_concurrency(); ++__i) {
+#ifndef _LIBCPP_NO_EXCEPTIONS
+      try {
+#endif
+        thread(&__thread_pool::__work, this).detach();
+        ++__workers_;
+#ifndef _LIBCPP_NO_EXCEPTIONS
+      } catch (...) {
+        // Make do with the threads that could be created.
+        break;
+      }
+#endif
+    }
+  }
+
+  unsigned __workers() const { return __workers_; }
+
+  void __apply(__job& __j) {
+    // The pool runs a single job at a time. Rather than queueing behind another thread's job, run
+    // this one on the calling thread.
+    unique_lock<mutex> __submit(__submit_mutex_, try_to_lock);
+    if (!__submit.owns_lock()) {
+      __j.__run();
+      return;
+    }
+
+    {
+      lock_guard<mutex> __lock(__mutex_);
+      __job_ = &__j;
+      ++__generation_;
+    }
+    __wake_.notify_all();
+
+    __in_parallel_region = true;
+    __j.__run();
+    __in_parallel_region = false;
+
+    // Once every index has been claimed, wait for the workers that are still running theirs: the
+    // job lives on our stack.
+    unique_lock<mutex> __lock(__mutex_);
+    __job_ = nullptr;
+    __idle_.wait(__lock, [this] { return __active_ == 0; });
+  }
+
+private:
+  void __work() {
+    __in_parallel_region = true;
+    uint64_t __seen      = 0;
+    unique_lock<mutex> __lock(__mutex_);
+    while (true) {
+      __wake_.wait(__lock, [&] { return __generation_ != __seen; });
+      __seen     = __generation_;
+      __job* __j = __job_;
+      if (__j == nullptr || __active_ >= __j->__max_helpers_)
+        continue;
+      ++__active_;
+      __lock.unlock();
+      __j->__run();
+      __lock.lock();
+      if (--__active_ == 0)
+        __idle_.notify_all();
+    }
+  }
+
+  unsigned __workers_ = 0;
+  mutex __submit_mutex_;
+  mutex __mutex_;
+  condition_variable __wake_;
+  condition_variable __idle_;
+  __job* __job_          = nullptr;
+  uint64_t __generation_ = 0;
+  unsigned __active_     = 0;
+};
+
+__thread_pool& __get_pool() {
+  // Never destroyed: the workers are still waiting on the pool when the program exits.
+  static __thread_pool* __pool = new __thread_pool();
+  return *__pool;
+}
+
+} // namespace
+
+unsigned __max_concurrency() noexcept {
+  unsigned __requested = __requested_concurrency.load(memory_order_relaxed);
+  unsigned __hardware  = __hardware_concurrency();
+  return __requested == 0 ? __hardware : std::min(__requested, __hardware);
+}
+
+void __set_max_concurrency(unsigned __n) noexcept { __requested_concurrency.store(__n, memory_order_relaxed); }
+
+void __parallel_apply(size_t __count, void* __context, void (*__func)(void*, size_t)) noexcept {
+  __job __j{__context, __func, __count, 0, {0}};
+  size_t __helpers = std::min<size_t>(__max_concurrency() - 1, __count - 1);
+  if (__count == 0 || __helpers == 0 || __in_parallel_region) {
+    __j.__run();
+    return;
+  }
+  __thread_pool& __pool = __get_pool();
+  __j.__max_helpers_    = static_cast<unsigned>(std::min<size_t>(__helpers, __pool.__workers()));
+  __pool.__apply(__j);
+}
+
+} // namespace __par_backend
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_HAS_NO_THREADS
@@ -0,0 +1,119 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+
+// <algorithm>
+
+// Generators whose words are all random bits have shuffle and sample draw several indices from each
+// 64-bit word. Check that every permutation and every sample remains equally likely with them.
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "test_iterators.h"
+#include "test_macros.h"
+
+// Full 32-bit words, not starting at zero.
+struct OffsetGenerator {
+  typedef std::uint64_t result_type;
+  static constexpr result_type min() { return 5; }
+  static constexpr result_type max() { return 5 + 0xFFFFFFFFull; }
+  result_type operator()() { return min() + static_cast<std::uint32_t>(engine_()); }
+
+  std::mt19937_64 engine_;
+};
+
+template <class Counts>
+void check_uniform(const Counts& counts, int outcomes, int trials) {
+  assert(static_cast<int>(counts.size()) == outcomes);
+  for (const auto& count : counts) {
+    // More than six standard deviations away from the expectation.
+    assert(count.second > trials / outcomes - 6 * 50);
+    assert(count.second < trials / outcomes + 6 * 50);
+  }
+}
+
+template <class Generator>
+void test_shuffle() {
+  Generator g;
+  for (int n = 2; n != 5; ++n) {
+    std::map<std::vector<int>, int> counts;
+    const int outcomes = n == 2 ? 2 : n == 3 ? 6 : 24;
+    const int trials = 2500 * outcomes;
+    for (int i = 0; i != trials; ++i) {
+      std::vector<int> v = {0, 1, 2, 3};
+      v.resize(n);
+      std::shuffle(v.begin(), v.end(), g);
+      ++counts[v];
+    }
+    check_uniform(counts, outcomes, trials);
+  }
+
+  // Long enough to go through every batch size.
+  std::vector<int> v(5000);
+  for (int i = 0; i != 5000; ++i)
+    v[i] = i;
+  std::vector<int> shuffled = v;
+  std::shuffle(shuffled.begin(), shuffled.end(), g);
+  assert(shuffled != v);
+  assert(std::is_permutation(shuffled.begin(), shuffled.end(), v.begin()));
+}
+
+template <class Iter, class Generator>
+void test_sample() {
+  Generator g;
+  int population[] = {0, 1, 2, 3, 4};
+  std::map<std::vector<int>, int> counts;
+  const int trials = 2500 * 10;
+  for (int i = 0; i != trials; ++i) {
+    int out[2];
+    std::sample(Iter(population), Iter(population + 5), out, 2, g);
+    std::vector<int> chosen(out, out + 2);
+    std::sort(chosen.begin(), chosen.end());
+    ++counts[chosen];
+  }
+  check_uniform(counts, 10, trials);
+}
+
+// Bounds too large to batch go through one at a time.
+void test_large_bounds() {
+  std::mt19937_64 g;
+  const std::uint64_t first_bound = std::uint64_t(1) << 40;
+  std::__batched_uniform_int<std::mt19937_64> descending(g, first_bound);
+  std::__batched_uniform_int<std::mt19937_64, true> ascending(g, first_bound);
+  std::uint64_t high = 0;
+  for (std::uint64_t i = 0; i != 1000; ++i) {
+    std::uint64_t d = descending();
+    std::uint64_t a = ascending();
+    assert(d < first_bound - i);
+    assert(a < first_bound + i);
+    high += (d >> 39) + (a >> 39);
+  }
+  assert(high > 850 && high < 1150);
+}
+
+int main(int, char**) {
+  test_shuffle<std::mt19937>();
+  test_shuffle<std::mt19937_64>();
+  test_shuffle<OffsetGenerator>();
+
+  test_sample<forward_iterator<int*>, std::mt19937>();
+  test_sample<forward_iterator<int*>, std::mt19937_64>();
+  test_sample<cpp17_input_iterator<int*>, std::mt19937>();
+  test_sample<cpp17_input_iterator<int*>, OffsetGenerator>();
+
+  test_large_bounds();
+
+  return 0;
+}
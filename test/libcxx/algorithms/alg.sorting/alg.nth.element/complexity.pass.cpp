@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+
+// <algorithm>
+
+// template<class Iter>
+//   void nth_element(Iter first, Iter nth, Iter last);
+
+// Our nth_element takes linear time on any input, even the one that "A Killer
+// Adversary for Quicksort" (M. D. McIlroy, 1999) makes up as it compares elements
+// to defeat its choice of pivots.
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <vector>
+
+#include "test_macros.h"
+
+struct Adversary {
+  std::vector<int>& values;
+  int gas;
+  int& solid;
+  int& candidate;
+  long& compared;
+
+  bool operator()(int x, int y) const {
+    ++compared;
+    if (values[x] == gas && values[y] == gas) {
+      if (x == candidate)
+        values[x] = solid++;
+      else
+        values[y] = solid++;
+    }
+    if (values[x] == gas)
+      candidate = x;
+    else if (values[y] == gas)
+      candidate = y;
+    return values[x] < values[y];
+  }
+};
+
+void test(int n, int nth) {
+  std::vector<int> values(n, n);
+  std::vector<int> indices(n);
+  std::iota(indices.begin(), indices.end(), 0);
+  int solid = 0;
+  int candidate = 0;
+  long compared = 0;
+  std::nth_element(indices.begin(), indices.begin() + nth, indices.end(),
+                   Adversary{values, n, solid, candidate, compared});
+
+  for (int i = 0; i != nth; ++i)
+    assert(values[indices[i]] <= values[indices[nth]]);
+  for (int i = nth; i != n; ++i)
+    assert(values[indices[nth]] <= values[indices[i]]);
+#ifndef _LIBCPP_ENABLE_DEBUG_MODE
+  // The exact number of comparisons depends on the implementation, but a
+  // quadratic one would make billions of them here.
+  assert(compared < 20L * n);
+#endif
+}
+
+int main(int, char**) {
+  test(100'000, 50'000);
+  test(100'000, 100);
+  test(100'000, 99'900);
+  test(1'000, 500);
+
+  return 0;
+}
@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// Test that stable_sort, inplace_merge and stable_partition stay correct and stable when they
+// cannot get a temporary buffer, and merge through their own small buffer instead.
+
+// UNSUPPORTED: c++03
+// UNSUPPORTED: sanitizer-new-delete
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "test_macros.h"
+
+int nothrow_new_called = 0;
+
+void* operator new(std::size_t, const std::nothrow_t&) TEST_NOEXCEPT {
+  ++nothrow_new_called;
+  return nullptr;
+}
+
+typedef std::pair<int, int> P;
+
+struct FirstLess {
+  bool operator()(const P& x, const P& y) const { return x.first < y.first; }
+};
+
+struct FirstIsEven {
+  bool operator()(const P& x) const { return x.first % 2 == 0; }
+};
+
+// Keys with many duplicates, each tagged with its original position, so that sorting on both
+// gives the stable order.
+std::vector<P> make_input(int n) {
+  std::vector<P> v;
+  unsigned state = 1;
+  for (int i = 0; i != n; ++i) {
+    state = state * 1103515245 + 12345;
+    v.push_back(P(static_cast<int>((state >> 16) % 64), i));
+  }
+  return v;
+}
+
+void test(int n) {
+  {
+    std::vector<P> v = make_input(n);
+    std::vector<P> expected = v;
+    std::sort(expected.begin(), expected.end());
+    std::stable_sort(v.begin(), v.end(), FirstLess());
+    assert(v == expected);
+  }
+  {
+    std::vector<P> v = make_input(n);
+    std::vector<P>::iterator middle = v.begin() + n / 3;
+    std::sort(v.begin(), middle);
+    std::sort(middle, v.end());
+    // The positions in the left part are all smaller, so the stable order sorts on both again.
+    std::vector<P> expected = v;
+    std::sort(expected.begin(), expected.end());
+    std::inplace_merge(v.begin(), middle, v.end(), FirstLess());
+    assert(v == expected);
+  }
+  {
+    std::vector<P> v = make_input(n);
+    std::vector<P> expected;
+    std::copy_if(v.begin(), v.end(), std::back_inserter(expected), FirstIsEven());
+    std::remove_copy_if(v.begin(), v.end(), std::back_inserter(expected), FirstIsEven());
+
+    std::list<P> l(v.begin(), v.end());
+    std::vector<P>::iterator mid = std::stable_partition(v.begin(), v.end(), FirstIsEven());
+    assert(v == expected);
+    assert(std::none_of(mid, v.end(), FirstIsEven()));
+
+    std::stable_partition(l.begin(), l.end(), FirstIsEven());
+    assert(std::vector<P>(l.begin(), l.end()) == expected);
+  }
+}
+
+int main(int, char**) {
+  for (int n : {0, 1, 2, 3, 10, 100, 1000, 5000})
+    test(n);
+  assert(nothrow_new_called > 0);
+
+  return 0;
+}
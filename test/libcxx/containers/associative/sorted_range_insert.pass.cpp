@@ -0,0 +1,246 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03
+
+// <map>
+// <set>
+
+// Inserting a range into an empty map, multimap, set or multiset builds the
+// tree from the sorted prefix of the range at once, and inserts the rest of
+// the range one element at a time.
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_iterators.h"
+#include "test_macros.h"
+
+// Inserts and erases enough elements to go through most of the rebalancing
+// cases of a tree built in one go, and checks that it stays ordered.
+template <class C, class Make>
+void check_usable(C& c, Make make) {
+  for (int i = 0; i < 200; ++i)
+    c.insert(make(i * 7 % 200 - 50));
+  for (auto it = c.begin(); it != c.end();) {
+    it = c.erase(it);
+    for (int i = 0; i < 2 && it != c.end(); ++i)
+      ++it;
+  }
+  for (int i = 0; i < 100; ++i)
+    c.insert(make(i * 3));
+  assert(std::is_sorted(c.begin(), c.end(), c.value_comp()));
+  assert(static_cast<std::size_t>(std::distance(c.begin(), c.end())) == c.size());
+  assert(static_cast<std::size_t>(std::distance(c.rbegin(), c.rend())) == c.size());
+}
+
+int make_int(int i) { return i; }
+
+std::pair<const int, int> make_pair(int i) { return std::pair<const int, int>(i, i); }
+
+void test_set() {
+  for (int n : {0, 1, 2, 3, 7, 8, 100, 1000}) {
+    std::vector<int> v(n);
+    for (int i = 0; i < n; ++i)
+      v[i] = 2 * i;
+
+    std::set<int> s(v.begin(), v.end());
+    assert(s.size() == v.size());
+    assert(std::equal(s.begin(), s.end(), v.begin()));
+    check_usable(s, make_int);
+
+    std::set<int> t;
+    t.insert(cpp17_input_iterator<const int*>(v.data()), cpp17_input_iterator<const int*>(v.data() + v.size()));
+    assert(t.size() == v.size());
+    assert(std::equal(t.begin(), t.end(), v.begin()));
+
+    // Equivalent elements are dropped.
+    std::vector<int> dups;
+    for (int x : v)
+      dups.insert(dups.end(), 3, x);
+    std::set<int> u(dups.begin(), dups.end());
+    assert(u.size() == v.size());
+    assert(std::equal(u.begin(), u.end(), v.begin()));
+    check_usable(u, make_int);
+
+    // Out of order elements are inserted as usual.
+    std::vector<int> w = v;
+    w.push_back(-1);
+    w.push_back(n);
+    w.push_back(n / 2 * 2);
+    w.push_back(2 * n);
+    std::set<int> x(w.begin(), w.end());
+    std::set<int> expected;
+    for (int i : w)
+      expected.insert(i);
+    assert(x == expected);
+    check_usable(x, make_int);
+
+    std::reverse(w.begin(), w.end());
+    std::set<int> y(w.begin(), w.end());
+    assert(y == expected);
+  }
+  {
+    // Inserting into a set that isn't empty.
+    std::set<int> s = {5, 1};
+    int a[] = {0, 1, 2, 3, 4, 5, 6};
+    s.insert(a, a + 7);
+    assert(s.size() == 7);
+    assert(std::equal(s.begin(), s.end(), a));
+    s.clear();
+    s.insert(a, a + 7);
+    assert(std::equal(s.begin(), s.end(), a));
+  }
+}
+
+void test_multiset() {
+  std::vector<int> v;
+  for (int i = 0; i < 500; ++i)
+    v.insert(v.end(), i % 4, i);
+  std::multiset<int> s(v.begin(), v.end());
+  assert(s.size() == v.size());
+  assert(std::equal(s.begin(), s.end(), v.begin()));
+  check_usable(s, make_int);
+
+  v.push_back(3);
+  v.push_back(600);
+  v.push_back(3);
+  std::multiset<int> t(v.begin(), v.end());
+  assert(t.size() == v.size());
+  assert(t.count(3) == 5);
+  assert(std::is_sorted(t.begin(), t.end()));
+}
+
+void test_map() {
+  std::vector<std::pair<int, int> > v;
+  for (int i = 0; i < 300; ++i) {
+    v.push_back(std::make_pair(i, 0));
+    v.push_back(std::make_pair(i, 1));
+  }
+  // The first of equivalent elements is kept.
+  std::map<int, int> m(v.begin(), v.end());
+  assert(m.size() == 300);
+  for (int i = 0; i < 300; ++i)
+    assert(m.at(i) == 0);
+  check_usable(m, make_pair);
+
+  std::map<int, int> copy(m);
+  assert(copy == m);
+  check_usable(copy, make_pair);
+
+  v.push_back(std::make_pair(-1, 2));
+  v.push_back(std::make_pair(5, 2));
+  v.push_back(std::make_pair(400, 2));
+  std::map<int, int> n(v.begin(), v.end());
+  assert(n.size() == 302);
+  assert(n.at(-1) == 2 && n.at(5) == 0 && n.at(400) == 2);
+}
+
+void test_multimap() {
+  // Equivalent elements stay in the order of the range.
+  std::vector<std::pair<const int, int> > v;
+  for (int i = 0; i < 1000; ++i)
+    v.push_back(std::make_pair(i / 10, i));
+  std::multimap<int, int> m(v.begin(), v.end());
+  assert(m.size() == v.size());
+  assert(std::equal(m.begin(), m.end(), v.begin()));
+  check_usable(m, make_pair);
+
+  v.push_back(std::make_pair(50, -1));
+  v.push_back(std::make_pair(50, -2));
+  std::multimap<int, int> n(v.begin(), v.end());
+  assert(n.count(50) == 12);
+  auto r = n.equal_range(50);
+  assert(std::prev(r.second)->second == -2);
+  assert(std::prev(r.second, 2)->second == -1);
+  assert(r.first->second == 500);
+}
+
+// Elements equivalent to one already in a map or set are not moved from.
+void test_move_duplicates() {
+  const std::string a(100, 'a');
+  const std::string b(100, 'b');
+  const std::string c(100, 'c');
+  {
+    std::vector<std::string> v = {a, a, b, b, c, a};
+    std::set<std::string> s(std::make_move_iterator(v.begin()), std::make_move_iterator(v.end()));
+    assert(s.size() == 3);
+    assert(v[1] == a && v[3] == b && v[5] == a);
+  }
+  {
+    std::vector<std::pair<const std::string, std::string> > v = {
+        {a, a}, {a, b}, {b, a}, {c, a}, {c, b}, {b, b}};
+    std::map<std::string, std::string> m(std::make_move_iterator(v.begin()), std::make_move_iterator(v.end()));
+    assert(m.size() == 3);
+    assert(m.at(a) == a && m.at(b) == a && m.at(c) == a);
+    assert(v[1].second == b && v[4].second == b && v[5].second == b);
+  }
+  {
+    // The key of a pair whose first member isn't const can be extracted too.
+    std::vector<std::pair<std::string, std::string> > v = {{a, a}, {a, b}, {b, a}};
+    std::map<std::string, std::string> m;
+    m.insert(std::make_move_iterator(v.begin()), std::make_move_iterator(v.end()));
+    assert(m.size() == 2);
+    assert(v[1].first == a && v[1].second == b);
+  }
+}
+
+#ifndef TEST_HAS_NO_EXCEPTIONS
+struct ThrowingInt {
+  static int countdown;
+  int value;
+  ThrowingInt(int v) : value(v) {}
+  ThrowingInt(const ThrowingInt& other) : value(other.value) {
+    if (--countdown == 0)
+      throw 1;
+  }
+  bool operator<(const ThrowingInt& other) const { return value < other.value; }
+};
+int ThrowingInt::countdown = 0;
+
+void test_exceptions() {
+  std::vector<ThrowingInt> v;
+  for (int i = 0; i < 100; ++i)
+    v.push_back(ThrowingInt(i));
+  std::set<ThrowingInt> s;
+  ThrowingInt::countdown = 51;
+  try {
+    s.insert(v.begin(), v.end());
+    assert(false);
+  } catch (int) {
+  }
+  // The elements inserted before the exception are kept.
+  assert(s.size() == 50);
+  int i = 0;
+  for (const ThrowingInt& x : s)
+    assert(x.value == i++);
+  ThrowingInt::countdown = 0;
+  s.insert(v.begin(), v.end());
+  assert(s.size() == 100);
+}
+#endif
+
+int main(int, char**) {
+  test_set();
+  test_multiset();
+  test_map();
+  test_multimap();
+  test_move_duplicates();
+#ifndef TEST_HAS_NO_EXCEPTIONS
+  test_exceptions();
+#endif
+
+  return 0;
+}
@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Not a portable test
+
+// template <class _NodePtr>
+// _NodePtr
+// __tree_build_balanced(_NodePtr& __first, size_t __n, size_t __depth, size_t __red_depth);
+
+#include <__tree>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "test_macros.h"
+
+struct Node
+{
+    Node* __left_;
+    Node* __right_;
+    Node* __parent_;
+    bool __is_black_;
+
+    Node* __parent_unsafe() const { return __parent_; }
+    void __set_parent(Node* x) { __parent_ = x;}
+
+    Node() : __left_(), __right_(), __parent_(), __is_black_() {}
+};
+
+std::size_t red_depth(std::size_t n)
+{
+    std::size_t d = 0;
+    for (std::size_t m = n + 1; m > 1; m >>= 1)
+        ++d;
+    return d;
+}
+
+std::size_t height(Node* x)
+{
+    if (x == nullptr)
+        return 0;
+    std::size_t l = height(x->__left_);
+    std::size_t r = height(x->__right_);
+    return 1 + (l > r ? l : r);
+}
+
+void test(std::size_t n)
+{
+    std::vector<Node> nodes(n + 1);
+    Node* end = &nodes[n];
+    for (std::size_t i = 0; i < n; ++i)
+        nodes[i].__right_ = &nodes[i + 1];
+
+    Node* first = &nodes[0];
+    Node* root = std::__tree_build_balanced(first, n, 0, red_depth(n));
+    assert(first == end);
+    if (n == 0)
+    {
+        assert(root == nullptr);
+        return;
+    }
+    end->__left_ = root;
+    root->__parent_ = end;
+    assert(std::__tree_invariant(root));
+    assert(height(root) == red_depth(n) + (((n + 1) & n) != 0));
+
+    // The nodes are still in list order.
+    Node* x = std::__tree_min(root);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        assert(x == &nodes[i]);
+        x = std::__tree_next(x);
+    }
+    assert(x == end);
+}
+
+int main(int, char**)
+{
+    for (std::size_t n = 0; n <= 300; ++n)
+        test(n);
+    test(1023);
+    test(1024);
+    test(4095);
+    test(100000);
+
+  return 0;
+}
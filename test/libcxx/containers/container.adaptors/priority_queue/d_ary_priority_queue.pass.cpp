@@ -0,0 +1,155 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03
+
+// <experimental/queue>
+
+// template <class T, class Container = vector<T>,
+//           class Compare = less<typename Container::value_type>, size_t Arity = 4>
+// class d_ary_priority_queue;
+
+#include <experimental/queue>
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "test_macros.h"
+#include "test_allocator.h"
+
+// Pushes and pops the same pseudo-random values in a d_ary_priority_queue and in a priority_queue, with
+// the queue growing and shrinking across several levels, and checks that both agree on the top.
+template <std::size_t Arity, class Compare>
+void test_against_priority_queue() {
+  std::experimental::d_ary_priority_queue<int, std::vector<int>, Compare, Arity> q;
+  std::priority_queue<int, std::vector<int>, Compare> expected;
+  unsigned state = 1;
+  for (int round = 0; round != 4; ++round) {
+    for (int i = 0; i != 300; ++i) {
+      state = state * 1103515245 + 12345;
+      int value = static_cast<int>((state >> 16) % 100);
+      q.push(value);
+      expected.push(value);
+      assert(q.top() == expected.top());
+      if (i % 3 == 2) {
+        q.pop();
+        expected.pop();
+        assert(q.top() == expected.top());
+      }
+    }
+    while (q.size() > 50) {
+      q.pop();
+      expected.pop();
+      assert(q.top() == expected.top());
+    }
+  }
+  while (!q.empty()) {
+    assert(q.top() == expected.top());
+    q.pop();
+    expected.pop();
+  }
+  assert(expected.empty());
+}
+
+template <std::size_t Arity>
+void test_constructors() {
+  typedef std::experimental::d_ary_priority_queue<int, std::vector<int>, std::less<int>, Arity> Queue;
+  std::vector<int> input;
+  for (int i = 0; i != 100; ++i)
+    input.push_back((i * 37) % 100);
+
+  {
+    Queue q(input.begin(), input.end());
+    assert(q.size() == 100);
+    for (int i = 99; i >= 0; --i) {
+      assert(q.top() == i);
+      q.pop();
+    }
+    assert(q.empty());
+  }
+  {
+    Queue q(std::less<int>(), input);
+    for (int i = 99; i >= 0; --i) {
+      assert(q.top() == i);
+      q.pop();
+    }
+  }
+  {
+    std::vector<int> c(input.begin(), input.begin() + 50);
+    Queue q(input.begin() + 50, input.end(), std::less<int>(), std::move(c));
+    assert(q.size() == 100);
+    for (int i = 99; i >= 0; --i) {
+      assert(q.top() == i);
+      q.pop();
+    }
+  }
+}
+
+struct Deref {
+  bool operator()(const std::unique_ptr<int>& x, const std::unique_ptr<int>& y) const { return *x < *y; }
+};
+
+void test_move_only() {
+  std::experimental::d_ary_priority_queue<std::unique_ptr<int>, std::vector<std::unique_ptr<int> >, Deref, 3> q;
+  for (int i = 0; i != 50; ++i)
+    q.emplace(new int((i * 7) % 50));
+  q.push(std::unique_ptr<int>(new int(50)));
+  for (int i = 50; i >= 0; --i) {
+    assert(*q.top() == i);
+    q.pop();
+  }
+  assert(q.empty());
+}
+
+void test_container_and_allocator() {
+  typedef test_allocator<int> Alloc;
+  typedef std::deque<int, Alloc> Container;
+  typedef std::experimental::d_ary_priority_queue<int, Container, std::greater<int> > Queue;
+  static_assert(std::uses_allocator<Queue, Alloc>::value, "");
+  static_assert(!std::uses_allocator<Queue, std::allocator<int> >::value, "");
+
+  Queue q(Alloc(3));
+  for (int i = 0; i != 20; ++i)
+    q.push((i * 7) % 20);
+  Queue copy(q, Alloc(5));
+  assert(copy.size() == 20);
+  Queue other;
+  other.push(42);
+  swap(q, other);
+  assert(q.size() == 1 && q.top() == 42);
+  assert(other.size() == 20);
+  for (int i = 0; i != 20; ++i) {
+    assert(other.top() == i);
+    assert(copy.top() == i);
+    other.pop();
+    copy.pop();
+  }
+}
+
+int main(int, char**) {
+  test_against_priority_queue<2, std::less<int> >();
+  test_against_priority_queue<3, std::less<int> >();
+  test_against_priority_queue<4, std::less<int> >();
+  test_against_priority_queue<4, std::greater<int> >();
+  test_against_priority_queue<8, std::less<int> >();
+  test_against_priority_queue<16, std::greater<int> >();
+
+  test_constructors<2>();
+  test_constructors<4>();
+  test_constructors<5>();
+
+  test_move_only();
+  test_container_and_allocator();
+
+  return 0;
+}
@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03
+
+// <deque>
+
+// Make sure that erasing elements from a deque relocates the trivially relocatable elements that
+// close the gap block by block, without calling their move assignment, and that the elements keep
+// their values.
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <type_traits>
+#include <vector>
+
+#include "test_macros.h"
+
+static int moves = 0;
+static int live = 0;
+
+struct Relocatable {
+  int* value;
+
+  explicit Relocatable(int v) : value(new int(v)) { ++live; }
+  Relocatable(const Relocatable& other) : value(new int(*other.value)) { ++live; }
+  Relocatable(Relocatable&& other) TEST_NOEXCEPT : value(other.value) {
+    other.value = nullptr;
+    ++moves;
+    ++live;
+  }
+  Relocatable& operator=(const Relocatable& other) {
+    *value = *other.value;
+    return *this;
+  }
+  Relocatable& operator=(Relocatable&& other) TEST_NOEXCEPT {
+    delete value;
+    value = other.value;
+    other.value = nullptr;
+    ++moves;
+    return *this;
+  }
+  ~Relocatable() {
+    delete value;
+    --live;
+  }
+};
+
+namespace std {
+template <>
+struct __libcpp_is_trivially_relocatable<Relocatable> : true_type {};
+} // namespace std
+
+void check(const std::deque<Relocatable>& d, const std::vector<int>& expected) {
+  assert(d.size() == expected.size());
+  for (std::size_t i = 0; i != d.size(); ++i)
+    assert(*d[i].value == expected[i]);
+}
+
+int main(int, char**) {
+  {
+    std::deque<Relocatable> d;
+    std::vector<int> expected;
+    for (int i = 0; i != 3000; ++i) {
+      d.emplace_back(i);
+      expected.push_back(i);
+    }
+
+    // Erase ranges and single elements at positions that make the deque close the gap from either
+    // end, with ranges that span several blocks.
+    unsigned seed = 1;
+    moves = 0;
+    while (expected.size() > 10) {
+      seed = seed * 1103515245 + 12345;
+      std::size_t pos = (seed >> 8) % expected.size();
+      seed = seed * 1103515245 + 12345;
+      std::size_t n = std::min<std::size_t>((seed >> 8) % 700, expected.size() - pos);
+      std::deque<Relocatable>::iterator it;
+      if (n % 3 == 0) {
+        n = 1;
+        it = d.erase(d.begin() + pos);
+      } else {
+        it = d.erase(d.begin() + pos, d.begin() + pos + n);
+      }
+      expected.erase(expected.begin() + pos, expected.begin() + pos + n);
+      assert(static_cast<std::size_t>(it - d.begin()) == pos);
+      check(d, expected);
+      assert(live == static_cast<int>(d.size()));
+    }
+    assert(moves == 0);
+  }
+  assert(live == 0);
+
+  return 0;
+}
@@ -0,0 +1,258 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03
+
+// <vector>
+
+// Make sure that vector relocates trivially relocatable elements by copying their bytes when it
+// reallocates, inserts or erases elements, without calling their move constructor or move assignment,
+// and that the elements keep their values.
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "min_allocator.h"
+#include "test_macros.h"
+
+static int moves = 0;
+static int live = 0;
+
+template <bool Relocatable>
+struct Counted {
+  int* value;
+
+  explicit Counted(int v) : value(new int(v)) { ++live; }
+  Counted(const Counted& other) : value(new int(*other.value)) { ++live; }
+  Counted(Counted&& other) TEST_NOEXCEPT : value(other.value) {
+    other.value = nullptr;
+    ++moves;
+    ++live;
+  }
+  Counted& operator=(const Counted& other) {
+    int* copy = new int(*other.value);
+    delete value;
+    value = copy;
+    return *this;
+  }
+  Counted& operator=(Counted&& other) TEST_NOEXCEPT {
+    delete value;
+    value = other.value;
+    other.value = nullptr;
+    ++moves;
+    return *this;
+  }
+  ~Counted() {
+    delete value;
+    --live;
+  }
+};
+
+namespace std {
+template <>
+struct __libcpp_is_trivially_relocatable<Counted<true> > : true_type {};
+} // namespace std
+
+// An allocator that constructs the elements itself, so that vector can't relocate them behind its back.
+template <class T>
+struct construct_allocator : std::allocator<T> {
+  template <class U>
+  struct rebind {
+    typedef construct_allocator<U> other;
+  };
+
+  construct_allocator() = default;
+  template <class U>
+  construct_allocator(const construct_allocator<U>&) {}
+
+  template <class U, class... Args>
+  void construct(U* p, Args&&... args) {
+    ::new ((void*)p) U(std::forward<Args>(args)...);
+  }
+};
+
+template <class T, class Alloc>
+void check(const std::vector<T, Alloc>& v, const std::vector<int>& expected) {
+  assert(v.size() == expected.size());
+  for (std::size_t i = 0; i != v.size(); ++i)
+    assert(*v[i].value == expected[i]);
+}
+
+template <class T, class Alloc>
+void test(bool relocates) {
+  moves = 0;
+  {
+    std::vector<T, Alloc> v;
+    std::vector<int> expected;
+    for (int i = 0; i != 100; ++i) {
+      v.push_back(T(i));
+      expected.push_back(i);
+      --moves; // for the temporary
+    }
+    check(v, expected);
+    assert((moves == 0) == relocates);
+
+    moves = 0;
+    v.shrink_to_fit();
+    check(v, expected);
+    assert((moves == 0) == relocates);
+
+    moves = 0;
+    v.insert(v.begin() + 10, T(-1)); // reallocates
+    expected.insert(expected.begin() + 10, -1);
+    check(v, expected);
+    assert((moves == 1) == relocates);
+
+    // Inserting within the capacity only moves the elements moved into the vector.
+    v.reserve(v.size() + 10);
+    moves = 0;
+    v.insert(v.begin() + 1, v[5]);
+    expected.insert(expected.begin() + 1, expected[5]);
+    check(v, expected);
+    assert((moves == 0) == relocates);
+
+    moves = 0;
+    v.insert(v.begin() + 2, T(-2));
+    expected.insert(expected.begin() + 2, -2);
+    check(v, expected);
+    assert((moves == 1) == relocates);
+
+    moves = 0;
+    v.emplace(v.begin() + 3, -3);
+    expected.emplace(expected.begin() + 3, -3);
+    check(v, expected);
+    assert((moves == 1) == relocates);
+
+    moves = 0;
+    v.insert(v.begin() + 4, 3, v[8]);
+    expected.insert(expected.begin() + 4, 3, expected[8]);
+    check(v, expected);
+    assert((moves == 0) == relocates);
+
+    moves = 0;
+    T range[] = {T(-4), T(-5)};
+    v.insert(v.end() - 1, range, range + 2);
+    expected.insert(expected.end() - 1, {-4, -5});
+    check(v, expected);
+    assert((moves == 0) == relocates);
+
+    moves = 0;
+    v.erase(v.begin() + 20);
+    expected.erase(expected.begin() + 20);
+    v.erase(v.begin(), v.begin() + 5);
+    expected.erase(expected.begin(), expected.begin() + 5);
+    v.erase(v.end() - 10, v.end());
+    expected.erase(expected.end() - 10, expected.end());
+    check(v, expected);
+    assert((moves == 0) == relocates);
+
+    assert(live == static_cast<int>(v.size()) + 2);
+  }
+  assert(live == 0);
+}
+
+#ifndef TEST_HAS_NO_EXCEPTIONS
+// A type that vector copies when it reallocates, because its move constructor may throw, and whose copy
+// constructor throws once copies_left reaches zero.
+static int copies_left = -1;
+
+template <bool Relocatable>
+struct ThrowingCopy {
+  int value;
+
+  explicit ThrowingCopy(int v) : value(v) {}
+  ThrowingCopy(const ThrowingCopy& other) : value(other.value) {
+    if (copies_left == 0)
+      throw 1;
+    --copies_left;
+  }
+  ThrowingCopy(ThrowingCopy&& other) : value(other.value) {}
+  ThrowingCopy& operator=(const ThrowingCopy&) = default;
+  ThrowingCopy& operator=(ThrowingCopy&&) = default;
+};
+
+namespace std {
+template <>
+struct __libcpp_is_trivially_relocatable<ThrowingCopy<true> > : true_type {};
+} // namespace std
+
+// If copying the elements to the new buffer throws, the vector is left as it was.
+void test_throwing_copy() {
+  for (int throw_after = 0; throw_after != 8; ++throw_after) {
+    std::vector<ThrowingCopy<false> > v;
+    v.reserve(8);
+    for (int i = 0; i != 8; ++i)
+      v.push_back(ThrowingCopy<false>(i));
+    ThrowingCopy<false> x(-1);
+    copies_left = throw_after;
+    try {
+      v.insert(v.begin() + 2, x);
+      assert(false);
+    } catch (int) {
+    }
+    try {
+      v.reserve(16);
+      assert(false);
+    } catch (int) {
+    }
+    copies_left = -1;
+    assert(v.size() == 8);
+    for (int i = 0; i != 8; ++i)
+      assert(v[i].value == i);
+  }
+}
+
+// If constructing the elements inserted within the capacity throws, the elements relocated to make
+// room for them are relocated back.
+void test_throwing_insert() {
+  for (int throw_after = 0; throw_after != 3; ++throw_after) {
+    std::vector<ThrowingCopy<true> > v;
+    v.reserve(16);
+    for (int i = 0; i != 8; ++i)
+      v.push_back(ThrowingCopy<true>(i));
+    ThrowingCopy<true> range[] = {ThrowingCopy<true>(-1), ThrowingCopy<true>(-2), ThrowingCopy<true>(-3)};
+    copies_left = throw_after;
+    try {
+      v.insert(v.begin() + 2, range, range + 3);
+      assert(false);
+    } catch (int) {
+    }
+    copies_left = throw_after;
+    try {
+      v.insert(v.begin() + 3, 3, v[5]);
+      assert(false);
+    } catch (int) {
+    }
+    copies_left = 0;
+    try {
+      v.insert(v.begin() + 4, v[6]);
+      assert(false);
+    } catch (int) {
+    }
+    copies_left = -1;
+    assert(v.size() == 8);
+    for (int i = 0; i != 8; ++i)
+      assert(v[i].value == i);
+  }
+}
+#endif
+
+int main(int, char**) {
+  test<Counted<true>, std::allocator<Counted<true> > >(true);
+  test<Counted<true>, min_allocator<Counted<true> > >(true);
+  test<Counted<true>, construct_allocator<Counted<true> > >(false);
+  test<Counted<false>, std::allocator<Counted<false> > >(false);
+#ifndef TEST_HAS_NO_EXCEPTIONS
+  test_throwing_copy();
+  test_throwing_insert();
+#endif
+
+  return 0;
+}
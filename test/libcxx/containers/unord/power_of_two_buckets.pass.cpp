@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03
+
+// ADDITIONAL_COMPILE_FLAGS: -D_LIBCPP_ABI_UNORDERED_POWER_OF_TWO_BUCKETS
+
+// Not a portable test
+
+// With _LIBCPP_ABI_UNORDERED_POWER_OF_TWO_BUCKETS, the unordered containers
+// only ever have power-of-two bucket counts, and they still spread keys that
+// differ only in their high bits across their buckets.
+
+#include <unordered_map>
+#include <unordered_set>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "test_macros.h"
+
+bool is_power_of_two(std::size_t n) { return n != 0 && (n & (n - 1)) == 0; }
+
+// Returns the number of elements in the fullest bucket.
+template <class C>
+std::size_t max_bucket_size(const C& c) {
+  std::size_t m = 0;
+  for (std::size_t b = 0; b < c.bucket_count(); ++b)
+    if (c.bucket_size(b) > m)
+      m = c.bucket_size(b);
+  return m;
+}
+
+template <class T>
+const T& key(const T& x) { return x; }
+
+template <class K, class V>
+const K& key(const std::pair<const K, V>& x) { return x.first; }
+
+template <class C>
+void check_buckets(const C& c) {
+  assert(is_power_of_two(c.bucket_count()));
+  std::size_t n = 0;
+  for (std::size_t b = 0; b < c.bucket_count(); ++b) {
+    for (auto i = c.begin(b); i != c.end(b); ++i)
+      assert(c.bucket(key(*i)) == b);
+    n += c.bucket_size(b);
+  }
+  assert(n == c.size());
+}
+
+void test_bucket_counts() {
+  for (std::size_t n : {1, 2, 3, 5, 7, 8, 9, 100, 1000, 1024, 1025}) {
+    std::unordered_set<int> s(n);
+    assert(is_power_of_two(s.bucket_count()));
+    assert(s.bucket_count() >= n);
+    s.reserve(3 * n);
+    assert(is_power_of_two(s.bucket_count()));
+    assert(s.bucket_count() * s.max_load_factor() >= 3 * n);
+  }
+
+  std::unordered_set<int> s;
+  for (int i = 0; i < 5000; ++i) {
+    s.insert(i);
+    assert(is_power_of_two(s.bucket_count()));
+    assert(s.load_factor() <= s.max_load_factor());
+  }
+  check_buckets(s);
+
+  for (int i = 0; i < 4900; ++i)
+    s.erase(i);
+  s.rehash(0);
+  assert(is_power_of_two(s.bucket_count()));
+  assert(s.bucket_count() < 1024);
+  check_buckets(s);
+  for (int i = 4900; i < 5000; ++i)
+    assert(s.count(i) == 1);
+
+  s.max_load_factor(4.0f);
+  s.rehash(0);
+  assert(is_power_of_two(s.bucket_count()));
+  check_buckets(s);
+}
+
+void test_spread() {
+  // The identity std::hash of multiples of a large power of two would put
+  // all these keys in bucket 0 if the hash were only masked.
+  {
+    std::unordered_set<std::uint64_t> s;
+    for (std::uint64_t i = 0; i < 4096; ++i)
+      s.insert(i << 20);
+    check_buckets(s);
+    assert(max_bucket_size(s) < 16);
+  }
+  {
+    std::unordered_set<std::size_t> s;
+    for (std::size_t i = 0; i < 4096; ++i)
+      s.insert(i << (sizeof(std::size_t) * 8 - 12));
+    check_buckets(s);
+    assert(max_bucket_size(s) < 16);
+  }
+  {
+    std::vector<int> v(4096);
+    std::unordered_set<int*> s;
+    for (int& x : v)
+      s.insert(&x);
+    check_buckets(s);
+    assert(max_bucket_size(s) < 16);
+  }
+}
+
+void test_containers() {
+  std::unordered_map<int, int> m;
+  std::unordered_multimap<int, int> mm;
+  for (int i = 0; i < 1000; ++i) {
+    m[i * 64] = i;
+    mm.emplace(i % 100, i);
+  }
+  check_buckets(mm);
+  for (int i = 0; i < 1000; ++i)
+    assert(m.at(i * 64) == i);
+  assert(m.find(1) == m.end());
+  for (int i = 0; i < 100; ++i)
+    assert(mm.count(i) == 10);
+
+  std::unordered_map<int, int> copy = m;
+  assert(copy == m);
+  assert(is_power_of_two(copy.bucket_count()));
+
+  std::unordered_multiset<int> ms(mm.bucket_count());
+  for (auto& p : mm)
+    ms.insert(p.first);
+  check_buckets(ms);
+  assert(ms.count(42) == 10);
+}
+
+int main(int, char**) {
+  test_bucket_counts();
+  test_spread();
+  test_containers();
+
+  return 0;
+}
@@ -97,6 +97,8 @@ END-SCRIPT
 #if !defined(_LIBCPP_HAS_NO_FILESYSTEM_LIBRARY)
 #   include <filesystem>
 #endif
+#include <flat_map>
+#include <flat_set>
 #include <float.h>
 #include <format>
 #include <forward_list>
@@ -213,12 +215,24 @@ END-SCRIPT
 #if __cplusplus >= 201103L
 #   include <experimental/algorithm>
 #endif
+#if __cplusplus >= 201703L
+#   include <experimental/btree_map>
+#endif
+#if __cplusplus >= 201703L
+#   include <experimental/btree_set>
+#endif
 #if __cplusplus >= 201103L && !defined(_LIBCPP_HAS_NO_EXPERIMENTAL_COROUTINES)
 #   include <experimental/coroutine>
 #endif
 #if __cplusplus >= 201103L
 #   include <experimental/deque>
 #endif
+#if __cplusplus >= 201703L
+#   include <experimental/flat_hash_map>
+#endif
+#if __cplusplus >= 201703L
+#   include <experimental/flat_hash_set>
+#endif
 #if __cplusplus >= 201103L
 #   include <experimental/forward_list>
 #endif
@@ -240,6 +254,9 @@ END-SCRIPT
 #if __cplusplus >= 201103L
 #   include <experimental/propagate_const>
 #endif
+#if __cplusplus >= 201103L
+#   include <experimental/queue>
+#endif
 #if !defined(_LIBCPP_HAS_NO_LOCALIZATION) && __cplusplus >= 201103L
 #   include <experimental/regex>
 #endif
@@ -0,0 +1,172 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03
+
+// <experimental/algorithm>
+
+// template <class RandomAccessIterator, class Compare>
+// void stable_sort(RandomAccessIterator first, RandomAccessIterator last,
+//                  Compare comp, pmr::memory_resource* scratch);
+// template <class BidirectionalIterator, class Compare>
+// void inplace_merge(BidirectionalIterator first, BidirectionalIterator middle,
+//                    BidirectionalIterator last, Compare comp, pmr::memory_resource* scratch);
+// template <class ForwardIterator, class Predicate>
+// ForwardIterator stable_partition(ForwardIterator first, ForwardIterator last,
+//                                  Predicate pred, pmr::memory_resource* scratch);
+
+#include <experimental/algorithm>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "test_macros.h"
+#include "test_memory_resource.h"
+
+// Allocates up to Capacity bytes at a time from new, and throws bad_alloc for anything larger.
+template <std::size_t Capacity>
+struct BoundedProvider {
+  BoundedProvider() {}
+  void* allocate(std::size_t s, std::size_t) {
+    if (s > Capacity)
+      TEST_THROW(std::bad_alloc());
+    return ::operator new(s);
+  }
+  void deallocate(void* p, std::size_t, std::size_t) { ::operator delete(p); }
+  void reset() {}
+
+private:
+  DISALLOW_COPY(BoundedProvider);
+};
+
+typedef std::pair<int, int> P;
+
+struct FirstLess {
+  bool operator()(const P& x, const P& y) const { return x.first < y.first; }
+};
+
+struct FirstIsEven {
+  bool operator()(const P& x) const { return x.first % 2 == 0; }
+};
+
+// Keys with many duplicates, each tagged with its original position to check stability against.
+std::vector<P> make_input(int n) {
+  std::vector<P> v;
+  unsigned state = 1;
+  for (int i = 0; i != n; ++i) {
+    state = state * 1103515245 + 12345;
+    v.push_back(P(static_cast<int>((state >> 16) % 64), i));
+  }
+  return v;
+}
+
+template <class Resource>
+void test_stable_sort(Resource& resource, int n) {
+  resource.reset();
+  std::vector<P> v = make_input(n);
+  std::vector<P> expected = v;
+  std::stable_sort(expected.begin(), expected.end(), FirstLess());
+  std::experimental::stable_sort(v.begin(), v.end(), FirstLess(), &resource);
+  assert(v == expected);
+
+  std::vector<int> keys;
+  for (const P& x : make_input(n))
+    keys.push_back(x.first);
+  std::experimental::stable_sort(keys.begin(), keys.end(), &resource);
+  assert(std::is_sorted(keys.begin(), keys.end()));
+  assert(resource.getController().alive == 0);
+}
+
+template <class Resource>
+void test_inplace_merge(Resource& resource, int n) {
+  resource.reset();
+  std::vector<P> v = make_input(n);
+  std::vector<P>::iterator middle = v.begin() + n / 3;
+  std::stable_sort(v.begin(), middle, FirstLess());
+  std::stable_sort(middle, v.end(), FirstLess());
+  std::vector<P> expected = v;
+  std::inplace_merge(expected.begin(), expected.begin() + n / 3, expected.end(), FirstLess());
+  std::experimental::inplace_merge(v.begin(), middle, v.end(), FirstLess(), &resource);
+  assert(v == expected);
+
+  std::list<int> l;
+  for (int i = 0; i != n; ++i)
+    l.push_back(i < n / 2 ? 2 * i : 2 * (i - n / 2) + 1);
+  std::list<int>::iterator lmiddle = l.begin();
+  std::advance(lmiddle, n / 2);
+  std::experimental::inplace_merge(l.begin(), lmiddle, l.end(), &resource);
+  assert(std::is_sorted(l.begin(), l.end()));
+  assert(resource.getController().alive == 0);
+}
+
+template <class Resource>
+void test_stable_partition(Resource& resource, int n) {
+  resource.reset();
+  std::vector<P> v = make_input(n);
+  std::vector<P> expected = v;
+  std::vector<P>::iterator expected_mid = std::stable_partition(expected.begin(), expected.end(), FirstIsEven());
+  std::vector<P>::iterator mid = std::experimental::stable_partition(v.begin(), v.end(), FirstIsEven(), &resource);
+  assert(v == expected);
+  assert(mid - v.begin() == expected_mid - expected.begin());
+
+  std::list<P> l(expected.rbegin(), expected.rend());
+  std::list<P> lexpected = l;
+  std::stable_partition(lexpected.begin(), lexpected.end(), FirstIsEven());
+  std::experimental::stable_partition(l.begin(), l.end(), FirstIsEven(), &resource);
+  assert(l == lexpected);
+  assert(resource.getController().alive == 0);
+}
+
+template <class Resource>
+void test(Resource& resource) {
+  for (int n : {0, 1, 2, 3, 10, 100, 1000, 20000}) {
+    test_stable_sort(resource, n);
+    test_inplace_merge(resource, n);
+    test_stable_partition(resource, n);
+  }
+}
+
+int main(int, char**) {
+  {
+    NewDeleteResource resource;
+    test(resource);
+
+    // Small ranges are merged without allocating.
+    std::vector<int> v(100);
+    resource.reset();
+    std::experimental::stable_sort(v.begin(), v.end(), &resource);
+    assert(resource.getController().alloc_count == 0);
+
+    // Larger ones allocate once.
+    v.resize(10000);
+    resource.reset();
+    std::experimental::stable_sort(v.begin(), v.end(), &resource);
+    assert(resource.getController().alloc_count == 1);
+    assert(resource.getController().checkDealloc(resource.getController().last_alloc_pointer,
+                                                 10000 * sizeof(int), alignof(int)));
+  }
+#ifndef TEST_HAS_NO_EXCEPTIONS
+  {
+    // Room for half a range of 20000 pairs: the algorithms get a smaller buffer than they asked for.
+    TestResourceImp<BoundedProvider<20000 * sizeof(P) / 2>, 1> resource;
+    test(resource);
+  }
+  {
+    // No room at all: the algorithms merge through their own small buffer.
+    TestResourceImp<BoundedProvider<0>, 2> resource;
+    test(resource);
+  }
+#endif
+
+  return 0;
+}
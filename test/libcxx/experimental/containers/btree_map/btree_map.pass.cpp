@@ -0,0 +1,210 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+
+// <experimental/btree_map>
+
+// template <class Key, class T, class Compare = less<Key>,
+//           class Allocator = allocator<pair<const Key, T>>>
+// class btree_map;
+
+#include <experimental/btree_map>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "min_allocator.h"
+#include "test_allocator.h"
+#include "test_macros.h"
+
+template <class Map, class Ref>
+void check_equal(const Map& m, const Ref& ref) {
+  assert(m.size() == ref.size());
+  auto it = m.begin();
+  for (const auto& v : ref) {
+    assert(it->first == v.first);
+    assert(it->second == v.second);
+    ++it;
+  }
+  assert(it == m.end());
+}
+
+// Inserts, assigns and erases random keys through the different members, and checks the elements
+// against map's. Keys are copied to an array of their own in the nodes of maps with integer keys.
+template <class Key, class T, class Alloc, class KeyGen, class ValueGen>
+void test_random(KeyGen key, ValueGen value, int n) {
+  typedef std::experimental::btree_map<Key, T, std::less<Key>, Alloc> Map;
+  std::mt19937 rng(n);
+  Map m;
+  std::map<Key, T> ref;
+  for (int i = 0; i != n; ++i) {
+    Key k = key(rng);
+    T v = value(rng);
+    switch (i % 5) {
+    case 0:
+      assert(m.emplace(k, v).second == ref.emplace(k, v).second);
+      break;
+    case 1:
+      m[k] = v;
+      ref[k] = v;
+      break;
+    case 2:
+      assert(m.insert_or_assign(m.lower_bound(k), k, v)->second == v);
+      ref.insert_or_assign(k, v);
+      break;
+    case 3:
+      assert(m.try_emplace(m.upper_bound(k), k, v)->first == k);
+      ref.try_emplace(k, v);
+      break;
+    case 4:
+      assert(m.insert(std::make_pair(k, v)).second == ref.insert(std::make_pair(k, v)).second);
+      break;
+    }
+  }
+  check_equal(m, ref);
+  for (int i = 0; i != n; ++i) {
+    Key k = key(rng);
+    assert(m.erase(k) == ref.erase(k));
+    auto it = m.find(key(rng));
+    if (it != m.end()) {
+      auto e = ref.find(it->first);
+      assert(e != ref.end() && e->second == it->second);
+      if (i % 3 == 0) {
+        auto next = m.erase(it);
+        auto enext = ref.erase(e);
+        assert(next == m.end() ? enext == ref.end() : next->first == enext->first);
+      }
+    }
+  }
+  check_equal(m, ref);
+}
+
+void test_basic() {
+  typedef std::experimental::btree_map<int, double> Map;
+  static_assert(std::is_same<typename std::iterator_traits<Map::iterator>::iterator_category,
+                             std::bidirectional_iterator_tag>::value, "");
+  static_assert(std::is_convertible<Map::iterator, Map::const_iterator>::value, "");
+  static_assert(!std::is_convertible<Map::const_iterator, Map::iterator>::value, "");
+
+  Map m;
+  for (int i = 0; i != 1000; ++i)
+    m[i] = i / 2.0;
+  assert(m.size() == 1000);
+  assert(m.at(10) == 5.0);
+  const Map& c = m;
+  assert(c.at(999) == 499.5);
+#ifndef TEST_HAS_NO_EXCEPTIONS
+  try {
+    (void)m.at(1000);
+    assert(false);
+  } catch (const std::out_of_range&) {
+  }
+#endif
+  for (auto it = m.begin(); it != m.end(); ++it)
+    it->second = -it->second;
+  assert(m.rbegin()->first == 999 && m.rbegin()->second == -499.5);
+  assert(m.value_comp()(*m.begin(), *std::next(m.begin())));
+  assert(!m.try_emplace(5, 1.0).second);
+  assert(m.at(5) == -2.5);
+  assert(!m.insert_or_assign(5, 1.0).second);
+  assert(m.at(5) == 1.0);
+  assert(m.count(5) == 1 && m.contains(5) && !m.contains(-1));
+
+  auto it = m.erase(m.lower_bound(100), m.upper_bound(899));
+  assert(it->first == 900);
+  assert(m.size() == 200);
+  auto n = erase_if(m, [](const Map::value_type& v) { return v.first % 2 == 0; });
+  assert(n == 100 && m.size() == 100);
+  for (const auto& v : m)
+    assert(v.first % 2 == 1);
+
+  Map d = m;
+  assert(d == m);
+  d.begin()->second = 100.0;
+  assert(d != m && m < d);
+  Map e(std::move(d), std::allocator<std::pair<const int, double>>());
+  assert(e.size() == 100);
+}
+
+void test_allocators() {
+  typedef test_allocator<std::pair<const int, std::string>> Alloc;
+  typedef std::experimental::btree_map<int, std::string, std::less<int>, Alloc> Map;
+  Map a(Alloc(1));
+  for (int i = 0; i != 500; ++i)
+    a.emplace(i, std::to_string(i));
+  Map b(a, Alloc(2));
+  assert(b == a);
+  assert(b.get_allocator() == Alloc(2));
+  Map c(std::move(a), Alloc(3));
+  assert(c == b);
+  Map d(Alloc(4));
+  d = std::move(c);
+  assert(d == b);
+  assert(d.get_allocator() == Alloc(4));
+}
+
+void test_move_only() {
+  std::experimental::btree_map<int, std::unique_ptr<int>> m;
+  for (int i = 0; i != 1000; ++i)
+    m.emplace(i * 7 % 1000, std::unique_ptr<int>(new int(i * 7 % 1000)));
+  for (int i = 0; i < 1000; i += 2)
+    assert(m.erase(i) == 1);
+  assert(m.size() == 500);
+  for (const auto& v : m)
+    assert(*v.second == v.first);
+}
+
+void test_transparent() {
+  std::experimental::btree_map<std::string, int, std::less<>> m = {{"abc", 1}, {"def", 2}, {"ghi", 3}};
+  std::string_view key = "def";
+  assert(m.find(key)->second == 2);
+  assert(m.count(key) == 1);
+  assert(m.contains("ghi"));
+  assert(m.lower_bound(std::string_view("b"))->second == 2);
+  auto er = m.equal_range(key);
+  assert(std::distance(er.first, er.second) == 1);
+}
+
+int main(int, char**) {
+  test_basic();
+  test_allocators();
+  test_move_only();
+  test_transparent();
+
+  auto small = [](std::mt19937& rng) { return static_cast<int>(rng() % 3000); };
+  test_random<int, int, std::allocator<std::pair<const int, int>>>(small, small, 10000);
+  test_random<int, int, min_allocator<std::pair<const int, int>>>(small, small, 2000);
+  test_random<long, std::string, std::allocator<std::pair<const long, std::string>>>(
+      small, [](std::mt19937& rng) { return std::string(rng() % 40, 'x'); }, 3000);
+  test_random<std::string, int, std::allocator<std::pair<const std::string, int>>>(
+      [](std::mt19937& rng) { return std::to_string(rng() % 2000); }, small, 3000);
+  // Nodes of large elements hold the fewest keys that still fill whole vectors.
+  typedef std::array<char, 200> Large;
+  test_random<std::uint64_t, Large, std::allocator<std::pair<const std::uint64_t, Large>>>(
+      [](std::mt19937& rng) { return static_cast<std::uint64_t>(rng() % 3000); },
+      [](std::mt19937& rng) {
+        Large v = {};
+        v[rng() % v.size()] = 'x';
+        return v;
+      },
+      3000);
+
+  return 0;
+}
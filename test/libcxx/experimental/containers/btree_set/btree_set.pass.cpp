@@ -0,0 +1,221 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+
+// <experimental/btree_set>
+
+// template <class Key, class Compare = less<Key>, class Allocator = allocator<Key>>
+// class btree_set;
+
+#include <experimental/btree_set>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "min_allocator.h"
+#include "test_allocator.h"
+#include "test_macros.h"
+
+template <class Set, class Ref>
+void check_equal(const Set& s, const Ref& ref) {
+  assert(s.size() == ref.size());
+  assert(static_cast<std::size_t>(std::distance(s.begin(), s.end())) == ref.size());
+  auto it = s.begin();
+  for (const auto& v : ref) {
+    assert(*it == v);
+    ++it;
+  }
+  assert(it == s.end());
+  auto rit = s.rbegin();
+  for (auto i = ref.rbegin(); i != ref.rend(); ++i) {
+    assert(*rit == *i);
+    ++rit;
+  }
+  assert(rit == s.rend());
+}
+
+// Inserts and erases random keys, enough for the tree to grow a few levels and shrink back, and
+// checks the elements and the lookups against set's.
+template <class Key, class Compare, class Alloc, class Gen>
+void test_random(Gen gen, int n) {
+  typedef std::experimental::btree_set<Key, Compare, Alloc> Set;
+  std::mt19937 rng(n);
+  Set s;
+  std::set<Key, Compare> ref;
+  for (int i = 0; i != n; ++i) {
+    Key k = gen(rng);
+    auto r = s.insert(k);
+    auto e = ref.insert(k);
+    assert(r.second == e.second);
+    assert(*r.first == k);
+  }
+  check_equal(s, ref);
+  for (int i = 0; i != n; ++i) {
+    Key k = gen(rng);
+    auto lb = s.lower_bound(k);
+    auto elb = ref.lower_bound(k);
+    assert(lb == s.end() ? elb == ref.end() : *lb == *elb);
+    auto ub = s.upper_bound(k);
+    auto eub = ref.upper_bound(k);
+    assert(ub == s.end() ? eub == ref.end() : *ub == *eub);
+    assert(s.count(k) == ref.count(k));
+    if (i % 2 == 0) {
+      assert(s.erase(k) == ref.erase(k));
+    } else if (elb != ref.end()) {
+      // erase(iterator) returns the element after the erased one, wherever it went.
+      auto next = s.erase(lb);
+      auto enext = ref.erase(elb);
+      assert(next == s.end() ? enext == ref.end() : *next == *enext);
+    }
+  }
+  check_equal(s, ref);
+  while (!s.empty()) {
+    auto next = s.erase(std::next(s.begin(), static_cast<std::ptrdiff_t>(s.size() / 2)));
+    auto enext = ref.erase(std::next(ref.begin(), static_cast<std::ptrdiff_t>(ref.size() / 2)));
+    assert(next == s.end() ? enext == ref.end() : *next == *enext);
+  }
+  assert(ref.empty());
+  assert(s.begin() == s.end());
+}
+
+template <class Alloc>
+void test_basic() {
+  typedef std::experimental::btree_set<int, std::less<int>, Alloc> Set;
+  static_assert(std::is_same<typename std::iterator_traits<typename Set::iterator>::iterator_category,
+                             std::bidirectional_iterator_tag>::value, "");
+  static_assert(std::is_same<typename Set::iterator, typename Set::const_iterator>::value, "");
+
+  Set s;
+  assert(s.empty());
+  assert(s.begin() == s.end());
+  assert(s.find(1) == s.end());
+  assert(s.lower_bound(1) == s.end());
+  assert(s.erase(1) == 0);
+
+  // In order, in reverse order, and with hints, which fill the leaves they leave behind.
+  for (int i = 0; i != 1000; ++i)
+    assert(s.insert(i).second);
+  for (int i = -1; i != -1000; --i)
+    assert(s.insert(s.begin(), i) == s.begin());
+  for (int i = 1000; i != 2000; ++i)
+    assert(*s.emplace_hint(s.end(), i) == i);
+  assert(s.size() == 2999);
+  int expected = -999;
+  for (int v : s)
+    assert(v == expected++);
+  assert(*s.insert(s.find(10), 10) == 10);
+  assert(*s.insert(s.end(), 10) == 10);
+  assert(s.size() == 2999);
+
+  auto er = s.equal_range(5);
+  assert(std::distance(er.first, er.second) == 1 && *er.first == 5);
+  er = s.equal_range(5000);
+  assert(er.first == s.end() && er.second == s.end());
+
+  auto it = s.erase(s.find(100), s.find(1100));
+  assert(*it == 1100);
+  assert(s.size() == 1999);
+  s.clear();
+  assert(s.empty() && s.begin() == s.end());
+}
+
+void test_construct_assign() {
+  typedef std::experimental::btree_set<std::string> Set;
+  Set a = {"one", "two", "three", "two"};
+  assert(a.size() == 3);
+  assert(*a.begin() == "one" && *a.rbegin() == "two");
+  Set b(a.begin(), a.end());
+  assert(b == a);
+  Set c = a;
+  assert(c == a);
+  c.erase("one");
+  assert(c != a);
+  assert(a < c && c > a && a <= c && c >= a);
+  c = a;
+  assert(c == a);
+  Set d = std::move(c);
+  assert(d == a);
+  assert(c.empty());
+  c = {"four"};
+  assert(c.size() == 1 && *c.begin() == "four");
+  d = std::move(c);
+  assert(d.size() == 1 && d.contains("four"));
+  swap(a, d);
+  assert(a.size() == 1 && d.size() == 3);
+}
+
+void test_allocators() {
+  typedef test_allocator<int> Alloc;
+  typedef std::experimental::btree_set<int, std::less<int>, Alloc> Set;
+  Set a(Alloc(1));
+  for (int i = 0; i != 500; ++i)
+    a.insert(i);
+  Set b(a, Alloc(2));
+  assert(b == a);
+  assert(b.get_allocator() == Alloc(2));
+  Set c(std::move(a), Alloc(3));
+  assert(c == b);
+  assert(c.get_allocator() == Alloc(3));
+  // Allocators that do not propagate on move assignment and are not equal move the elements one by one.
+  Set d(Alloc(4));
+  d = std::move(c);
+  assert(d == b);
+  assert(d.get_allocator() == Alloc(4));
+}
+
+void test_transparent() {
+  std::experimental::btree_set<std::string, std::less<>> s = {"abc", "def", "ghi"};
+  std::string_view key = "def";
+  assert(s.find(key) != s.end());
+  assert(s.count(key) == 1);
+  assert(s.contains("ghi"));
+  assert(!s.contains(std::string_view("xyz")));
+  assert(*s.lower_bound(std::string_view("b")) == "def");
+  assert(s.upper_bound(std::string_view("ghi")) == s.end());
+  auto er = s.equal_range(key);
+  assert(std::distance(er.first, er.second) == 1);
+}
+
+void test_erase_if() {
+  std::experimental::btree_set<int> s;
+  for (int i = 0; i != 1000; ++i)
+    s.insert(i);
+  assert(erase_if(s, [](int i) { return i >= 10; }) == 990);
+  std::vector<int> expected = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  assert(std::vector<int>(s.begin(), s.end()) == expected);
+}
+
+int main(int, char**) {
+  test_basic<std::allocator<int>>();
+  test_basic<min_allocator<int>>();
+  test_construct_assign();
+  test_allocators();
+  test_transparent();
+  test_erase_if();
+
+  auto small = [](std::mt19937& rng) { return static_cast<int>(rng() % 3000); };
+  test_random<int, std::less<int>, std::allocator<int>>(small, 10000);
+  test_random<int, std::greater<int>, std::allocator<int>>(small, 10000);
+  test_random<int, std::less<int>, min_allocator<int>>(small, 2000);
+  test_random<unsigned char, std::less<unsigned char>, std::allocator<unsigned char>>(
+      [](std::mt19937& rng) { return static_cast<unsigned char>(rng()); }, 1000);
+  test_random<long long, std::less<long long>, std::allocator<long long>>(
+      [](std::mt19937& rng) { return static_cast<long long>(rng() % 100000) - 50000; }, 10000);
+  test_random<std::string, std::less<std::string>, std::allocator<std::string>>(
+      [](std::mt19937& rng) { return std::to_string(rng() % 2000); }, 3000);
+
+  return 0;
+}
@@ -0,0 +1,196 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+
+// <experimental/flat_hash_map>
+
+// template <class Key, class T, class Hash = hash<Key>, class Pred = equal_to<Key>,
+//           class Alloc = allocator<pair<const Key, T>>>
+// class flat_hash_map;
+
+#include <experimental/flat_hash_map>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "min_allocator.h"
+#include "test_macros.h"
+
+template <class Map, class Reference>
+bool matches(const Map& m, const Reference& ref) {
+  if (m.size() != ref.size() || static_cast<std::size_t>(std::distance(m.begin(), m.end())) != ref.size())
+    return false;
+  for (const auto& p : ref) {
+    auto it = m.find(p.first);
+    if (it == m.end() || it->second != p.second)
+      return false;
+  }
+  return true;
+}
+
+template <class Alloc>
+void test_against_map() {
+  typedef std::experimental::flat_hash_map<int, std::string, std::hash<int>, std::equal_to<int>, Alloc> Map;
+  Map m;
+  std::map<int, std::string> ref;
+  // A deterministic mix of insertions and erasures, over few enough keys that slots get reused.
+  unsigned x = 1;
+  for (int i = 0; i != 20000; ++i) {
+    x = x * 1103515245 + 12345;
+    int k = static_cast<int>((x >> 8) % 1500);
+    std::string v = std::to_string(i);
+    switch ((x >> 20) % 6) {
+    case 0:
+      m[k] = v;
+      ref[k] = v;
+      break;
+    case 1:
+      assert(m.try_emplace(k, v).second == ref.try_emplace(k, v).second);
+      break;
+    case 2:
+      assert(m.insert_or_assign(k, v).second == ref.insert_or_assign(k, v).second);
+      break;
+    case 3:
+      assert(m.emplace(k, v).second == ref.emplace(k, v).second);
+      break;
+    case 4:
+      assert(m.insert(std::make_pair(k, v)).second == ref.insert(std::make_pair(k, v)).second);
+      break;
+    case 5:
+      assert(m.erase(k) == ref.erase(k));
+      break;
+    }
+    if (i % 1000 == 0)
+      assert(matches(m, ref));
+  }
+  assert(matches(m, ref));
+}
+
+void test_access() {
+  std::experimental::flat_hash_map<std::string, int> m;
+  m["a"] = 1;
+  ++m["a"];
+  ++m["b"];
+  assert(m.size() == 2);
+  assert(m.at("a") == 2);
+  assert(std::as_const(m).at("b") == 1);
+#ifndef TEST_HAS_NO_EXCEPTIONS
+  try {
+    (void)m.at("c");
+    assert(false);
+  } catch (const std::out_of_range&) {
+  }
+#endif
+  assert(m.size() == 2);
+
+  auto r = m.try_emplace("a", 10);
+  assert(!r.second && r.first->second == 2);
+  r = m.insert_or_assign("a", 10);
+  assert(!r.second && r.first->second == 10);
+  r = m.emplace(std::piecewise_construct, std::forward_as_tuple("c"), std::forward_as_tuple(3));
+  assert(r.second && r.first->first == "c" && r.first->second == 3);
+  auto it = m.emplace_hint(m.end(), "d", 4);
+  assert(it->first == "d" && it->second == 4);
+  it = m.try_emplace(m.begin(), "e", 5);
+  assert(it->first == "e" && it->second == 5);
+
+  // try_emplace does not move from its arguments if the key is there already.
+  std::string key = "a";
+  std::unique_ptr<int> p(new int(5));
+  std::experimental::flat_hash_map<std::string, std::unique_ptr<int>> u;
+  u.try_emplace(key, std::move(p));
+  assert(!p && *u.at("a") == 5);
+  p.reset(new int(6));
+  assert(!u.try_emplace(std::move(key), std::move(p)).second);
+  assert(p && key == "a");
+}
+
+// The arguments of insertions may refer to elements of the map, even when the map grows.
+void test_aliasing() {
+  std::experimental::flat_hash_map<int, std::string> m;
+  m[0] = std::string(100, 'x');
+  for (int i = 1; i != 1000; ++i)
+    m.try_emplace(i, m.at(i - 1));
+  for (int i = 1000; i != 2000; ++i)
+    m.insert_or_assign(i, m.at(i - 1000));
+  for (int i = 0; i != 2000; ++i)
+    assert(m.at(i) == std::string(100, 'x'));
+}
+
+void test_copy_move() {
+  typedef std::experimental::flat_hash_map<int, std::string> Map;
+  Map a = {{1, "one"}, {2, "two"}, {3, "three"}};
+  Map b = a;
+  assert(a == b);
+  b[3] = "drei";
+  assert(a != b);
+  b = a;
+  assert(a == b);
+  Map c = std::move(b);
+  assert(c == a && b.empty());
+  c.erase(c.find(1));
+  assert(c.size() == 2 && !c.contains(1));
+  swap(a, c);
+  assert(a.size() == 2 && c.size() == 3);
+  a = std::move(c);
+  assert(a.size() == 3 && a.at(1) == "one");
+
+  std::experimental::flat_hash_map<std::string, std::unique_ptr<int>> u;
+  for (int i = 0; i != 1000; ++i)
+    u.emplace(std::to_string(i), std::unique_ptr<int>(new int(i)));
+  auto v = std::move(u);
+  for (int i = 0; i != 1000; ++i)
+    assert(*v.at(std::to_string(i)) == i);
+}
+
+struct TransparentHash {
+  typedef void is_transparent;
+  std::size_t operator()(std::string_view s) const { return std::hash<std::string_view>()(s); }
+};
+
+void test_transparent() {
+  std::experimental::flat_hash_map<std::string, int, TransparentHash, std::equal_to<>> m = {{"abc", 1}, {"def", 2}};
+  std::string_view key = "abc";
+  assert(m.find(key)->second == 1);
+  assert(m.count(key) == 1);
+  assert(m.contains(std::string_view("def")));
+  assert(!m.contains(std::string_view("xyz")));
+  auto er = m.equal_range(key);
+  assert(std::distance(er.first, er.second) == 1);
+}
+
+void test_erase_if() {
+  std::experimental::flat_hash_map<int, int> m;
+  for (int i = 0; i != 100; ++i)
+    m[i] = i * i;
+  assert(erase_if(m, [](const std::pair<const int, int>& p) { return p.second % 2 == 1; }) == 50);
+  assert(m.size() == 50);
+  for (const auto& p : m)
+    assert(p.first % 2 == 0);
+}
+
+int main(int, char**) {
+  test_against_map<std::allocator<std::pair<const int, std::string>>>();
+  test_against_map<min_allocator<std::pair<const int, std::string>>>();
+  test_access();
+  test_aliasing();
+  test_copy_move();
+  test_transparent();
+  test_erase_if();
+
+  return 0;
+}
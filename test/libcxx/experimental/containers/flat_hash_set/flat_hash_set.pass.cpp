@@ -0,0 +1,199 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+
+// <experimental/flat_hash_set>
+
+// template <class Value, class Hash = hash<Value>, class Pred = equal_to<Value>,
+//           class Alloc = allocator<Value>>
+// class flat_hash_set;
+
+#include <experimental/flat_hash_set>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "min_allocator.h"
+#include "test_allocator.h"
+#include "test_macros.h"
+
+template <class Set>
+std::vector<typename Set::value_type> sorted(const Set& s) {
+  std::vector<typename Set::value_type> v(s.begin(), s.end());
+  std::sort(v.begin(), v.end());
+  return v;
+}
+
+template <class Alloc>
+void test_basic() {
+  typedef std::experimental::flat_hash_set<int, std::hash<int>, std::equal_to<int>, Alloc> Set;
+  static_assert(std::is_same<typename std::iterator_traits<typename Set::iterator>::iterator_category,
+                             std::forward_iterator_tag>::value, "");
+  static_assert(std::is_same<typename Set::iterator, typename Set::const_iterator>::value, "");
+
+  Set s;
+  assert(s.empty());
+  assert(s.size() == 0);
+  assert(s.bucket_count() == 0);
+  assert(s.begin() == s.end());
+  assert(s.find(1) == s.end());
+  assert(s.erase(1) == 0);
+
+  for (int i = 0; i != 1000; ++i) {
+    auto r = s.insert(i);
+    assert(r.second);
+    assert(*r.first == i);
+  }
+  assert(s.size() == 1000);
+  assert(s.load_factor() <= s.max_load_factor());
+  assert(std::distance(s.begin(), s.end()) == 1000);
+  for (int i = 0; i != 1000; ++i) {
+    auto r = s.insert(i);
+    assert(!r.second);
+    assert(*r.first == i);
+    assert(s.count(i) == 1);
+    assert(s.contains(i));
+  }
+  assert(!s.contains(1000));
+  assert(s.count(-1) == 0);
+
+  // Erase the odd ones.
+  for (int i = 1; i < 1000; i += 2)
+    assert(s.erase(i) == 1);
+  assert(s.size() == 500);
+  for (int i = 0; i != 1000; ++i)
+    assert(s.contains(i) == (i % 2 == 0));
+
+  // Elements can be inserted again in the slots of erased ones.
+  for (int i = 1; i < 1000; i += 2)
+    assert(s.emplace(i).second);
+  assert(s.size() == 1000);
+  std::vector<int> expected(1000);
+  for (int i = 0; i != 1000; ++i)
+    expected[i] = i;
+  assert(sorted(s) == expected);
+
+  // erase(iterator) returns the next element.
+  int erased = 0;
+  for (auto it = s.begin(); it != s.end();) {
+    if (*it % 3 == 0) {
+      it = s.erase(it);
+      ++erased;
+    } else
+      ++it;
+  }
+  assert(erased == 334);
+  assert(s.size() == 666);
+
+  auto er = s.equal_range(1);
+  assert(std::distance(er.first, er.second) == 1);
+  er = s.equal_range(3);
+  assert(er.first == s.end() && er.second == s.end());
+
+  s.erase(s.begin(), s.end());
+  assert(s.empty());
+  assert(s.bucket_count() != 0);
+  s.rehash(0);
+  assert(s.bucket_count() == 0);
+}
+
+void test_construct_assign() {
+  typedef std::experimental::flat_hash_set<std::string> Set;
+  Set a = {"one", "two", "three", "two"};
+  assert(a.size() == 3);
+  Set b(a.begin(), a.end());
+  assert(b == a);
+  Set c = a;
+  assert(c == a);
+  c.erase("one");
+  assert(c != a);
+  c = a;
+  assert(c == a);
+  Set d = std::move(c);
+  assert(d == a);
+  assert(c.empty());
+  c = {"four"};
+  assert(c.size() == 1 && *c.begin() == "four");
+  d = std::move(c);
+  assert(d.size() == 1 && d.contains("four"));
+  swap(a, d);
+  assert(a.size() == 1 && d.size() == 3);
+
+  Set e(100);
+  std::size_t buckets = e.bucket_count();
+  assert(buckets * 7 / 8 >= 100);
+  for (int i = 0; i != 100; ++i)
+    e.insert(std::to_string(i));
+  assert(e.bucket_count() == buckets);
+  e.clear();
+  assert(e.empty() && e.bucket_count() == buckets);
+  e.reserve(1000);
+  assert(e.bucket_count() * 7 / 8 >= 1000);
+}
+
+void test_allocators() {
+  typedef test_allocator<int> Alloc;
+  typedef std::experimental::flat_hash_set<int, std::hash<int>, std::equal_to<int>, Alloc> Set;
+  Set a(Alloc(1));
+  for (int i = 0; i != 100; ++i)
+    a.insert(i);
+  Set b(a, Alloc(2));
+  assert(b == a);
+  assert(b.get_allocator() == Alloc(2));
+  Set c(std::move(a), Alloc(3));
+  assert(c == b);
+  assert(c.get_allocator() == Alloc(3));
+  // Allocators that do not propagate on move assignment and are not equal move the elements one by one.
+  Set d(Alloc(4));
+  d = std::move(c);
+  assert(d == b);
+  assert(d.get_allocator() == Alloc(4));
+}
+
+struct TransparentHash {
+  typedef void is_transparent;
+  std::size_t operator()(std::string_view s) const { return std::hash<std::string_view>()(s); }
+};
+
+void test_transparent() {
+  std::experimental::flat_hash_set<std::string, TransparentHash, std::equal_to<>> s = {"abc", "def"};
+  std::string_view key = "abc";
+  assert(s.find(key) != s.end());
+  assert(s.count(key) == 1);
+  assert(s.contains("def"));
+  assert(!s.contains(std::string_view("xyz")));
+  auto er = s.equal_range(key);
+  assert(std::distance(er.first, er.second) == 1);
+}
+
+void test_erase_if() {
+  std::experimental::flat_hash_set<int> s;
+  for (int i = 0; i != 100; ++i)
+    s.insert(i);
+  assert(erase_if(s, [](int i) { return i >= 10; }) == 90);
+  std::vector<int> expected = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  assert(sorted(s) == expected);
+}
+
+int main(int, char**) {
+  test_basic<std::allocator<int>>();
+  test_basic<min_allocator<int>>();
+  test_construct_assign();
+  test_allocators();
+  test_transparent();
+  test_erase_if();
+
+  return 0;
+}
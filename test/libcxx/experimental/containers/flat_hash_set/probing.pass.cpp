@@ -0,0 +1,125 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+
+// <experimental/flat_hash_set>
+
+// Lookups probe past colliding elements and erased slots, tables that are mostly erased slots are
+// rehashed instead of grown, and growing a table that copies its elements gives the strong
+// exception guarantee.
+
+#include <experimental/flat_hash_set>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+
+#include "test_macros.h"
+
+// Hashes all keys to a few values, so that whole groups of slots match.
+struct CollidingHash {
+  std::size_t operator()(int i) const { return static_cast<std::size_t>(i % 3); }
+};
+
+void test_collisions() {
+  std::experimental::flat_hash_set<int, CollidingHash> s;
+  for (int i = 0; i != 300; ++i)
+    assert(s.insert(i).second);
+  for (int i = 0; i != 300; ++i)
+    assert(s.contains(i));
+  assert(!s.contains(300));
+  for (int i = 0; i < 300; i += 2)
+    assert(s.erase(i) == 1);
+  for (int i = 0; i != 300; ++i)
+    assert(s.contains(i) == (i % 2 == 1));
+  for (int i = 0; i < 300; i += 2)
+    assert(s.insert(i).second);
+  assert(s.size() == 300);
+}
+
+void test_churn() {
+  std::experimental::flat_hash_set<int> s;
+  for (int i = 0; i != 80; ++i)
+    s.insert(i);
+  std::size_t buckets = s.bucket_count();
+  // Keep the size constant while inserting and erasing many different keys: the erased slots are
+  // reclaimed rather than making the table grow.
+  for (int i = 80; i != 100000; ++i) {
+    assert(s.insert(i).second);
+    assert(s.erase(i - 80) == 1);
+    assert(s.size() == 80);
+  }
+  assert(s.bucket_count() == buckets);
+  for (int i = 99920; i != 100000; ++i)
+    assert(s.contains(i));
+}
+
+#ifndef TEST_HAS_NO_EXCEPTIONS
+// Copies throw once enough of them have been made. Moving may throw too, so the tables copy.
+struct ThrowingCopy {
+  static int copies_left;
+  static int live;
+  int value;
+
+  ThrowingCopy(int v) : value(v) { ++live; }
+  ThrowingCopy(const ThrowingCopy& other) : value(other.value) {
+    if (copies_left-- == 0)
+      throw 1;
+    ++live;
+  }
+  ThrowingCopy(ThrowingCopy&& other) noexcept(false) : value(other.value) { ++live; }
+  ~ThrowingCopy() { --live; }
+  friend bool operator==(const ThrowingCopy& x, const ThrowingCopy& y) { return x.value == y.value; }
+};
+int ThrowingCopy::copies_left = -1;
+int ThrowingCopy::live = 0;
+
+struct ThrowingCopyHash {
+  std::size_t operator()(const ThrowingCopy& x) const { return std::hash<int>()(x.value); }
+};
+
+void test_strong_guarantee() {
+  {
+    std::experimental::flat_hash_set<ThrowingCopy, ThrowingCopyHash> s;
+    s.reserve(10);
+    std::size_t buckets = s.bucket_count();
+    int i = 0;
+    while (s.bucket_count() == buckets)
+      s.emplace(i++);
+    // The last insertion grew the table. Make the next growth fail halfway.
+    while (s.size() != s.bucket_count() - s.bucket_count() / 8)
+      s.emplace(i++);
+    buckets = s.bucket_count();
+    int size = static_cast<int>(s.size());
+    ThrowingCopy::copies_left = size / 2;
+    try {
+      s.emplace(i);
+      assert(false);
+    } catch (int) {
+    }
+    ThrowingCopy::copies_left = -1;
+    assert(s.bucket_count() == buckets);
+    assert(static_cast<int>(s.size()) == size);
+    assert(ThrowingCopy::live == size);
+    for (int j = 0; j != i; ++j)
+      assert(s.contains(ThrowingCopy(j)));
+    assert(!s.contains(ThrowingCopy(i)));
+  }
+  assert(ThrowingCopy::live == 0);
+}
+#endif
+
+int main(int, char**) {
+  test_collisions();
+  test_churn();
+#ifndef TEST_HAS_NO_EXCEPTIONS
+  test_strong_guarantee();
+#endif
+
+  return 0;
+}
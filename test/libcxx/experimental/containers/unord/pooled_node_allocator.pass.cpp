@@ -0,0 +1,238 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+
+// <experimental/unordered_set>
+// <experimental/unordered_map>
+
+// template <class T, size_t MaxFreeNodes = 64, class Allocator = allocator<T>>
+// class pooled_node_allocator;
+
+// The unordered containers using a pooled_node_allocator keep up to MaxFreeNodes
+// erased nodes, reuse them for their next insertions, and allocate them ahead in
+// reserve().
+
+#include <experimental/unordered_map>
+#include <experimental/unordered_set>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "test_macros.h"
+
+struct AllocStats {
+  static int allocations;
+  static int live;
+};
+int AllocStats::allocations = 0;
+int AllocStats::live = 0;
+
+template <class T>
+struct CountingAllocator {
+  typedef T value_type;
+
+  CountingAllocator() = default;
+  template <class U>
+  CountingAllocator(const CountingAllocator<U>&) {}
+
+  T* allocate(std::size_t n) {
+    ++AllocStats::allocations;
+    ++AllocStats::live;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, std::size_t n) {
+    --AllocStats::live;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <class U>
+  friend bool operator==(const CountingAllocator&, const CountingAllocator<U>&) { return true; }
+  template <class U>
+  friend bool operator!=(const CountingAllocator&, const CountingAllocator<U>&) { return false; }
+};
+
+template <class T, std::size_t N = 16>
+using Pooled = std::experimental::pooled_node_allocator<T, N, CountingAllocator<T> >;
+
+using Set = std::unordered_set<int, std::hash<int>, std::equal_to<int>, Pooled<int> >;
+using MultiSet = std::unordered_multiset<int, std::hash<int>, std::equal_to<int>, Pooled<int> >;
+using Map = std::unordered_map<int, std::string, std::hash<int>, std::equal_to<int>,
+                               Pooled<std::pair<const int, std::string> > >;
+using MultiMap = std::unordered_multimap<int, int, std::hash<int>, std::equal_to<int>,
+                                         Pooled<std::pair<const int, int> > >;
+
+// Without spare nodes to keep, the tables are laid out as with std::allocator.
+static_assert(sizeof(std::unordered_set<int, std::hash<int>, std::equal_to<int>,
+                                        std::experimental::pooled_node_allocator<int, 0> >) ==
+              sizeof(std::unordered_set<int>), "");
+static_assert(sizeof(Set) > sizeof(std::unordered_set<int>), "");
+
+// A set of n elements has n nodes, a bucket array, and the spare nodes.
+void test_churn() {
+  {
+    Set s;
+    for (int i = 0; i != 100; ++i)
+      s.insert(i);
+    assert(AllocStats::live == 101);
+    for (int i = 0; i != 10; ++i)
+      assert(s.erase(i) == 1);
+    assert(AllocStats::live == 101);
+
+    // Steady insert and erase churn doesn't allocate.
+    int allocations = AllocStats::allocations;
+    for (int round = 0; round != 100; ++round) {
+      for (int i = 0; i != 10; ++i)
+        s.insert(1000 + i);
+      for (int i = 0; i != 10; ++i)
+        assert(s.erase(1000 + i) == 1);
+    }
+    assert(AllocStats::allocations == allocations);
+    assert(s.size() == 90);
+    for (int i = 10; i != 100; ++i)
+      assert(s.count(i) == 1);
+
+    // At most 16 erased nodes are kept.
+    s.erase(s.begin(), s.end());
+    assert(s.empty());
+    assert(AllocStats::live == 1 + 16);
+    s.insert(42);
+    assert(AllocStats::live == 1 + 16);
+    s.clear();
+    assert(AllocStats::live == 1 + 16);
+  }
+  assert(AllocStats::live == 0);
+}
+
+void test_reserve() {
+  {
+    Set s;
+    s.reserve(10);
+    assert(AllocStats::live == 1 + 10);
+    int allocations = AllocStats::allocations;
+    for (int i = 0; i != 10; ++i)
+      s.insert(i);
+    assert(AllocStats::allocations == allocations);
+    assert(AllocStats::live == 1 + 10);
+
+    // The nodes already in the set count towards those reserve() allocates,
+    // and at most 16 are allocated ahead.
+    s.reserve(15);
+    assert(AllocStats::live == 1 + 15);
+    s.reserve(1000);
+    assert(AllocStats::live == 1 + 10 + 16);
+    s.reserve(100);
+    assert(AllocStats::live == 1 + 10 + 16);
+  }
+  assert(AllocStats::live == 0);
+  {
+    MultiMap m;
+    m.reserve(8);
+    int allocations = AllocStats::allocations;
+    for (int i = 0; i != 8; ++i)
+      m.emplace(i % 2, i);
+    assert(AllocStats::allocations == allocations);
+    assert(m.count(0) == 4 && m.count(1) == 4);
+  }
+  assert(AllocStats::live == 0);
+}
+
+void test_containers() {
+  {
+    Map m;
+    for (int i = 0; i != 50; ++i)
+      m[i] = std::string(40, static_cast<char>('a' + i % 26));
+    for (int i = 0; i != 50; i += 2)
+      m.erase(i);
+    for (int i = 100; i != 125; ++i)
+      m.try_emplace(i, "reused");
+    assert(m.size() == 50);
+    assert(m.at(1) == std::string(40, 'b'));
+    assert(m.at(124) == "reused");
+
+    Map copy = m;
+    assert(copy == m);
+    Map moved = std::move(copy);
+    assert(moved == m);
+    copy = moved;
+    assert(copy == m);
+    copy.clear();
+    copy.swap(moved);
+    assert(copy == m && moved.empty());
+    moved = std::move(copy);
+    assert(moved == m);
+    for (int i = 1; i < 50; i += 2)
+      moved.erase(i);
+    moved.insert(m.begin(), m.end());
+    assert(moved == m);
+  }
+  assert(AllocStats::live == 0);
+  {
+    MultiSet s;
+    for (int i = 0; i != 40; ++i)
+      s.insert(i % 4);
+    assert(s.erase(0) == 10);
+    for (int i = 0; i != 10; ++i)
+      s.insert(4);
+    assert(s.count(4) == 10 && s.size() == 40);
+    MultiSet t(s, Pooled<int>());
+    assert(t == s);
+  }
+  assert(AllocStats::live == 0);
+}
+
+#ifndef TEST_HAS_NO_EXCEPTIONS
+struct ThrowingKey {
+  static int countdown;
+  int value;
+  ThrowingKey(int v) : value(v) {
+    if (--countdown == 0)
+      throw 1;
+  }
+  bool operator==(const ThrowingKey& other) const { return value == other.value; }
+};
+int ThrowingKey::countdown = 0;
+
+struct ThrowingKeyHash {
+  std::size_t operator()(const ThrowingKey& k) const { return static_cast<std::size_t>(k.value); }
+};
+
+void test_exceptions() {
+  {
+    std::unordered_set<ThrowingKey, ThrowingKeyHash, std::equal_to<ThrowingKey>, Pooled<ThrowingKey> > s;
+    for (int i = 0; i != 20; ++i)
+      s.emplace(i);
+    s.erase(s.begin(), s.end());
+    ThrowingKey::countdown = 1;
+    try {
+      s.emplace(7);
+      assert(false);
+    } catch (int) {
+    }
+    assert(s.empty());
+    s.emplace(8);
+    assert(s.size() == 1);
+  }
+  assert(AllocStats::live == 0);
+}
+#endif
+
+int main(int, char**) {
+  test_churn();
+  test_reserve();
+  test_containers();
+#ifndef TEST_HAS_NO_EXCEPTIONS
+  test_exceptions();
+#endif
+
+  return 0;
+}
@@ -145,6 +145,10 @@ TEST_MACROS();
 #   include <filesystem>
 TEST_MACROS();
 #endif
+#include <flat_map>
+TEST_MACROS();
+#include <flat_set>
+TEST_MACROS();
 #include <float.h>
 TEST_MACROS();
 #include <format>
@@ -333,6 +337,14 @@ TEST_MACROS();
 #   include <experimental/algorithm>
 TEST_MACROS();
 #endif
+#if __cplusplus >= 201703L
+#   include <experimental/btree_map>
+TEST_MACROS();
+#endif
+#if __cplusplus >= 201703L
+#   include <experimental/btree_set>
+TEST_MACROS();
+#endif
 #if __cplusplus >= 201103L && !defined(_LIBCPP_HAS_NO_EXPERIMENTAL_COROUTINES)
 #   include <experimental/coroutine>
 TEST_MACROS();
@@ -341,6 +353,14 @@ TEST_MACROS();
 #   include <experimental/deque>
 TEST_MACROS();
 #endif
+#if __cplusplus >= 201703L
+#   include <experimental/flat_hash_map>
+TEST_MACROS();
+#endif
+#if __cplusplus >= 201703L
+#   include <experimental/flat_hash_set>
+TEST_MACROS();
+#endif
 #if __cplusplus >= 201103L
 #   include <experimental/forward_list>
 TEST_MACROS();
@@ -369,6 +389,10 @@ TEST_MACROS();
 #   include <experimental/propagate_const>
 TEST_MACROS();
 #endif
+#if __cplusplus >= 201103L
+#   include <experimental/queue>
+TEST_MACROS();
+#endif
 #if !defined(_LIBCPP_HAS_NO_LOCALIZATION) && __cplusplus >= 201103L
 #   include <experimental/regex>
 TEST_MACROS();
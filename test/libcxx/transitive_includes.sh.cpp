@@ -304,379 +304,414 @@ END-SCRIPT
 #if defined(TEST_47)
 #include <filesystem>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_49 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.format
-// RUN: diff %S/transitive_includes/expected.format %t.actual.format
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_48 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.flat_map
+// RUN: diff %S/transitive_includes/expected.flat_map %t.actual.flat_map
+#if defined(TEST_48)
+#include <flat_map>
+#endif
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_49 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.flat_set
+// RUN: diff %S/transitive_includes/expected.flat_set %t.actual.flat_set
 #if defined(TEST_49)
+#include <flat_set>
+#endif
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_51 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.format
+// RUN: diff %S/transitive_includes/expected.format %t.actual.format
+#if defined(TEST_51)
 #include <format>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_50 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.forward_list
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_52 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.forward_list
 // RUN: diff %S/transitive_includes/expected.forward_list %t.actual.forward_list
-#if defined(TEST_50)
+#if defined(TEST_52)
 #include <forward_list>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_51 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.fstream
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_53 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.fstream
 // RUN: diff %S/transitive_includes/expected.fstream %t.actual.fstream
-#if defined(TEST_51)
+#if defined(TEST_53)
 #include <fstream>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_52 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.functional
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_54 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.functional
 // RUN: diff %S/transitive_includes/expected.functional %t.actual.functional
-#if defined(TEST_52)
+#if defined(TEST_54)
 #include <functional>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_53 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.future
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_55 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.future
 // RUN: diff %S/transitive_includes/expected.future %t.actual.future
-#if defined(TEST_53)
+#if defined(TEST_55)
 #include <future>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_54 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.initializer_list
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_56 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.initializer_list
 // RUN: diff %S/transitive_includes/expected.initializer_list %t.actual.initializer_list
-#if defined(TEST_54)
+#if defined(TEST_56)
 #include <initializer_list>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_56 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.iomanip
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_58 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.iomanip
 // RUN: diff %S/transitive_includes/expected.iomanip %t.actual.iomanip
-#if defined(TEST_56)
+#if defined(TEST_58)
 #include <iomanip>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_57 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ios
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_59 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ios
 // RUN: diff %S/transitive_includes/expected.ios %t.actual.ios
-#if defined(TEST_57)
+#if defined(TEST_59)
 #include <ios>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_58 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.iosfwd
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_60 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.iosfwd
 // RUN: diff %S/transitive_includes/expected.iosfwd %t.actual.iosfwd
-#if defined(TEST_58)
+#if defined(TEST_60)
 #include <iosfwd>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_59 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.iostream
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_61 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.iostream
 // RUN: diff %S/transitive_includes/expected.iostream %t.actual.iostream
-#if defined(TEST_59)
+#if defined(TEST_61)
 #include <iostream>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_60 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.istream
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_62 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.istream
 // RUN: diff %S/transitive_includes/expected.istream %t.actual.istream
-#if defined(TEST_60)
+#if defined(TEST_62)
 #include <istream>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_61 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.iterator
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_63 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.iterator
 // RUN: diff %S/transitive_includes/expected.iterator %t.actual.iterator
-#if defined(TEST_61)
+#if defined(TEST_63)
 #include <iterator>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_62 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.latch
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_64 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.latch
 // RUN: diff %S/transitive_includes/expected.latch %t.actual.latch
-#if defined(TEST_62)
+#if defined(TEST_64)
 #include <latch>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_63 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.limits
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_65 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.limits
 // RUN: diff %S/transitive_includes/expected.limits %t.actual.limits
-#if defined(TEST_63)
+#if defined(TEST_65)
 #include <limits>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_65 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.list
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_67 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.list
 // RUN: diff %S/transitive_includes/expected.list %t.actual.list
-#if defined(TEST_65)
+#if defined(TEST_67)
 #include <list>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_66 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.locale
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_68 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.locale
 // RUN: diff %S/transitive_includes/expected.locale %t.actual.locale
-#if defined(TEST_66)
+#if defined(TEST_68)
 #include <locale>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_68 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.map
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_70 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.map
 // RUN: diff %S/transitive_includes/expected.map %t.actual.map
-#if defined(TEST_68)
+#if defined(TEST_70)
 #include <map>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_70 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.memory
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_72 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.memory
 // RUN: diff %S/transitive_includes/expected.memory %t.actual.memory
-#if defined(TEST_70)
+#if defined(TEST_72)
 #include <memory>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_71 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.mutex
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_73 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.mutex
 // RUN: diff %S/transitive_includes/expected.mutex %t.actual.mutex
-#if defined(TEST_71)
+#if defined(TEST_73)
 #include <mutex>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_72 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.new
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_74 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.new
 // RUN: diff %S/transitive_includes/expected.new %t.actual.new
-#if defined(TEST_72)
+#if defined(TEST_74)
 #include <new>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_73 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.numbers
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_75 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.numbers
 // RUN: diff %S/transitive_includes/expected.numbers %t.actual.numbers
-#if defined(TEST_73)
+#if defined(TEST_75)
 #include <numbers>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_74 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.numeric
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_76 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.numeric
 // RUN: diff %S/transitive_includes/expected.numeric %t.actual.numeric
-#if defined(TEST_74)
+#if defined(TEST_76)
 #include <numeric>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_75 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.optional
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_77 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.optional
 // RUN: diff %S/transitive_includes/expected.optional %t.actual.optional
-#if defined(TEST_75)
+#if defined(TEST_77)
 #include <optional>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_76 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ostream
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_78 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ostream
 // RUN: diff %S/transitive_includes/expected.ostream %t.actual.ostream
-#if defined(TEST_76)
+#if defined(TEST_78)
 #include <ostream>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_77 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.queue
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_79 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.queue
 // RUN: diff %S/transitive_includes/expected.queue %t.actual.queue
-#if defined(TEST_77)
+#if defined(TEST_79)
 #include <queue>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_78 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.random
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_80 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.random
 // RUN: diff %S/transitive_includes/expected.random %t.actual.random
-#if defined(TEST_78)
+#if defined(TEST_80)
 #include <random>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_79 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ranges
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_81 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ranges
 // RUN: diff %S/transitive_includes/expected.ranges %t.actual.ranges
-#if defined(TEST_79)
+#if defined(TEST_81)
 #include <ranges>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_80 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ratio
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_82 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ratio
 // RUN: diff %S/transitive_includes/expected.ratio %t.actual.ratio
-#if defined(TEST_80)
+#if defined(TEST_82)
 #include <ratio>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_81 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.regex
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_83 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.regex
 // RUN: diff %S/transitive_includes/expected.regex %t.actual.regex
-#if defined(TEST_81)
+#if defined(TEST_83)
 #include <regex>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_82 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.scoped_allocator
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_84 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.scoped_allocator
 // RUN: diff %S/transitive_includes/expected.scoped_allocator %t.actual.scoped_allocator
-#if defined(TEST_82)
+#if defined(TEST_84)
 #include <scoped_allocator>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_83 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.semaphore
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_85 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.semaphore
 // RUN: diff %S/transitive_includes/expected.semaphore %t.actual.semaphore
-#if defined(TEST_83)
+#if defined(TEST_85)
 #include <semaphore>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_84 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.set
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_86 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.set
 // RUN: diff %S/transitive_includes/expected.set %t.actual.set
-#if defined(TEST_84)
+#if defined(TEST_86)
 #include <set>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_86 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.shared_mutex
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_88 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.shared_mutex
 // RUN: diff %S/transitive_includes/expected.shared_mutex %t.actual.shared_mutex
-#if defined(TEST_86)
+#if defined(TEST_88)
 #include <shared_mutex>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_87 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.span
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_89 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.span
 // RUN: diff %S/transitive_includes/expected.span %t.actual.span
-#if defined(TEST_87)
+#if defined(TEST_89)
 #include <span>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_88 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.sstream
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_90 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.sstream
 // RUN: diff %S/transitive_includes/expected.sstream %t.actual.sstream
-#if defined(TEST_88)
+#if defined(TEST_90)
 #include <sstream>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_89 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.stack
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_91 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.stack
 // RUN: diff %S/transitive_includes/expected.stack %t.actual.stack
-#if defined(TEST_89)
+#if defined(TEST_91)
 #include <stack>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_93 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.stdexcept
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_95 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.stdexcept
 // RUN: diff %S/transitive_includes/expected.stdexcept %t.actual.stdexcept
-#if defined(TEST_93)
+#if defined(TEST_95)
 #include <stdexcept>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_97 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.streambuf
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_99 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.streambuf
 // RUN: diff %S/transitive_includes/expected.streambuf %t.actual.streambuf
-#if defined(TEST_97)
+#if defined(TEST_99)
 #include <streambuf>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_98 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.string
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_100 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.string
 // RUN: diff %S/transitive_includes/expected.string %t.actual.string
-#if defined(TEST_98)
+#if defined(TEST_100)
 #include <string>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_100 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.string_view
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_102 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.string_view
 // RUN: diff %S/transitive_includes/expected.string_view %t.actual.string_view
-#if defined(TEST_100)
+#if defined(TEST_102)
 #include <string_view>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_101 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.strstream
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_103 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.strstream
 // RUN: diff %S/transitive_includes/expected.strstream %t.actual.strstream
-#if defined(TEST_101)
+#if defined(TEST_103)
 #include <strstream>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_102 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.system_error
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_104 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.system_error
 // RUN: diff %S/transitive_includes/expected.system_error %t.actual.system_error
-#if defined(TEST_102)
+#if defined(TEST_104)
 #include <system_error>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_104 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.thread
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_106 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.thread
 // RUN: diff %S/transitive_includes/expected.thread %t.actual.thread
-#if defined(TEST_104)
+#if defined(TEST_106)
 #include <thread>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_105 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.tuple
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_107 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.tuple
 // RUN: diff %S/transitive_includes/expected.tuple %t.actual.tuple
-#if defined(TEST_105)
+#if defined(TEST_107)
 #include <tuple>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_106 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.type_traits
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_108 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.type_traits
 // RUN: diff %S/transitive_includes/expected.type_traits %t.actual.type_traits
-#if defined(TEST_106)
+#if defined(TEST_108)
 #include <type_traits>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_107 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.typeindex
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_109 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.typeindex
 // RUN: diff %S/transitive_includes/expected.typeindex %t.actual.typeindex
-#if defined(TEST_107)
+#if defined(TEST_109)
 #include <typeindex>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_108 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.typeinfo
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_110 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.typeinfo
 // RUN: diff %S/transitive_includes/expected.typeinfo %t.actual.typeinfo
-#if defined(TEST_108)
+#if defined(TEST_110)
 #include <typeinfo>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_110 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.unordered_map
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_112 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.unordered_map
 // RUN: diff %S/transitive_includes/expected.unordered_map %t.actual.unordered_map
-#if defined(TEST_110)
+#if defined(TEST_112)
 #include <unordered_map>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_111 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.unordered_set
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_113 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.unordered_set
 // RUN: diff %S/transitive_includes/expected.unordered_set %t.actual.unordered_set
-#if defined(TEST_111)
+#if defined(TEST_113)
 #include <unordered_set>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_112 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.utility
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_114 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.utility
 // RUN: diff %S/transitive_includes/expected.utility %t.actual.utility
-#if defined(TEST_112)
+#if defined(TEST_114)
 #include <utility>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_113 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.valarray
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_115 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.valarray
 // RUN: diff %S/transitive_includes/expected.valarray %t.actual.valarray
-#if defined(TEST_113)
+#if defined(TEST_115)
 #include <valarray>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_114 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.variant
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_116 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.variant
 // RUN: diff %S/transitive_includes/expected.variant %t.actual.variant
-#if defined(TEST_114)
+#if defined(TEST_116)
 #include <variant>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_115 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.vector
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_117 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.vector
 // RUN: diff %S/transitive_includes/expected.vector %t.actual.vector
-#if defined(TEST_115)
+#if defined(TEST_117)
 #include <vector>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_116 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.version
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_118 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.version
 // RUN: diff %S/transitive_includes/expected.version %t.actual.version
-#if defined(TEST_116)
+#if defined(TEST_118)
 #include <version>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_119 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_algorithm
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_121 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_algorithm
 // RUN: diff %S/transitive_includes/expected.experimental_algorithm %t.actual.experimental_algorithm
-#if defined(TEST_119)
+#if defined(TEST_121)
 #include <experimental/algorithm>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_120 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_coroutine
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_122 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_btree_map
+// RUN: diff %S/transitive_includes/expected.experimental_btree_map %t.actual.experimental_btree_map
+#if defined(TEST_122)
+#include <experimental/btree_map>
+#endif
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_123 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_btree_set
+// RUN: diff %S/transitive_includes/expected.experimental_btree_set %t.actual.experimental_btree_set
+#if defined(TEST_123)
+#include <experimental/btree_set>
+#endif
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_124 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_coroutine
 // RUN: diff %S/transitive_includes/expected.experimental_coroutine %t.actual.experimental_coroutine
-#if defined(TEST_120)
+#if defined(TEST_124)
 #include <experimental/coroutine>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_121 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_deque
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_125 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_deque
 // RUN: diff %S/transitive_includes/expected.experimental_deque %t.actual.experimental_deque
-#if defined(TEST_121)
+#if defined(TEST_125)
 #include <experimental/deque>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_122 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_forward_list
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_126 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_flat_hash_map
+// RUN: diff %S/transitive_includes/expected.experimental_flat_hash_map %t.actual.experimental_flat_hash_map
+#if defined(TEST_126)
+#include <experimental/flat_hash_map>
+#endif
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_127 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_flat_hash_set
+// RUN: diff %S/transitive_includes/expected.experimental_flat_hash_set %t.actual.experimental_flat_hash_set
+#if defined(TEST_127)
+#include <experimental/flat_hash_set>
+#endif
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_128 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_forward_list
 // RUN: diff %S/transitive_includes/expected.experimental_forward_list %t.actual.experimental_forward_list
-#if defined(TEST_122)
+#if defined(TEST_128)
 #include <experimental/forward_list>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_123 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_functional
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_129 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_functional
 // RUN: diff %S/transitive_includes/expected.experimental_functional %t.actual.experimental_functional
-#if defined(TEST_123)
+#if defined(TEST_129)
 #include <experimental/functional>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_124 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_iterator
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_130 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_iterator
 // RUN: diff %S/transitive_includes/expected.experimental_iterator %t.actual.experimental_iterator
-#if defined(TEST_124)
+#if defined(TEST_130)
 #include <experimental/iterator>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_125 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_list
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_131 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_list
 // RUN: diff %S/transitive_includes/expected.experimental_list %t.actual.experimental_list
-#if defined(TEST_125)
+#if defined(TEST_131)
 #include <experimental/list>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_126 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_map
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_132 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_map
 // RUN: diff %S/transitive_includes/expected.experimental_map %t.actual.experimental_map
-#if defined(TEST_126)
+#if defined(TEST_132)
 #include <experimental/map>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_127 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_memory_resource
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_133 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_memory_resource
 // RUN: diff %S/transitive_includes/expected.experimental_memory_resource %t.actual.experimental_memory_resource
-#if defined(TEST_127)
+#if defined(TEST_133)
 #include <experimental/memory_resource>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_128 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_propagate_const
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_134 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_propagate_const
 // RUN: diff %S/transitive_includes/expected.experimental_propagate_const %t.actual.experimental_propagate_const
-#if defined(TEST_128)
+#if defined(TEST_134)
 #include <experimental/propagate_const>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_129 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_regex
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_135 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_queue
+// RUN: diff %S/transitive_includes/expected.experimental_queue %t.actual.experimental_queue
+#if defined(TEST_135)
+#include <experimental/queue>
+#endif
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_136 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_regex
 // RUN: diff %S/transitive_includes/expected.experimental_regex %t.actual.experimental_regex
-#if defined(TEST_129)
+#if defined(TEST_136)
 #include <experimental/regex>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_130 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_set
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_137 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_set
 // RUN: diff %S/transitive_includes/expected.experimental_set %t.actual.experimental_set
-#if defined(TEST_130)
+#if defined(TEST_137)
 #include <experimental/set>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_131 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_simd
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_138 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_simd
 // RUN: diff %S/transitive_includes/expected.experimental_simd %t.actual.experimental_simd
-#if defined(TEST_131)
+#if defined(TEST_138)
 #include <experimental/simd>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_132 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_string
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_139 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_string
 // RUN: diff %S/transitive_includes/expected.experimental_string %t.actual.experimental_string
-#if defined(TEST_132)
+#if defined(TEST_139)
 #include <experimental/string>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_133 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_type_traits
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_140 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_type_traits
 // RUN: diff %S/transitive_includes/expected.experimental_type_traits %t.actual.experimental_type_traits
-#if defined(TEST_133)
+#if defined(TEST_140)
 #include <experimental/type_traits>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_134 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_unordered_map
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_141 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_unordered_map
 // RUN: diff %S/transitive_includes/expected.experimental_unordered_map %t.actual.experimental_unordered_map
-#if defined(TEST_134)
+#if defined(TEST_141)
 #include <experimental/unordered_map>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_135 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_unordered_set
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_142 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_unordered_set
 // RUN: diff %S/transitive_includes/expected.experimental_unordered_set %t.actual.experimental_unordered_set
-#if defined(TEST_135)
+#if defined(TEST_142)
 #include <experimental/unordered_set>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_136 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_utility
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_143 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_utility
 // RUN: diff %S/transitive_includes/expected.experimental_utility %t.actual.experimental_utility
-#if defined(TEST_136)
+#if defined(TEST_143)
 #include <experimental/utility>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_137 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_vector
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_144 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.experimental_vector
 // RUN: diff %S/transitive_includes/expected.experimental_vector %t.actual.experimental_vector
-#if defined(TEST_137)
+#if defined(TEST_144)
 #include <experimental/vector>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_138 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ext_hash_map
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_145 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ext_hash_map
 // RUN: diff %S/transitive_includes/expected.ext_hash_map %t.actual.ext_hash_map
-#if defined(TEST_138)
+#if defined(TEST_145)
 #include <ext/hash_map>
 #endif
-// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_139 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ext_hash_set
+// RUN: %{cxx} %s %{flags} %{compile_flags} --trace-includes -fsyntax-only -DTEST_146 2>&1 | %{python} %S/transitive_includes.sanitize.py > %t.actual.ext_hash_set
 // RUN: diff %S/transitive_includes/expected.ext_hash_set %t.actual.ext_hash_set
-#if defined(TEST_139)
+#if defined(TEST_146)
 #include <ext/hash_set>
 #endif
 // GENERATED-MARKER
@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03
+
+// __libcpp_is_trivially_relocatable
+
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "min_allocator.h"
+#include "test_allocator.h"
+
+struct Trivial {
+  int i;
+};
+
+struct NonTrivial {
+  NonTrivial(NonTrivial&&);
+};
+
+struct OptIn {
+  OptIn(OptIn&&);
+  ~OptIn();
+};
+
+namespace std {
+template <>
+struct __libcpp_is_trivially_relocatable<OptIn> : true_type {};
+} // namespace std
+
+static_assert(std::__libcpp_is_trivially_relocatable<int>::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<int*>::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<Trivial>::value, "");
+static_assert(!std::__libcpp_is_trivially_relocatable<NonTrivial>::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<OptIn>::value, "");
+static_assert(!std::__libcpp_is_trivially_relocatable<int&>::value, "");
+
+static_assert(std::__libcpp_is_trivially_relocatable<std::unique_ptr<int> >::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::unique_ptr<int[]> >::value, "");
+static_assert(!std::__libcpp_is_trivially_relocatable<std::unique_ptr<int, std::default_delete<int>&> >::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::shared_ptr<int> >::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::weak_ptr<int> >::value, "");
+
+static_assert(std::__libcpp_is_trivially_relocatable<std::pair<int, OptIn> >::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::pair<const std::unique_ptr<int>, int> >::value, "");
+static_assert(!std::__libcpp_is_trivially_relocatable<std::pair<int, NonTrivial> >::value, "");
+static_assert(!std::__libcpp_is_trivially_relocatable<std::pair<int&, int> >::value, "");
+
+#ifndef _LIBCPP_ENABLE_DEBUG_MODE
+static_assert(std::__libcpp_is_trivially_relocatable<std::string>::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::vector<int> >::value, "");
+static_assert(std::__libcpp_is_trivially_relocatable<std::vector<int, min_allocator<int> > >::value, "");
+#endif
+static_assert(std::__libcpp_is_trivially_relocatable<std::deque<int> >::value, "");
+
+// Moving containers that use these allocators doesn't always steal the storage.
+static_assert(!std::__libcpp_is_trivially_relocatable<std::vector<int, test_allocator<int> > >::value, "");
+static_assert(!std::__libcpp_is_trivially_relocatable<std::deque<int, test_allocator<int> > >::value, "");
+
+// These point into themselves.
+static_assert(!std::__libcpp_is_trivially_relocatable<std::list<int> >::value, "");
+static_assert(!std::__libcpp_is_trivially_relocatable<std::function<void()> >::value, "");
@@ -41,6 +41,37 @@ test_copy_if()
         assert(ib[i] % 3 == 0);
 }
 
+template <class T>
+struct is_odd
+{
+    bool operator()(T x) const {return static_cast<long long>(x) % 2 != 0;}
+};
+
+// Contiguous ranges of trivially copyable types are compacted a block at a time, so they are compared with the
+// results of the generic algorithm.
+template <class T>
+void
+test_contiguous()
+{
+    const unsigned N = 300;
+    for (unsigned values = 1; values < 30; values += 7)
+    {
+        T ia[N];
+        T ib[N];
+        for (unsigned i = 0; i < N; ++i)
+            ia[i] = ib[i] = T((i * 2654435761u >> 13) % values);
+        const T* ca = ia;
+        T ic[N];
+        T id[N];
+        T* r = std::copy_if(ca, ca+N, ic, is_odd<T>());
+        cpp17_output_iterator<T*> s = std::copy_if(forward_iterator<const T*>(ib), forward_iterator<const T*>(ib+N),
+                                                   cpp17_output_iterator<T*>(id), is_odd<T>());
+        assert(r - ic == base(s) - id);
+        for (unsigned i = 0; i < unsigned(r - ic); ++i)
+            assert(ic[i] == id[i] && is_odd<T>()(ic[i]));
+    }
+}
+
 TEST_CONSTEXPR_CXX20 bool
 test()
 {
@@ -85,6 +116,11 @@ test()
 int main(int, char**)
 {
     test();
+    test_contiguous<char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<double>();
 
 #if TEST_STD_VER > 17
     static_assert(test());
@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: libcpp-has-no-incomplete-pstl
+
+// <algorithm>
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class Predicate>
+//   ForwardIterator2 copy_if(ExecutionPolicy&& exec,
+//                            ForwardIterator1 first, ForwardIterator1 last,
+//                            ForwardIterator2 result, Predicate pred);
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class Iter1, class Iter2>
+struct Test {
+  template <class ExecutionPolicy>
+  void operator()(ExecutionPolicy&& policy) {
+    for (std::size_t size : pstl_test_sizes) {
+      std::vector<int> in(size);
+      for (std::size_t i = 0; i != size; ++i)
+        in[i] = static_cast<int>(i);
+
+      { // keep every third element
+        std::vector<int> out(size, -1);
+        decltype(auto) ret = std::copy_if(
+            policy, Iter1(in.data()), Iter1(in.data() + in.size()), Iter2(out.data()), [](int i) { return i % 3 == 0; });
+        static_assert(std::is_same_v<decltype(ret), Iter2>);
+        std::size_t expected = (size + 2) / 3;
+        assert(base(ret) == out.data() + expected);
+        for (std::size_t i = 0; i != expected; ++i)
+          assert(out[i] == static_cast<int>(3 * i));
+        for (std::size_t i = expected; i != size; ++i)
+          assert(out[i] == -1);
+      }
+      { // keep nothing
+        std::vector<int> out(size, -1);
+        decltype(auto) ret = std::copy_if(
+            policy, Iter1(in.data()), Iter1(in.data() + in.size()), Iter2(out.data()), [](int) { return false; });
+        assert(base(ret) == out.data());
+      }
+      { // keep everything
+        std::vector<int> out(size, -1);
+        decltype(auto) ret = std::copy_if(
+            policy, Iter1(in.data()), Iter1(in.data() + in.size()), Iter2(out.data()), [](int) { return true; });
+        assert(base(ret) == out.data() + size);
+        assert(out == in);
+      }
+    }
+  }
+};
+
+int main(int, char**) {
+  test_execution_policies(Test<forward_iterator<int*>, forward_iterator<int*>>{});
+  test_execution_policies(Test<random_access_iterator<int*>, random_access_iterator<int*>>{});
+  test_execution_policies(Test<int*, int*>{});
+
+  return 0;
+}
@@ -49,6 +49,27 @@ test()
     assert(ia[5] == 4);
 }
 
+// Contiguous ranges of trivially copyable types are compacted without branches, and a vector at a time
+// when possible, so they are compared with the results of the generic algorithm.
+template <class T>
+void
+test_contiguous()
+{
+    const unsigned N = 300;
+    for (unsigned values = 1; values < 30; values += 7)
+    {
+        T ia[N];
+        T ib[N];
+        for (unsigned i = 0; i < N; ++i)
+            ia[i] = ib[i] = T((i * 2654435761u >> 13) % values);
+        T* r = std::remove(ia, ia+N, T(1));
+        forward_iterator<T*> s = std::remove(forward_iterator<T*>(ib), forward_iterator<T*>(ib+N), T(1));
+        assert(r - ia == base(s) - ib);
+        for (unsigned i = 0; i < unsigned(r - ia); ++i)
+            assert(ia[i] == ib[i] && !(ia[i] == T(1)));
+    }
+}
+
 #if TEST_STD_VER >= 11
 template <class Iter>
 void
@@ -80,6 +101,12 @@ int main(int, char**)
     test<random_access_iterator<int*> >();
     test<int*>();
 
+    test_contiguous<char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<double>();
+
 #if TEST_STD_VER >= 11
     test1<forward_iterator<std::unique_ptr<int>*> >();
     test1<bidirectional_iterator<std::unique_ptr<int>*> >();
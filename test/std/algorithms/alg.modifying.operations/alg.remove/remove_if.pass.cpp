@@ -56,6 +56,33 @@ test()
     assert(cp.count() == sa);
 }
 
+template <class T>
+struct is_odd
+{
+    bool operator()(T x) const {return static_cast<long long>(x) % 2 != 0;}
+};
+
+// Contiguous ranges of trivially copyable types are compacted without branches, so they are compared with
+// the results of the generic algorithm.
+template <class T>
+void
+test_contiguous()
+{
+    const unsigned N = 300;
+    for (unsigned values = 1; values < 30; values += 7)
+    {
+        T ia[N];
+        T ib[N];
+        for (unsigned i = 0; i < N; ++i)
+            ia[i] = ib[i] = T((i * 2654435761u >> 13) % values);
+        T* r = std::remove_if(ia, ia+N, is_odd<T>());
+        forward_iterator<T*> s = std::remove_if(forward_iterator<T*>(ib), forward_iterator<T*>(ib+N), is_odd<T>());
+        assert(r - ia == base(s) - ib);
+        for (unsigned i = 0; i < unsigned(r - ia); ++i)
+            assert(ia[i] == ib[i] && !is_odd<T>()(ia[i]));
+    }
+}
+
 #if TEST_STD_VER >= 11
 struct pred
 {
@@ -86,6 +113,34 @@ test1()
     assert(*ia[4] == 3);
     assert(*ia[5] == 4);
 }
+
+// Trivially copyable, but only move-assignable.
+struct MoveOnly
+{
+    int value;
+    MoveOnly() = default;
+    explicit MoveOnly(int v) : value(v) {}
+    MoveOnly(MoveOnly&&) = default;
+    MoveOnly& operator=(MoveOnly&&) = default;
+};
+
+struct is_odd_move_only
+{
+    bool operator()(const MoveOnly& x) const {return x.value % 2 != 0;}
+};
+
+void
+test_move_only()
+{
+    const int N = 300;
+    MoveOnly ia[N];
+    for (int i = 0; i < N; ++i)
+        ia[i] = MoveOnly(i);
+    MoveOnly* r = std::remove_if(ia, ia+N, is_odd_move_only());
+    assert(r == ia + N/2);
+    for (int i = 0; i < N/2; ++i)
+        assert(ia[i].value == 2 * i);
+}
 #endif // TEST_STD_VER >= 11
 
 int main(int, char**)
@@ -95,11 +150,18 @@ int main(int, char**)
     test<random_access_iterator<int*> >();
     test<int*>();
 
+    test_contiguous<char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<double>();
+
 #if TEST_STD_VER >= 11
     test1<forward_iterator<std::unique_ptr<int>*> >();
     test1<bidirectional_iterator<std::unique_ptr<int>*> >();
     test1<random_access_iterator<std::unique_ptr<int>*> >();
     test1<std::unique_ptr<int>*>();
+    test_move_only();
 #endif // TEST_STD_VER >= 11
 
 #if TEST_STD_VER > 17
@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: libcpp-has-no-incomplete-pstl
+
+// <algorithm>
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2,
+//          class ForwardIterator, class BinaryOperation>
+//   ForwardIterator
+//     transform(ExecutionPolicy&& exec,
+//               ForwardIterator1 first1, ForwardIterator1 last1,
+//               ForwardIterator2 first2, ForwardIterator result,
+//               BinaryOperation binary_op);
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class Iter1, class Iter2, class Iter3>
+struct Test {
+  template <class ExecutionPolicy>
+  void operator()(ExecutionPolicy&& policy) {
+    for (std::size_t size : pstl_test_sizes) {
+      std::vector<int> in1(size);
+      std::vector<int> in2(size);
+      std::vector<long> out(size, -1);
+      for (std::size_t i = 0; i != size; ++i) {
+        in1[i] = static_cast<int>(i);
+        in2[i] = 3 * static_cast<int>(i);
+      }
+
+      decltype(auto) ret = std::transform(
+          policy,
+          Iter1(in1.data()),
+          Iter1(in1.data() + in1.size()),
+          Iter2(in2.data()),
+          Iter3(out.data()),
+          [](int a, int b) { return static_cast<long>(b - a); });
+      static_assert(std::is_same_v<decltype(ret), Iter3>);
+      assert(base(ret) == out.data() + out.size());
+      for (std::size_t i = 0; i != size; ++i)
+        assert(out[i] == 2 * static_cast<long>(i));
+    }
+  }
+};
+
+int main(int, char**) {
+  test_execution_policies(Test<forward_iterator<int*>, forward_iterator<int*>, forward_iterator<long*>>{});
+  test_execution_policies(Test<random_access_iterator<int*>, forward_iterator<int*>, random_access_iterator<long*>>{});
+  test_execution_policies(
+      Test<random_access_iterator<int*>, random_access_iterator<int*>, random_access_iterator<long*>>{});
+  test_execution_policies(Test<int*, int*, long*>{});
+
+  return 0;
+}
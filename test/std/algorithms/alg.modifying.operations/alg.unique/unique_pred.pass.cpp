@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <functional>
 #include <memory>
 
 #include "test_macros.h"
@@ -121,6 +122,27 @@ test()
     assert(count_equal::count == si-1);
 }
 
+// Contiguous ranges of integers and pointers are compacted without branches, and a vector at a time when
+// possible, so they are compared with the results of the generic algorithm.
+template <class T>
+void
+test_contiguous()
+{
+    const unsigned N = 300;
+    for (unsigned values = 1; values < 30; values += 7)
+    {
+        T ia[N];
+        T ib[N];
+        for (unsigned i = 0; i < N; ++i)
+            ia[i] = ib[i] = T((i * 2654435761u >> 13) % values);
+        T* r = std::unique(ia, ia+N, std::equal_to<T>());
+        forward_iterator<T*> s = std::unique(forward_iterator<T*>(ib), forward_iterator<T*>(ib+N), count_equal());
+        assert(r - ia == base(s) - ib);
+        for (unsigned i = 0; i < unsigned(r - ia); ++i)
+            assert(ia[i] == ib[i] && (i == 0 || !(ia[i-1] == ia[i])));
+    }
+}
+
 #if TEST_STD_VER >= 11
 
 struct do_nothing
@@ -230,6 +252,12 @@ int main(int, char**)
     test<random_access_iterator<int*> >();
     test<int*>();
 
+    test_contiguous<char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<double>();
+
 #if TEST_STD_VER >= 11
     test1<forward_iterator<Ptr*> >();
     test1<bidirectional_iterator<Ptr*> >();
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 #include "test_macros.h"
 #include "test_iterators.h"
@@ -29,8 +30,49 @@ TEST_CONSTEXPR bool test_constexpr() {
     }
 #endif
 
+
+// Contiguous ranges of integers may be counted a vector at a time, so test lengths around the vector
+// sizes, and counts larger than what a byte can hold.
+template <class T>
+void test_contiguous()
+{
+    for (int n = 0; n < 150; ++n)
+    {
+        std::vector<T> v(n);
+        for (int i = 0; i < n; ++i)
+            v[i] = static_cast<T>(i % 3);
+        assert(std::count(v.begin(), v.end(), static_cast<T>(0)) == (n + 2) / 3);
+        assert(std::count(v.begin(), v.end(), static_cast<T>(2)) == n / 3);
+        assert(std::count(v.begin(), v.end(), static_cast<T>(3)) == 0);
+    }
+    std::vector<T> v(100000, static_cast<T>(1));
+    v[99999] = 0;
+    assert(std::count(v.begin(), v.end(), static_cast<T>(1)) == 99999);
+}
+
+// The value is compared to the elements after the usual arithmetic conversions.
+void test_conversions()
+{
+    signed char sc[] = {-1, -1, 1};
+    assert(std::count(sc, sc + 3, -1) == 2);
+    assert(std::count(sc, sc + 3, 255) == 0);
+    unsigned short us[] = {65535, 1, 65535};
+    assert(std::count(us, us + 3, -1) == 0);
+    assert(std::count(us, us + 3, 65535L) == 2);
+}
+
 int main(int, char**)
 {
+    test_contiguous<signed char>();
+    test_contiguous<unsigned char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned short>();
+    test_contiguous<int>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<unsigned long long>();
+    test_conversions();
+
     int ia[] = {0, 1, 2, 2, 0, 1, 2, 3};
     const unsigned sa = sizeof(ia)/sizeof(ia[0]);
     assert(std::count(cpp17_input_iterator<const int*>(ia),
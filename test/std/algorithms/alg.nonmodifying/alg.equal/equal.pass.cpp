@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 #include "test_macros.h"
 #include "test_iterators.h"
@@ -44,8 +45,44 @@ TEST_CONSTEXPR bool test_constexpr() {
 #endif
 
 
+
+// Contiguous ranges of integers may be compared a whole block at a time, so test lengths around the
+// vector sizes, with a difference at every position.
+template <class T>
+void test_contiguous()
+{
+    for (int n = 0; n < 150; ++n)
+    {
+        std::vector<T> a(n);
+        for (int i = 0; i < n; ++i)
+            a[i] = static_cast<T>(i);
+        std::vector<T> b = a;
+        assert(std::equal(a.begin(), a.end(), b.begin()));
+        for (int i = 0; i < n; ++i)
+        {
+            b[i] = static_cast<T>(b[i] + 1);
+            assert(!std::equal(a.begin(), a.end(), b.begin()));
+            assert(std::equal(a.begin(), a.begin() + i, b.begin()));
+#if TEST_STD_VER >= 14
+            assert(!std::equal(a.begin(), a.end(), b.begin(), b.end()));
+            assert(std::equal(a.begin(), a.begin() + i, b.begin(), b.begin() + i));
+#endif
+            b[i] = a[i];
+        }
+    }
+}
+
 int main(int, char**)
 {
+    test_contiguous<signed char>();
+    test_contiguous<unsigned char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned short>();
+    test_contiguous<int>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<unsigned long long>();
+
     int ia[] = {0, 1, 2, 3, 4, 5};
     const unsigned s = sizeof(ia)/sizeof(ia[0]);
     int ib[s] = {0, 1, 2, 5, 4, 5};
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 #include "test_macros.h"
 #include "test_iterators.h"
@@ -29,8 +30,62 @@ TEST_CONSTEXPR bool test_constexpr() {
     }
 #endif
 
+
+// Contiguous ranges of integers and pointers may be searched a vector at a time, so test lengths
+// around the vector sizes.
+template <class T>
+void test_contiguous()
+{
+    for (int n = 0; n < 150; ++n)
+    {
+        std::vector<T> v(n);
+        for (int i = 0; i < n; ++i)
+            v[i] = static_cast<T>(i);
+        for (int i = 0; i < n; ++i)
+            assert(std::find(v.begin(), v.end(), static_cast<T>(i)) == v.begin() + i);
+        assert(std::find(v.begin(), v.end(), static_cast<T>(n)) == v.end());
+    }
+}
+
+void test_pointers()
+{
+    int a[100];
+    int* p[100];
+    for (int i = 0; i < 100; ++i)
+        p[i] = a + i;
+    for (int i = 0; i < 100; ++i)
+        assert(std::find(p, p + 100, a + i) == p + i);
+    assert(std::find(p, p + 100, static_cast<int*>(0)) == p + 100);
+}
+
+// The value is compared to the elements after the usual arithmetic conversions.
+void test_conversions()
+{
+    unsigned char uc[] = {0, 1, 2, 255};
+    assert(std::find(uc, uc + 4, -1) == uc + 4);
+    assert(std::find(uc, uc + 4, 255) == uc + 3);
+    assert(std::find(uc, uc + 4, 256) == uc + 4);
+    assert(std::find(uc, uc + 4, 2LL) == uc + 2);
+    long long ll[] = {0, 1, -1};
+    assert(std::find(ll, ll + 3, -1) == ll + 2);
+    assert(std::find(ll, ll + 3, 1u) == ll + 1);
+    unsigned long long ull[] = {0, 1, static_cast<unsigned long long>(-1)};
+    assert(std::find(ull, ull + 3, -1) == ull + 2);
+}
+
 int main(int, char**)
 {
+    test_contiguous<signed char>();
+    test_contiguous<unsigned char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned short>();
+    test_contiguous<int>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<unsigned long long>();
+    test_pointers();
+    test_conversions();
+
     int ia[] = {0, 1, 2, 3, 4, 5};
     const unsigned s = sizeof(ia)/sizeof(ia[0]);
     cpp17_input_iterator<const int*> r = std::find(cpp17_input_iterator<const int*>(ia),
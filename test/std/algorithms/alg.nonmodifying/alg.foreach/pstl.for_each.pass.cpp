@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: libcpp-has-no-incomplete-pstl
+
+// <algorithm>
+
+// template<class ExecutionPolicy, class ForwardIterator, class Function>
+//   void for_each(ExecutionPolicy&& exec,
+//                 ForwardIterator first, ForwardIterator last,
+//                 Function f);
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class Iter>
+struct Test {
+  template <class ExecutionPolicy>
+  void operator()(ExecutionPolicy&& policy) {
+    for (std::size_t size : pstl_test_sizes) {
+      std::vector<int> a(size);
+      std::vector<std::atomic<int>> visits(size);
+      for (std::size_t i = 0; i != size; ++i)
+        a[i] = static_cast<int>(i);
+
+      auto visit = [&](int& v) { ++visits[v]; };
+      static_assert(std::is_same_v<void, decltype(std::for_each(policy, Iter(a.data()), Iter(a.data()), visit))>);
+      std::for_each(policy, Iter(a.data()), Iter(a.data() + a.size()), visit);
+      for (auto& v : visits)
+        assert(v == 1);
+    }
+  }
+};
+
+int main(int, char**) {
+  test_execution_policies(Test<forward_iterator<int*>>{});
+  test_execution_policies(Test<random_access_iterator<int*>>{});
+  test_execution_policies(Test<int*>{});
+
+  return 0;
+}
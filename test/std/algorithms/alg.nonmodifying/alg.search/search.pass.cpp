@@ -108,6 +108,40 @@ test()
     assert(std::search(Iter1(ij), Iter1(ij+sj), Iter2(ik), Iter2(ik+sk)) == Iter1(ij+6));
 }
 
+// Contiguous ranges of integers are searched like strings, so they are compared with the results of the
+// generic algorithm, on a range made of a long run of zeroes followed by a periodic part.
+template <class T>
+void
+test_contiguous()
+{
+    const unsigned N = 700;
+    T ia[N];
+    for (unsigned i = 0; i < N; ++i)
+        ia[i] = T(i < N/2 ? 0 : i % 3 == 2);
+    const unsigned lengths[] = {1, 2, 3, 8, 30, 100, 300};
+    for (unsigned l = 0; l < sizeof(lengths)/sizeof(lengths[0]); ++l)
+    {
+        const unsigned m = lengths[l];
+        for (unsigned start = 0; start + m <= N; start += 31)
+        {
+            T ib[300];
+            for (unsigned i = 0; i < m; ++i)
+                ib[i] = ia[start + i];
+            for (unsigned change = 0; change != 2; ++change)
+            {
+                if (change)
+                    ib[m / 2] = T(!ib[m / 2]);
+                const T* r = std::search(ia, ia+N, ib, ib+m);
+                forward_iterator<const T*> s = std::search(
+                    forward_iterator<const T*>(ia), forward_iterator<const T*>(ia+N),
+                    forward_iterator<const T*>(ib), forward_iterator<const T*>(ib+m));
+                assert(r == base(s));
+                assert(change || r <= ia + start);
+            }
+        }
+    }
+}
+
 template <class Iter>
 void
 adl_test()
@@ -128,6 +162,12 @@ int main(int, char**)
     test<random_access_iterator<const int*>, bidirectional_iterator<const int*> >();
     test<random_access_iterator<const int*>, random_access_iterator<const int*> >();
 
+    test_contiguous<char>();
+    test_contiguous<unsigned char>();
+    test_contiguous<short>();
+    test_contiguous<int>();
+    test_contiguous<long long>();
+
     adl_test<forward_iterator<User::S*> >();
     adl_test<random_access_iterator<User::S*> >();
 
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 #include "test_macros.h"
 #include "test_iterators.h"
@@ -58,8 +59,44 @@ TEST_CONSTEXPR bool test_constexpr() {
     }
 #endif
 
+
+// Contiguous ranges of integers may be compared a vector at a time, so test lengths around the
+// vector sizes, with a difference at every position.
+template <class T>
+void test_contiguous()
+{
+    for (int n = 0; n < 150; ++n)
+    {
+        std::vector<T> a(n);
+        for (int i = 0; i < n; ++i)
+            a[i] = static_cast<T>(i);
+        std::vector<T> b = a;
+        assert(std::mismatch(a.begin(), a.end(), b.begin()).first == a.end());
+        for (int i = 0; i < n; ++i)
+        {
+            b[i] = static_cast<T>(b[i] + 1);
+            assert(std::mismatch(a.begin(), a.end(), b.begin()).first == a.begin() + i);
+            assert(std::mismatch(a.begin(), a.end(), b.begin()).second == b.begin() + i);
+#if TEST_STD_VER > 11
+            assert(std::mismatch(a.begin(), a.end(), b.begin(), b.end()).first == a.begin() + i);
+            assert(std::mismatch(a.begin(), a.end(), b.begin(), b.begin() + i).first == a.begin() + i);
+#endif
+            b[i] = a[i];
+        }
+    }
+}
+
 int main(int, char**)
 {
+    test_contiguous<signed char>();
+    test_contiguous<unsigned char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned short>();
+    test_contiguous<int>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<unsigned long long>();
+
     int ia[] = {0, 1, 2, 2, 0, 1, 2, 3};
     const unsigned sa = sizeof(ia)/sizeof(ia[0]);
     int ib[] = {0, 1, 2, 3, 0, 1, 2, 3};
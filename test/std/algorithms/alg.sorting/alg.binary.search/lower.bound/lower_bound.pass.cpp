@@ -65,6 +65,28 @@ test()
         test(Iter(v.data()), Iter(v.data()+v.size()), x);
 }
 
+// Contiguous ranges of arithmetic values are searched without branching on the comparisons, for
+// values which may be of another arithmetic type.
+void
+test_arithmetic()
+{
+    for (int N = 0; N < 100; ++N)
+    {
+        std::vector<double> v(N);
+        for (int i = 0; i < N; ++i)
+            v[i] = i / 3;
+        for (int x = -1; x <= N / 3 + 1; ++x)
+        {
+            test(v.data(), v.data()+N, x);
+            test(v.data(), v.data()+N, x + 0.5);
+        }
+    }
+    unsigned char c[] = {0, 1, 1, 200, 255};
+    assert(std::lower_bound(c, c+5, -1) == c);
+    assert(std::lower_bound(c, c+5, 1) == c+1);
+    assert(std::lower_bound(c, c+5, 256) == c+5);
+}
+
 int main(int, char**)
 {
     int d[] = {0, 1, 2, 3};
@@ -76,6 +98,7 @@ int main(int, char**)
     test<bidirectional_iterator<const int*> >();
     test<random_access_iterator<const int*> >();
     test<const int*>();
+    test_arithmetic();
 
 #if TEST_STD_VER > 17
     static_assert(test_constexpr());
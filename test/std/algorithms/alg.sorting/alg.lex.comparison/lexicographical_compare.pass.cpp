@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 #include "test_macros.h"
 #include "test_iterators.h"
@@ -46,6 +47,43 @@ test()
     assert(!std::lexicographical_compare(Iter1(ib+1), Iter1(ib+3),  Iter2(ia),   Iter2(ia+sa)));
 }
 
+// Contiguous ranges of integers are compared with memcmp or a vector at a time, so they are compared with
+// the results of the generic algorithm at every length and every position of the first difference.
+template <class T>
+void
+test_contiguous()
+{
+    const int N = 100;
+    T ia[N];
+    T ib[N];
+    for (int i = 0; i < N; ++i)
+        ia[i] = ib[i] = T(i * 37);
+    for (int n1 = 0; n1 <= N; n1 += 9)
+    {
+        for (int n2 = 0; n2 <= N; n2 += 11)
+        {
+            for (int diff = 0; diff < N; diff += 13)
+            {
+                ib[diff] = T(ib[diff] - 1);
+                typedef forward_iterator<const T*> Iter;
+                assert(std::lexicographical_compare(ia, ia+n1, ib, ib+n2) ==
+                       std::lexicographical_compare(Iter(ia), Iter(ia+n1), Iter(ib), Iter(ib+n2)));
+                assert(std::lexicographical_compare(ib, ib+n2, ia, ia+n1) ==
+                       std::lexicographical_compare(Iter(ib), Iter(ib+n2), Iter(ia), Iter(ia+n1)));
+                ib[diff] = ia[diff];
+            }
+            assert(std::lexicographical_compare(ia, ia+n1, ib, ib+n2) == (n1 < n2));
+        }
+    }
+    std::vector<T> v1(ia, ia+N);
+    std::vector<T> v2(ia, ia+N-1);
+    assert(v2 < v1);
+    assert(!(v1 < v2));
+    // Empty ranges of null pointers.
+    T* null = 0;
+    assert(!std::lexicographical_compare(null, null, null, null));
+}
+
 int main(int, char**)
 {
     test<cpp17_input_iterator<const int*>, cpp17_input_iterator<const int*> >();
@@ -78,6 +116,15 @@ int main(int, char**)
     test<const int*, random_access_iterator<const int*> >();
     test<const int*, const int*>();
 
+    test_contiguous<unsigned char>();
+    test_contiguous<signed char>();
+    test_contiguous<char>();
+    test_contiguous<unsigned short>();
+    test_contiguous<int>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<unsigned long long>();
+
 #if TEST_STD_VER > 17
     static_assert(test_constexpr());
 #endif
@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <random>
 #include <cassert>
+#include <limits>
 
 #include "test_macros.h"
 #include "test_iterators.h"
@@ -60,6 +61,66 @@ test()
     test<Iter>(1000);
 }
 
+// Contiguous ranges of arithmetic values may be looked at several elements at a time, which must pick
+// the same element as going through them one at a time, NaNs included.
+template <class T>
+void
+test_same_as_forward(const T* a, int N)
+{
+    forward_iterator<const T*> i = std::min_element(forward_iterator<const T*>(a), forward_iterator<const T*>(a+N));
+    assert(std::min_element(a, a+N) == base(i));
+}
+
+template <class T>
+void
+test_contiguous()
+{
+    for (int N = 0; N < 600; N += 13)
+    {
+        T* a = new T[N];
+        for (int i = 0; i < N; ++i)
+            a[i] = T(randomness() % 8);
+        test_same_as_forward(a, N);
+        for (int i = 0; i < N; ++i)
+            a[i] = T(1);
+        test_same_as_forward(a, N);
+        if (N > 0)
+        {
+            a[N-1] = std::numeric_limits<T>::min();
+            a[N/2] = std::numeric_limits<T>::max();
+            test_same_as_forward(a, N);
+        }
+        delete [] a;
+    }
+}
+
+template <class T>
+void
+test_nan()
+{
+    const int sizes[] = {1, 2, 3, 17, 100, 1000};
+    for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        const int N = sizes[s];
+        T* a = new T[N];
+        const int positions[] = {0, 1, N/2, N-1};
+        for (unsigned p = 0; p < sizeof(positions) / sizeof(positions[0]); ++p)
+        {
+            if (positions[p] >= N)
+                continue;
+            for (int i = 0; i < N; ++i)
+                a[i] = T(randomness() % 5) - T(2);
+            a[positions[p]] = std::numeric_limits<T>::quiet_NaN();
+            test_same_as_forward(a, N);
+            a[N-1] = std::numeric_limits<T>::quiet_NaN();
+            test_same_as_forward(a, N);
+            a[0] = T(-0.0);
+            test_same_as_forward(a, N);
+        }
+        delete [] a;
+    }
+}
+
 #if TEST_STD_VER >= 14
 constexpr int il[] = { 2, 4, 6, 8, 7, 5, 3, 1 };
 #endif
@@ -78,6 +139,16 @@ int main(int, char**)
     test<bidirectional_iterator<const int*> >();
     test<random_access_iterator<const int*> >();
     test<const int*>();
+    test_contiguous<signed char>();
+    test_contiguous<unsigned char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<unsigned long long>();
+    test_contiguous<float>();
+    test_contiguous<double>();
+    test_nan<float>();
+    test_nan<double>();
 
     constexpr_test();
 
@@ -49,6 +49,40 @@ TEST_CONSTEXPR_CXX20 void test4()
     }
 }
 
+// Long runs of either range ordered before the current element of the other one are skipped by
+// galloping when both ranges are random access and one of them is much longer than the other one.
+// Compare with the element by element algorithm.
+template<class T, class Iter1, class Iter2>
+TEST_CONSTEXPR_CXX20 void test_skewed()
+{
+    T a[700] = {};
+    for (int i = 0; i < 700; ++i)
+        a[i] = T(10 * (i / 2) + 1);
+    const T b[] = {2, 2, 62, 252, 253, 254, 492, 1002, 1003};
+    {
+        T result[720] = {};
+        T expected[720] = {};
+        T* end = std::set_intersection(Iter1(a), Iter1(a+700), Iter2(b), Iter2(b+9), result);
+        T* expected_end = std::set_intersection(cpp17_input_iterator<const T*>(a), cpp17_input_iterator<const T*>(a+700),
+                                                cpp17_input_iterator<const T*>(b), cpp17_input_iterator<const T*>(b+9), expected);
+        assert(end - result == 8);
+        assert(expected_end - expected == 8);
+        for (int i = 0; i < 8; ++i)
+            assert(result[i].value == expected[i].value);
+    }
+    {
+        T result[720] = {};
+        T expected[720] = {};
+        T* end = std::set_intersection(Iter1(b), Iter1(b+9), Iter2(a), Iter2(a+700), result);
+        T* expected_end = std::set_intersection(cpp17_input_iterator<const T*>(b), cpp17_input_iterator<const T*>(b+9),
+                                                cpp17_input_iterator<const T*>(a), cpp17_input_iterator<const T*>(a+700), expected);
+        assert(end - result == 8);
+        assert(expected_end - expected == 8);
+        for (int i = 0; i < 8; ++i)
+            assert(result[i].value == expected[i].value);
+    }
+}
+
 template<class T, class Iter1, class Iter2>
 TEST_CONSTEXPR_CXX20 void test3()
 {
@@ -77,6 +111,10 @@ TEST_CONSTEXPR_CXX20 void test1()
     test2<T, bidirectional_iterator<const T*> >();
     test2<T, random_access_iterator<const T*> >();
     test2<T, const T*>();
+
+    test_skewed<T, random_access_iterator<const T*>, random_access_iterator<const T*> >();
+    test_skewed<T, random_access_iterator<const T*>, const T*>();
+    test_skewed<T, const T*, const T*>();
 }
 
 TEST_CONSTEXPR_CXX20 bool test()
@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: libcpp-has-no-incomplete-pstl
+
+// <algorithm>
+
+// template<class ExecutionPolicy, class RandomAccessIterator>
+//   void sort(ExecutionPolicy&& exec,
+//             RandomAccessIterator first, RandomAccessIterator last);
+//
+// template<class ExecutionPolicy, class RandomAccessIterator, class Compare>
+//   void sort(ExecutionPolicy&& exec,
+//             RandomAccessIterator first, RandomAccessIterator last,
+//             Compare comp);
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class Iter>
+struct Test {
+  template <class ExecutionPolicy>
+  void operator()(ExecutionPolicy&& policy) {
+    std::mt19937 gen(42);
+    for (std::size_t size : pstl_test_sizes) {
+      std::vector<int> v(size);
+      for (std::size_t i = 0; i != size; ++i)
+        v[i] = static_cast<int>(i % 1000);
+      std::vector<int> expected = v;
+      std::sort(expected.begin(), expected.end());
+
+      std::shuffle(v.begin(), v.end(), gen);
+      std::sort(policy, Iter(v.data()), Iter(v.data() + v.size()));
+      assert(v == expected);
+
+      std::shuffle(v.begin(), v.end(), gen);
+      std::sort(policy, Iter(v.data()), Iter(v.data() + v.size()), std::greater<>());
+      assert(std::equal(v.begin(), v.end(), expected.rbegin()));
+
+      // Already sorted input.
+      std::sort(policy, Iter(v.data()), Iter(v.data() + v.size()), std::greater<>());
+      assert(std::equal(v.begin(), v.end(), expected.rbegin()));
+    }
+  }
+};
+
+int main(int, char**) {
+  test_execution_policies(Test<random_access_iterator<int*>>{});
+  test_execution_policies(Test<int*>{});
+
+  return 0;
+}
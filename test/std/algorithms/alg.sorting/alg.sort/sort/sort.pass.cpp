@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <random>
 #include <cassert>
@@ -271,6 +272,61 @@ void run_sort_tests()
     test_larger_sorts<Container>(1009);
 }
 
+// Sorting with a comparator other than the default one may use a different algorithm.
+template <class T>
+bool less_than(T x, T y)
+{
+    return x < y;
+}
+
+template <class T>
+void test_arithmetic_sort(std::size_t N)
+{
+    std::vector<T> v(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        // Mix all bit patterns with a few duplicates and, for signed types, negative values.
+        unsigned long long bits = (static_cast<unsigned long long>(randomness()) << 32) | randomness();
+        v[i] = static_cast<T>(i % 4 == 0 ? bits % 8 : bits);
+    }
+    std::vector<T> expected = v;
+    std::sort(expected.begin(), expected.end(), less_than<T>);
+    std::sort(v.begin(), v.end());
+    assert(v == expected);
+}
+
+template <class T>
+void test_floating_point_sort(std::size_t N)
+{
+    const T special[] = {T(0), -T(0), std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+                         std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min(),
+                         std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest(), T(1), T(-1)};
+    std::uniform_real_distribution<T> dist(-1000, 1000);
+    std::vector<T> v(N);
+    for (std::size_t i = 0; i < N; ++i)
+        v[i] = i % 3 == 0 ? special[i % 10] : dist(randomness);
+    std::vector<T> expected = v;
+    std::sort(expected.begin(), expected.end(), less_than<T>);
+    std::sort(v.begin(), v.end());
+    // -0.0 and 0.0 are equivalent, so they may appear in any order.
+    assert(v == expected);
+}
+
+template <class T>
+void test_arithmetic_sorts()
+{
+    const std::size_t sizes[] = {0, 1, 2, 100, 255, 256, 257, 511, 512, 513, 1023, 1024, 1025, 2047, 2048, 2049, 10000};
+    for (std::size_t i = 0; i != sizeof(sizes) / sizeof(sizes[0]); ++i)
+        test_arithmetic_sort<T>(sizes[i]);
+}
+
+template <class T>
+void test_floating_point_sorts()
+{
+    const std::size_t sizes[] = {0, 1, 2, 100, 1023, 1024, 1025, 2047, 2048, 2049, 10000};
+    for (std::size_t i = 0; i != sizeof(sizes) / sizeof(sizes[0]); ++i)
+        test_floating_point_sort<T>(sizes[i]);
+}
+
 int main(int, char**)
 {
     // test various combinations of contiguous/non-contiguous containers with
@@ -282,5 +338,23 @@ int main(int, char**)
     test_pointer_sort();
     test_adversarial_quicksort(1 << 20);
 
+    test_arithmetic_sorts<char>();
+#ifndef TEST_HAS_NO_WIDE_CHARACTERS
+    test_arithmetic_sorts<wchar_t>();
+#endif
+    test_arithmetic_sorts<signed char>();
+    test_arithmetic_sorts<unsigned char>();
+    test_arithmetic_sorts<short>();
+    test_arithmetic_sorts<unsigned short>();
+    test_arithmetic_sorts<int>();
+    test_arithmetic_sorts<unsigned int>();
+    test_arithmetic_sorts<long>();
+    test_arithmetic_sorts<unsigned long>();
+    test_arithmetic_sorts<long long>();
+    test_arithmetic_sorts<unsigned long long>();
+    test_floating_point_sorts<float>();
+    test_floating_point_sorts<double>();
+    test_floating_point_sorts<long double>();
+
     return 0;
 }
@@ -20,6 +20,7 @@
 #include <cassert>
 #include <cstddef>
 #include <memory>
+#include <random>
 
 #include "test_macros.h"
 
@@ -30,8 +31,33 @@ struct indirect_less
         {return *x < *y;}
 };
 
+// Ranges of arithmetic values sorted with a standard comparator are partitioned block by block,
+// so test lengths around the block size, with many and with few duplicates.
+void test_greater(int N, int M)
+{
+    std::vector<int> v(N);
+    for (int i = 0; i < N; ++i)
+        v[i] = i % M;
+    std::shuffle(v.begin(), v.end(), std::mt19937(N + M));
+    std::sort(v.begin(), v.end(), std::greater<int>());
+    assert(std::is_sorted(v.begin(), v.end(), std::greater<int>()));
+    for (int i = 0; i < N; ++i)
+        assert(std::count(v.begin(), v.end(), i % M) == (N - i % M + M - 1) / M);
+}
+
 int main(int, char**)
 {
+    {
+    const int sizes[] = {63, 64, 65, 127, 128, 129, 130, 255, 256, 257, 1000, 4096};
+    for (std::size_t i = 0; i != sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        test_greater(sizes[i], 1);
+        test_greater(sizes[i], 2);
+        test_greater(sizes[i], 7);
+        test_greater(sizes[i], sizes[i]);
+    }
+    }
+
     {
     std::vector<int> v(1000);
     for (int i = 0; static_cast<std::size_t>(i) < v.size(); ++i)
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: libcpp-has-no-incomplete-pstl
+
+// <algorithm>
+
+// template<class ExecutionPolicy, class RandomAccessIterator>
+//   void stable_sort(ExecutionPolicy&& exec,
+//                    RandomAccessIterator first, RandomAccessIterator last);
+//
+// template<class ExecutionPolicy, class RandomAccessIterator, class Compare>
+//   void stable_sort(ExecutionPolicy&& exec,
+//                    RandomAccessIterator first, RandomAccessIterator last,
+//                    Compare comp);
+
+#include <algorithm>
+#include <cassert>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class Iter>
+struct Test {
+  template <class ExecutionPolicy>
+  void operator()(ExecutionPolicy&& policy) {
+    std::mt19937 gen(42);
+    for (std::size_t size : pstl_test_sizes) {
+      // Only compare the keys, so that the order of the payloads checks the stability.
+      std::vector<std::pair<int, int>> v(size);
+      for (std::size_t i = 0; i != size; ++i)
+        v[i] = {static_cast<int>(gen() % 100), static_cast<int>(i)};
+
+      std::stable_sort(policy, Iter(v.data()), Iter(v.data() + v.size()), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+      });
+      for (std::size_t i = 1; i < size; ++i)
+        assert(v[i - 1].first < v[i].first || (v[i - 1].first == v[i].first && v[i - 1].second < v[i].second));
+
+      std::shuffle(v.begin(), v.end(), gen);
+      std::vector<std::pair<int, int>> expected = v;
+      std::sort(expected.begin(), expected.end());
+      std::stable_sort(policy, Iter(v.data()), Iter(v.data() + v.size()));
+      assert(v == expected);
+    }
+  }
+};
+
+int main(int, char**) {
+  test_execution_policies(Test<random_access_iterator<std::pair<int, int>*>>{});
+  test_execution_policies(Test<std::pair<int, int>*>{});
+
+  return 0;
+}
@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17
+
+// <algorithm>
+
+// template<class InputIterator1, class InputIterator2>
+//   constexpr auto
+//   lexicographical_compare_three_way(InputIterator1 first1, InputIterator1 last1,
+//                                     InputIterator2 first2, InputIterator2 last2);
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstdint>
+#include <type_traits>
+
+#include "test_macros.h"
+#include "test_iterators.h"
+
+template <class Iter1, class Iter2>
+constexpr void test_iterators() {
+  int a[] = {1, 2, 3, 4};
+  int b[] = {1, 2, 3};
+  int c[] = {1, 3};
+
+  std::same_as<std::strong_ordering> decltype(auto) r =
+      std::lexicographical_compare_three_way(Iter1(a), Iter1(a + 4), Iter2(b), Iter2(b + 3));
+  assert(r == std::strong_ordering::greater);
+  assert(std::lexicographical_compare_three_way(Iter1(b), Iter1(b + 3), Iter2(a), Iter2(a + 4)) ==
+         std::strong_ordering::less);
+  assert(std::lexicographical_compare_three_way(Iter1(a), Iter1(a + 3), Iter2(b), Iter2(b + 3)) ==
+         std::strong_ordering::equal);
+  assert(std::lexicographical_compare_three_way(Iter1(a), Iter1(a + 4), Iter2(c), Iter2(c + 2)) ==
+         std::strong_ordering::less);
+  assert(std::lexicographical_compare_three_way(Iter1(c), Iter1(c + 2), Iter2(a), Iter2(a + 4)) ==
+         std::strong_ordering::greater);
+  assert(std::lexicographical_compare_three_way(Iter1(a), Iter1(a), Iter2(b), Iter2(b)) ==
+         std::strong_ordering::equal);
+  assert(std::lexicographical_compare_three_way(Iter1(a), Iter1(a), Iter2(b), Iter2(b + 1)) ==
+         std::strong_ordering::less);
+}
+
+constexpr bool test() {
+  test_iterators<cpp17_input_iterator<const int*>, cpp17_input_iterator<const int*>>();
+  test_iterators<cpp17_input_iterator<const int*>, random_access_iterator<const int*>>();
+  test_iterators<forward_iterator<const int*>, const int*>();
+  test_iterators<random_access_iterator<const int*>, cpp17_input_iterator<const int*>>();
+  test_iterators<random_access_iterator<const int*>, random_access_iterator<const int*>>();
+  test_iterators<contiguous_iterator<const int*>, int*>();
+  test_iterators<const int*, const int*>();
+
+  {
+    // Ordered like the comparison of the elements.
+    double a[] = {1.0, 2.0};
+    double b[] = {1.0, 3.0};
+    std::same_as<std::partial_ordering> decltype(auto) r =
+        std::lexicographical_compare_three_way(a, a + 2, b, b + 2);
+    assert(r == std::partial_ordering::less);
+  }
+
+  return true;
+}
+
+// Contiguous ranges of integers are compared with memcmp or a vector at a time, so they are compared with the
+// results of the generic algorithm at every length and every position of the first difference.
+template <class T>
+void test_contiguous() {
+  const int N = 100;
+  T a[N];
+  T b[N];
+  for (int i = 0; i < N; ++i)
+    a[i] = b[i] = T(i * 37);
+  for (int n1 = 0; n1 <= N; n1 += 9) {
+    for (int n2 = 0; n2 <= N; n2 += 11) {
+      for (int diff = 0; diff < N; diff += 13) {
+        b[diff] = T(b[diff] - 1);
+        auto expected = std::lexicographical_compare_three_way(
+            forward_iterator<const T*>(a), forward_iterator<const T*>(a + n1),
+            forward_iterator<const T*>(b), forward_iterator<const T*>(b + n2));
+        assert(std::lexicographical_compare_three_way(a, a + n1, b, b + n2) == expected);
+        assert(std::lexicographical_compare_three_way(b, b + n2, a, a + n1) == (0 <=> expected));
+        b[diff] = a[diff];
+      }
+      auto expected = n1 <=> n2;
+      assert(std::lexicographical_compare_three_way(a, a + n1, b, b + n2) == expected);
+    }
+  }
+  // Empty ranges of null pointers.
+  assert(std::lexicographical_compare_three_way(static_cast<T*>(nullptr), static_cast<T*>(nullptr),
+                                                static_cast<T*>(nullptr), static_cast<T*>(nullptr)) == 0);
+}
+
+int main(int, char**) {
+  test();
+  static_assert(test());
+
+  test_contiguous<unsigned char>();
+  test_contiguous<signed char>();
+  test_contiguous<char>();
+  test_contiguous<std::uint16_t>();
+  test_contiguous<int>();
+  test_contiguous<std::uint32_t>();
+  test_contiguous<long long>();
+  test_contiguous<std::uint64_t>();
+
+  return 0;
+}
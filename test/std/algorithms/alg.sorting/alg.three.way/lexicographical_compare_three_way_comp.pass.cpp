@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17
+
+// <algorithm>
+
+// template<class InputIterator1, class InputIterator2, class Cmp>
+//   constexpr auto
+//   lexicographical_compare_three_way(InputIterator1 first1, InputIterator1 last1,
+//                                     InputIterator2 first2, InputIterator2 last2,
+//                                     Cmp comp)
+//     -> decltype(comp(*first1, *first2));
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <type_traits>
+
+#include "test_macros.h"
+#include "test_iterators.h"
+
+struct ReverseWeak {
+  constexpr std::weak_ordering operator()(int x, int y) const { return y <=> x; }
+};
+
+template <class Iter1, class Iter2>
+constexpr void test_iterators() {
+  int a[] = {3, 2, 1, 0};
+  int b[] = {3, 2, 1};
+  int c[] = {3, 1};
+
+  std::same_as<std::weak_ordering> decltype(auto) r =
+      std::lexicographical_compare_three_way(Iter1(a), Iter1(a + 4), Iter2(b), Iter2(b + 3), ReverseWeak());
+  assert(r == std::weak_ordering::greater);
+  assert(std::lexicographical_compare_three_way(Iter1(b), Iter1(b + 3), Iter2(a), Iter2(a + 4), ReverseWeak()) ==
+         std::weak_ordering::less);
+  assert(std::lexicographical_compare_three_way(Iter1(a), Iter1(a + 3), Iter2(b), Iter2(b + 3), ReverseWeak()) ==
+         std::weak_ordering::equivalent);
+  assert(std::lexicographical_compare_three_way(Iter1(a), Iter1(a + 4), Iter2(c), Iter2(c + 2), ReverseWeak()) ==
+         std::weak_ordering::less);
+  assert(std::lexicographical_compare_three_way(Iter1(c), Iter1(c + 2), Iter2(a), Iter2(a + 4), ReverseWeak()) ==
+         std::weak_ordering::greater);
+
+  // The comparator is called on the elements of the first range and the second range in that order.
+  int calls = 0;
+  auto comp = [&calls](int x, long y) {
+    ++calls;
+    return x <=> y;
+  };
+  assert(std::lexicographical_compare_three_way(Iter1(a), Iter1(a + 4), Iter2(b), Iter2(b + 3), comp) ==
+         std::strong_ordering::greater);
+  assert(calls == 3);
+}
+
+constexpr bool test() {
+  test_iterators<cpp17_input_iterator<const int*>, cpp17_input_iterator<const int*>>();
+  test_iterators<forward_iterator<const int*>, random_access_iterator<const int*>>();
+  test_iterators<random_access_iterator<const int*>, random_access_iterator<const int*>>();
+  test_iterators<const int*, const int*>();
+
+  {
+    // A comparator that isn't compare_three_way orders contiguous ranges of bytes with its own results.
+    unsigned char a[] = {1, 200};
+    unsigned char b[] = {1, 100};
+    auto reverse = [](unsigned char x, unsigned char y) { return y <=> x; };
+    assert(std::lexicographical_compare_three_way(a, a + 2, b, b + 2, reverse) == std::strong_ordering::less);
+    assert(std::lexicographical_compare_three_way(a, a + 2, b, b + 2, std::compare_three_way()) ==
+           std::strong_ordering::greater);
+  }
+
+  return true;
+}
+
+int main(int, char**) {
+  test();
+  static_assert(test());
+
+  return 0;
+}
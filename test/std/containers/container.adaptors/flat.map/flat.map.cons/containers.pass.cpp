@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17, c++20
+
+// <flat_map>
+
+// flat_map(key_container_type key_cont, mapped_container_type mapped_cont,
+//          const key_compare& comp = key_compare());
+// flat_map(sorted_unique_t, key_container_type key_cont, mapped_container_type mapped_cont,
+//          const key_compare& comp = key_compare());
+// template<class Allocator>
+//   flat_map(const key_container_type& key_cont, const mapped_container_type& mapped_cont,
+//            const Allocator& a);
+// template<class Allocator>
+//   flat_map(sorted_unique_t, const key_container_type& key_cont,
+//            const mapped_container_type& mapped_cont, const Allocator& a);
+
+#include <flat_map>
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "test_allocator.h"
+#include "test_macros.h"
+
+int main(int, char**)
+{
+    {
+        // The keys are sorted and the mapped values follow them. The first of
+        // equivalent keys is kept.
+        std::vector<int> ks = {5, 2, 8, 2, 1, 5};
+        std::vector<char> vs = {'a', 'b', 'c', 'd', 'e', 'f'};
+        std::flat_map<int, char> m(ks, vs);
+        assert(m.size() == 4);
+        assert((m.keys() == std::vector<int>{1, 2, 5, 8}));
+        assert((m.values() == std::vector<char>{'e', 'b', 'a', 'c'}));
+    }
+    {
+        std::flat_map<int, char, std::greater<int>> m({1, 3, 2}, {'a', 'c', 'b'}, std::greater<int>());
+        assert((m.keys() == std::vector<int>{3, 2, 1}));
+        assert((m.values() == std::vector<char>{'c', 'b', 'a'}));
+    }
+    {
+        // Sorted containers are taken as they are.
+        std::flat_map<int, int, std::less<int>, std::deque<int>, std::deque<int>> m(
+            std::sorted_unique, std::deque<int>{1, 2, 3}, std::deque<int>{4, 5, 6});
+        assert(m.size() == 3);
+        assert(m.at(2) == 5);
+    }
+    {
+        // Deduction from the containers.
+        std::flat_map m(std::deque<int>{3, 1, 2}, std::vector<double>{3.0, 1.0, 2.0});
+        ASSERT_SAME_TYPE(decltype(m),
+                         std::flat_map<int, double, std::less<int>, std::deque<int>, std::vector<double>>);
+        assert(m.begin()->first == 1 && m.begin()->second == 1.0);
+        std::flat_map s(std::sorted_unique, std::vector<int>{1, 2}, std::vector<int>{2, 1}, std::greater<int>());
+        ASSERT_SAME_TYPE(decltype(s), std::flat_map<int, int, std::greater<int>>);
+    }
+    {
+        // Both containers get the allocator.
+        typedef std::vector<int, test_allocator<int>> Keys;
+        typedef std::vector<long, test_allocator<long>> Values;
+        typedef std::flat_map<int, long, std::less<int>, Keys, Values> M;
+        static_assert(std::uses_allocator_v<M, test_allocator<int>>);
+        static_assert(!std::uses_allocator_v<M, std::allocator<int>>);
+        Keys ks({3, 1, 3}, test_allocator<int>(1));
+        Values vs({30, 10, 31}, test_allocator<long>(1));
+        M m(ks, vs, test_allocator<int>(7));
+        assert(m.keys().get_allocator().get_data() == 7);
+        assert(m.values().get_allocator().get_data() == 7);
+        assert((m.keys() == Keys{1, 3}));
+        assert((m.values() == Values{10, 30}));
+
+        M s(std::sorted_unique, ks, vs, test_allocator<int>(8));
+        assert(s.keys().get_allocator().get_data() == 8);
+        assert(s.size() == 3);
+
+        M e(test_allocator<int>(9));
+        assert(e.empty() && e.keys().get_allocator().get_data() == 9);
+
+        M c(m, test_allocator<int>(10));
+        assert(c == m && c.values().get_allocator().get_data() == 10);
+        M d(std::move(c), test_allocator<int>(11));
+        assert(d == m && d.values().get_allocator().get_data() == 11);
+        assert(c.empty());
+    }
+
+  return 0;
+}
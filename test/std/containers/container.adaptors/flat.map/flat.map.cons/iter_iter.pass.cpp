@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17, c++20
+
+// <flat_map>
+
+// template <class InputIterator>
+//   flat_map(InputIterator first, InputIterator last, const key_compare& comp = key_compare());
+// template <class InputIterator>
+//   flat_map(sorted_unique_t, InputIterator first, InputIterator last,
+//            const key_compare& comp = key_compare());
+// flat_map(initializer_list<value_type> il, const key_compare& comp = key_compare());
+// flat_map(flat_map&&);
+// flat_map& operator=(flat_map&&);
+
+#include <flat_map>
+#include <cassert>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "test_iterators.h"
+#include "test_macros.h"
+
+int main(int, char**)
+{
+    typedef std::pair<int, int> P;
+    {
+        P a[] = {P(3, 0), P(1, 1), P(3, 2), P(2, 3), P(1, 4)};
+        std::flat_map<int, int> m(cpp17_input_iterator<const P*>(a), cpp17_input_iterator<const P*>(a + 5));
+        assert(m.size() == 3);
+        assert((m.keys() == std::vector<int>{1, 2, 3}));
+        assert((m.values() == std::vector<int>{1, 3, 0}));
+
+        std::flat_map<int, int, std::greater<int>> g(a, a + 5, std::greater<int>());
+        assert((g.keys() == std::vector<int>{3, 2, 1}));
+        assert((g.values() == std::vector<int>{0, 3, 1}));
+
+        std::flat_map d(a, a + 5);
+        ASSERT_SAME_TYPE(decltype(d), std::flat_map<int, int>);
+        assert(d == m);
+    }
+    {
+        P a[] = {P(1, 1), P(2, 2), P(4, 4)};
+        std::flat_map<int, int> m(std::sorted_unique, a, a + 3);
+        assert((m.keys() == std::vector<int>{1, 2, 4}));
+    }
+    {
+        std::flat_map<int, int> m = {{2, 2}, {1, 1}, {2, 3}};
+        assert(m.size() == 2 && m[2] == 2);
+        std::flat_map<int, int> s(std::sorted_unique, {{1, 1}, {2, 2}});
+        assert(s == m);
+        m = {{5, 5}};
+        assert(m.size() == 1 && m.begin()->first == 5);
+    }
+    {
+        // A moved-from flat_map is empty.
+        std::flat_map<int, int> m = {{1, 1}, {2, 2}};
+        std::flat_map<int, int> n(std::move(m));
+        assert(m.empty() && m.keys().empty() && m.values().empty());
+        assert(n.size() == 2);
+        m = std::move(n);
+        assert(n.empty() && m.size() == 2);
+        m.emplace(0, 0);
+        assert(m.size() == 3);
+    }
+
+  return 0;
+}
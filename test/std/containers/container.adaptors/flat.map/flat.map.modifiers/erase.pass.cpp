@@ -0,0 +1,82 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17, c++20
+
+// <flat_map>
+
+// iterator erase(iterator position);
+// iterator erase(const_iterator position);
+// size_type erase(const key_type& x);
+// iterator erase(const_iterator first, const_iterator last);
+// containers extract() &&;
+// void replace(key_container_type&& key_cont, mapped_container_type&& mapped_cont);
+// void clear() noexcept;
+// template<class Key, class T, class Compare, class KeyContainer, class MappedContainer, class Predicate>
+//   size_type erase_if(flat_map<Key, T, Compare, KeyContainer, MappedContainer>& c, Predicate pred);
+
+#include <flat_map>
+#include <cassert>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_macros.h"
+
+int main(int, char**)
+{
+    typedef std::flat_map<int, char> M;
+    {
+        M m = {{1, 'a'}, {2, 'b'}, {3, 'c'}, {4, 'd'}, {5, 'e'}};
+        M::iterator it = m.erase(m.begin() + 1);
+        assert(it->first == 3 && m.size() == 4);
+        M::const_iterator cit = m.cbegin();
+        it = m.erase(cit);
+        assert(it == m.begin() && it->first == 3);
+        assert(m.erase(4) == 1);
+        assert(m.erase(4) == 0);
+        assert((m.keys() == std::vector<int>{3, 5}));
+        assert((m.values() == std::vector<char>{'c', 'e'}));
+        it = m.erase(m.cbegin(), m.cend());
+        assert(it == m.end() && m.empty());
+    }
+    {
+        std::flat_map<std::string, int, std::less<>> m = {{"a", 1}, {"b", 2}};
+        assert(m.erase("a") == 1);
+        assert(m.size() == 1 && m.begin()->first == "b");
+    }
+    {
+        M m = {{1, 'a'}, {2, 'b'}, {3, 'c'}};
+        M::containers c = std::move(m).extract();
+        assert(m.empty());
+        assert((c.keys == std::vector<int>{1, 2, 3}));
+        assert((c.values == std::vector<char>{'a', 'b', 'c'}));
+        c.keys.push_back(4);
+        c.values.push_back('d');
+        m.replace(std::move(c.keys), std::move(c.values));
+        assert(m.size() == 4 && m.at(4) == 'd');
+        m.clear();
+        assert(m.empty() && m.keys().empty() && m.values().empty());
+        ASSERT_NOEXCEPT(m.clear());
+    }
+    {
+        M m;
+        for (int i = 0; i < 100; ++i)
+            m.emplace(i, static_cast<char>('a' + i % 26));
+        auto n = std::erase_if(m, [](std::pair<const int&, const char&> p) { return p.first % 3 == 0 || p.second == 'b'; });
+        assert(n == 34 + 3);
+        assert(m.size() == 63);
+        for (auto [k, v] : m)
+            assert(k % 3 != 0 && v != 'b' && v == 'a' + k % 26);
+        assert(std::erase_if(m, [](auto) { return false; }) == 0);
+        assert(m.size() == 63);
+    }
+
+  return 0;
+}
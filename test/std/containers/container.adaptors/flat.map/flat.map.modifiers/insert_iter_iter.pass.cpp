@@ -0,0 +1,130 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17, c++20
+
+// <flat_map>
+
+// template <class InputIterator>
+//   void insert(InputIterator first, InputIterator last);
+// template <class InputIterator>
+//   void insert(sorted_unique_t, InputIterator first, InputIterator last);
+// void insert(initializer_list<value_type> il);
+
+#include <flat_map>
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class M>
+void check_like_map(const M& m, const std::map<int, int>& expected)
+{
+    assert(m.size() == expected.size());
+    assert(m.keys().size() == m.values().size());
+    auto it = m.begin();
+    for (const auto& p : expected)
+    {
+        assert(it->first == p.first);
+        assert(it->second == p.second);
+        ++it;
+    }
+}
+
+template <class M>
+void test()
+{
+    typedef std::pair<int, int> P;
+    // Inserting a range behaves like inserting its elements one at a time:
+    // elements whose key is already there are dropped.
+    for (int n : {0, 1, 2, 10, 100, 1000})
+    {
+        for (int shift : {0, 1, n / 2, n})
+        {
+            std::vector<P> existing;
+            for (int i = 0; i < n; ++i)
+                existing.push_back(P(2 * i, i));
+            std::vector<P> added;
+            for (int i = 0; i < n; ++i)
+                added.push_back(P((i * 7919 + shift) % (2 * n + 5), -i));
+
+            M m(existing.begin(), existing.end());
+            std::map<int, int> expected(existing.begin(), existing.end());
+            m.insert(added.begin(), added.end());
+            expected.insert(added.begin(), added.end());
+            check_like_map(m, expected);
+
+            // Appending sorted elements past the end.
+            std::vector<P> tail;
+            for (int i = 0; i < n; ++i)
+                tail.push_back(P(4 * n + 10 + i, i));
+            m.insert(std::sorted_unique, tail.begin(), tail.end());
+            expected.insert(tail.begin(), tail.end());
+            check_like_map(m, expected);
+
+            m.insert(cpp17_input_iterator<const P*>(added.data()),
+                     cpp17_input_iterator<const P*>(added.data() + added.size()));
+            check_like_map(m, expected);
+        }
+    }
+    {
+        M m = {{1, 1}, {3, 3}};
+        m.insert({{2, 2}, {3, 0}, {0, 0}, {2, 5}});
+        check_like_map(m, {{0, 0}, {1, 1}, {2, 2}, {3, 3}});
+    }
+}
+
+#ifndef TEST_HAS_NO_EXCEPTIONS
+struct ThrowingLess
+{
+    static int countdown;
+    bool operator()(int x, int y) const
+    {
+        if (countdown > 0 && --countdown == 0)
+            throw 1;
+        return x < y;
+    }
+};
+int ThrowingLess::countdown = 0;
+
+void test_exceptions()
+{
+    std::flat_map<int, int, ThrowingLess> m = {{1, 1}, {2, 2}};
+    std::pair<int, int> a[] = {{5, 5}, {0, 0}, {3, 3}};
+    ThrowingLess::countdown = 3;
+    try
+    {
+        m.insert(a, a + 3);
+        assert(false);
+    }
+    catch (int)
+    {
+    }
+    // The invariants are restored by emptying the map.
+    assert(m.empty() && m.keys().empty() && m.values().empty());
+    m.insert(a, a + 3);
+    assert(m.size() == 3 && m.begin()->first == 0);
+}
+#endif
+
+int main(int, char**)
+{
+    test<std::flat_map<int, int>>();
+    test<std::flat_map<int, int, std::less<int>, std::deque<int>, std::deque<int>>>();
+#ifndef TEST_HAS_NO_EXCEPTIONS
+    test_exceptions();
+#endif
+
+  return 0;
+}
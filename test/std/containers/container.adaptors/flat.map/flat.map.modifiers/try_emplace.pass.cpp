@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17, c++20
+
+// <flat_map>
+
+// mapped_type& operator[](const key_type& k);
+// mapped_type& at(const key_type& k);
+// pair<iterator, bool> emplace(Args&&... args);
+// iterator emplace_hint(const_iterator position, Args&&... args);
+// pair<iterator, bool> try_emplace(const key_type& k, Args&&... args);
+// iterator try_emplace(const_iterator hint, key_type&& k, Args&&... args);
+// pair<iterator, bool> insert_or_assign(const key_type& k, M&& obj);
+// iterator insert_or_assign(const_iterator hint, key_type&& k, M&& obj);
+
+#include <flat_map>
+#include <cassert>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "test_macros.h"
+
+struct Moveable
+{
+    int value;
+    explicit Moveable(int v = 0) : value(v) {}
+    Moveable(Moveable&& other) : value(other.value) { other.value = -1; }
+    Moveable& operator=(Moveable&& other)
+    {
+        value = other.value;
+        other.value = -1;
+        return *this;
+    }
+};
+
+int main(int, char**)
+{
+    {
+        std::flat_map<int, std::string> m;
+        m[3] = "three";
+        m[1] = "one";
+        m[2];
+        assert(m.size() == 3);
+        assert(m.at(1) == "one" && m.at(2) == "" && m.at(3) == "three");
+        const auto& c = m;
+        assert(c.at(3) == "three");
+#ifndef TEST_HAS_NO_EXCEPTIONS
+        try
+        {
+            (void)c.at(4);
+            assert(false);
+        }
+        catch (const std::out_of_range&)
+        {
+        }
+#endif
+    }
+    {
+        std::flat_map<int, Moveable> m;
+        auto r = m.try_emplace(2, 20);
+        assert(r.second && r.first->first == 2 && r.first->second.value == 20);
+        Moveable mv(5);
+        r = m.try_emplace(2, std::move(mv));
+        // Nothing is moved from when the key is there.
+        assert(!r.second && r.first->second.value == 20 && mv.value == 5);
+        auto it = m.try_emplace(m.end(), 3, 30);
+        assert(it->first == 3 && it->second.value == 30);
+        // A wrong hint is only a hint.
+        it = m.try_emplace(m.end(), 1, 10);
+        assert(it == m.begin() && it->second.value == 10);
+        it = m.try_emplace(m.begin(), 3, 99);
+        assert(it->first == 3 && it->second.value == 30);
+        assert(m.size() == 3);
+
+        auto p = m.insert_or_assign(3, Moveable(31));
+        assert(!p.second && p.first->second.value == 31);
+        p = m.insert_or_assign(0, Moveable(0));
+        assert(p.second && p.first == m.begin());
+        it = m.insert_or_assign(m.begin(), 4, Moveable(40));
+        assert(it->first == 4 && it == m.end() - 1);
+    }
+    {
+        std::flat_map<int, int> m;
+        auto r = m.emplace(std::piecewise_construct, std::forward_as_tuple(2), std::forward_as_tuple(4));
+        assert(r.second && r.first->second == 4);
+        r = m.emplace(2, 5);
+        assert(!r.second && r.first->second == 4);
+        auto it = m.emplace_hint(m.end(), 3, 6);
+        assert(it->first == 3);
+        it = m.emplace_hint(m.end(), 1, 2);
+        assert(it == m.begin());
+        assert(m.insert(std::make_pair(2, 0)).first == m.begin() + 1);
+        assert(m.insert(m.begin(), std::pair<const int, int>(7, 7))->first == 7);
+        assert((m.keys() == std::vector<int>{1, 2, 3, 7}));
+        assert((m.values() == std::vector<int>{2, 4, 6, 7}));
+    }
+    {
+        // Transparent comparators look up and insert by other types.
+        std::flat_map<std::string, int, std::less<>> m;
+        m["b"] = 2;
+        m.try_emplace("a", 1);
+        m.insert_or_assign("c", 3);
+        assert(m.at("a") == 1 && m.at("b") == 2 && m.at("c") == 3);
+    }
+
+  return 0;
+}
@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17, c++20
+
+// <flat_map>
+
+// iterator find(const key_type& x);
+// size_type count(const key_type& x) const;
+// bool contains(const key_type& x) const;
+// iterator lower_bound(const key_type& x);
+// iterator upper_bound(const key_type& x);
+// pair<iterator, iterator> equal_range(const key_type& x);
+// and the const and transparent overloads
+
+#include <flat_map>
+#include <cassert>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "test_macros.h"
+
+template <class M>
+void test()
+{
+    M m;
+    for (int i = 0; i < 50; ++i)
+        m.emplace(2 * i, i);
+    const M& c = m;
+    for (int k = -1; k <= 100; ++k)
+    {
+        bool present = k >= 0 && k < 100 && k % 2 == 0;
+        assert(m.contains(k) == present);
+        assert(m.count(k) == (present ? 1u : 0u));
+        auto it = m.find(k);
+        auto cit = c.find(k);
+        ASSERT_SAME_TYPE(decltype(cit), typename M::const_iterator);
+        if (present)
+        {
+            assert(it != m.end() && it->first == k && it->second == k / 2);
+            assert(cit == it);
+        }
+        else
+        {
+            assert(it == m.end() && cit == c.end());
+        }
+        auto lb = m.lower_bound(k);
+        auto ub = c.upper_bound(k);
+        int first = k < 0 ? 0 : (k + 1) / 2;
+        assert(lb - m.begin() == first);
+        assert(ub - c.begin() == (k < 0 ? 0 : k / 2 + 1 > 50 ? 50 : k / 2 + 1));
+        auto er = m.equal_range(k);
+        assert(er.first == lb);
+        assert(er.second - er.first == (present ? 1 : 0));
+        auto cer = c.equal_range(k);
+        assert(cer.first == er.first && cer.second == er.second);
+    }
+}
+
+int main(int, char**)
+{
+    test<std::flat_map<int, int>>();
+    test<std::flat_map<int, int, std::less<>>>();
+    {
+        std::flat_map<std::string, int, std::less<>> m = {{"apple", 1}, {"banana", 2}, {"cherry", 3}};
+        std::string_view sv = "banana";
+        assert(m.find(sv)->second == 2);
+        assert(m.contains("cherry") && !m.contains("date"));
+        assert(m.count(sv) == 1);
+        assert(m.lower_bound("b")->first == "banana");
+        assert(m.upper_bound(sv)->first == "cherry");
+        auto r = m.equal_range(sv);
+        assert(r.second - r.first == 1);
+    }
+
+  return 0;
+}
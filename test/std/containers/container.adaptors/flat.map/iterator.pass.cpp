@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17, c++20
+
+// <flat_map>
+
+// iterator begin();
+// const_iterator begin() const;
+// reverse_iterator rbegin();
+// ...
+// friend bool operator==(const flat_map& x, const flat_map& y);
+// friend synth-three-way-result<value_type> operator<=>(const flat_map& x, const flat_map& y);
+
+#include <flat_map>
+#include <cassert>
+#include <compare>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "test_macros.h"
+
+typedef std::flat_map<int, double> M;
+
+static_assert(std::random_access_iterator<M::iterator>);
+static_assert(std::random_access_iterator<M::const_iterator>);
+static_assert(std::is_convertible_v<M::iterator, M::const_iterator>);
+static_assert(!std::is_convertible_v<M::const_iterator, M::iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<M::iterator>, std::pair<const int&, double&>>);
+static_assert(std::is_same_v<std::iter_reference_t<M::const_iterator>, std::pair<const int&, const double&>>);
+static_assert(std::is_same_v<std::iter_value_t<M::iterator>, std::pair<int, double>>);
+
+int main(int, char**)
+{
+    {
+        M m = {{3, 3.0}, {1, 1.0}, {2, 2.0}};
+        int expected = 1;
+        for (M::iterator it = m.begin(); it != m.end(); ++it, ++expected)
+        {
+            assert((*it).first == expected);
+            it->second *= 10;
+        }
+        assert(m.at(2) == 20.0);
+        M::reverse_iterator r = m.rbegin();
+        assert(r->first == 3 && (*r).second == 30.0);
+        ++r;
+        assert(r->first == 2);
+        assert(m.rend() - m.rbegin() == 3);
+
+        const M& c = m;
+        M::const_iterator ci = c.begin();
+        assert(ci == m.begin() && ci == m.cbegin());
+        assert(ci[2].first == 3);
+        assert((ci + 2)->second == 30.0);
+        assert(c.end() - ci == 3);
+        assert(ci < c.end() && c.end() > ci && ci <= ci && ci >= ci);
+        ci += 3;
+        assert(ci == c.cend());
+        ci -= 1;
+        assert(ci-- == c.end() - 1);
+        assert(ci == c.begin() + 1);
+        assert(c.crbegin()->first == 3 && std::prev(c.crend())->first == 1);
+
+        M::iterator def{};
+        (void)def;
+    }
+    {
+        M a = {{1, 1.0}, {2, 2.0}};
+        M b = {{1, 1.0}, {2, 3.0}};
+        M c = {{1, 1.0}};
+        assert(a == a && a != b);
+        assert(a < b && c < a);
+        assert((a <=> b) == std::partial_ordering::less);
+        assert((a <=> a) == std::partial_ordering::equivalent);
+        std::flat_map<int, int> x = {{1, 1}}, y = {{1, 2}};
+        ASSERT_SAME_TYPE(decltype(x <=> y), std::strong_ordering);
+        assert((x <=> y) == std::strong_ordering::less);
+        swap(x, y);
+        assert(x.at(1) == 2 && y.at(1) == 1);
+    }
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17, c++20
+
+// <flat_map>
+
+// class flat_multimap
+
+#include <flat_map>
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_macros.h"
+
+template <class M>
+void check_like_multimap(const M& m, const std::multimap<int, int>& expected)
+{
+    assert(m.size() == expected.size());
+    assert(m.keys().size() == m.values().size());
+    auto it = m.begin();
+    for (const auto& p : expected)
+    {
+        assert(it->first == p.first);
+        assert(it->second == p.second);
+        ++it;
+    }
+}
+
+template <class M>
+void test()
+{
+    typedef std::pair<int, int> P;
+    // Equivalent keys keep their insertion order, as in std::multimap.
+    for (int n : {0, 1, 2, 10, 100, 1000})
+    {
+        std::vector<P> existing;
+        for (int i = 0; i < n; ++i)
+            existing.push_back(P(i % 7, i));
+        std::vector<P> added;
+        for (int i = 0; i < n; ++i)
+            added.push_back(P((i * 7919) % 11, -i));
+
+        M m(existing.begin(), existing.end());
+        std::multimap<int, int> expected(existing.begin(), existing.end());
+        check_like_multimap(m, expected);
+        m.insert(added.begin(), added.end());
+        expected.insert(added.begin(), added.end());
+        check_like_multimap(m, expected);
+
+        auto e = m.equal_range(3);
+        auto r = expected.equal_range(3);
+        assert(static_cast<std::size_t>(e.second - e.first) == expected.count(3));
+        assert(m.count(3) == expected.count(3));
+        if (e.first != e.second)
+            assert(e.first->second == r.first->second);
+        assert(m.erase(3) == expected.erase(3));
+        check_like_multimap(m, expected);
+    }
+}
+
+int main(int, char**)
+{
+    test<std::flat_multimap<int, int>>();
+    test<std::flat_multimap<int, int, std::less<int>, std::deque<int>, std::deque<int>>>();
+    {
+        typedef std::flat_multimap<int, char> M;
+        M m;
+        M::iterator it = m.emplace(2, 'a');
+        assert(it == m.begin());
+        m.emplace(1, 'b');
+        it = m.emplace(2, 'c');
+        assert(it == m.end() - 1 && it->second == 'c');
+        // The hint decides where an equivalent key goes.
+        it = m.emplace_hint(m.begin() + 1, 2, 'd');
+        assert(it == m.begin() + 1);
+        assert((m.keys() == std::vector<int>{1, 2, 2, 2}));
+        assert((m.values() == std::vector<char>{'b', 'd', 'a', 'c'}));
+        it = m.insert(std::make_pair(0, 'e'));
+        assert(it == m.begin());
+        m.insert(std::sorted_equivalent, {{3, 'f'}, {3, 'g'}});
+        assert(m.size() == 7 && (m.end() - 1)->second == 'g');
+        assert(std::erase_if(m, [](auto p) { return p.first == 2; }) == 3);
+        assert((m.keys() == std::vector<int>{0, 1, 3, 3}));
+    }
+    {
+        std::flat_multimap<std::string, int, std::less<>> m = {{"b", 1}, {"a", 2}, {"b", 3}};
+        assert(m.count("b") == 2 && m.contains("a") && !m.contains("c"));
+        assert(m.find("b")->second == 1);
+        assert(m.lower_bound("b") - m.begin() == 1 && m.upper_bound("b") == m.end());
+        assert(m.erase("b") == 2 && m.size() == 1);
+    }
+    {
+        std::flat_multimap<int, int> a = {{1, 1}, {1, 2}};
+        std::flat_multimap<int, int> b = {{1, 1}, {1, 3}};
+        assert(a != b && a < b && (a <=> b) == std::strong_ordering::less);
+        std::flat_multimap c(std::sorted_equivalent, std::vector<int>{1, 1}, std::vector<double>{1.0, 2.0});
+        ASSERT_SAME_TYPE(decltype(c), std::flat_multimap<int, double>);
+        assert(c.size() == 2);
+    }
+
+  return 0;
+}
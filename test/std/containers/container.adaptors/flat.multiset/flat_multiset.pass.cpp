@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17, c++20
+
+// <flat_set>
+
+// class flat_multiset
+
+#include <flat_set>
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "test_macros.h"
+
+template <class S>
+void test()
+{
+    for (int n : {0, 1, 2, 10, 100, 1000})
+    {
+        std::vector<int> existing;
+        for (int i = 0; i < n; ++i)
+            existing.push_back(i % 7);
+        std::vector<int> added;
+        for (int i = 0; i < n; ++i)
+            added.push_back((i * 7919) % 11);
+
+        S s(existing.begin(), existing.end());
+        std::multiset<int> expected(existing.begin(), existing.end());
+        s.insert(added.begin(), added.end());
+        expected.insert(added.begin(), added.end());
+        assert(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+        assert(s.count(3) == expected.count(3));
+        assert(s.erase(3) == expected.erase(3));
+        assert(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+    }
+}
+
+int main(int, char**)
+{
+    test<std::flat_multiset<int>>();
+    test<std::flat_multiset<int, std::less<int>, std::deque<int>>>();
+    {
+        std::flat_multiset<std::string, std::less<>> s{"b", "a", "b"};
+        assert(s.count("b") == 2);
+        s.emplace("b");
+        assert(s.count("b") == 3);
+        s.insert(s.begin(), "c");
+        assert(*s.rbegin() == "c");
+        auto r = s.equal_range("b");
+        assert(r.second - r.first == 3);
+        assert(s.erase("b") == 3 && s.size() == 2);
+    }
+    {
+        std::flat_multiset s(std::sorted_equivalent, {1, 1, 2});
+        ASSERT_SAME_TYPE(decltype(s), std::flat_multiset<int>);
+        assert(s.size() == 3);
+        s.insert({0, 2, 1});
+        assert((std::move(s).extract() == std::vector<int>{0, 1, 1, 1, 2, 2}));
+    }
+
+  return 0;
+}
@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17, c++20
+
+// <flat_set>
+
+// class flat_set
+
+#include <flat_set>
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_iterators.h"
+#include "test_macros.h"
+
+typedef std::flat_set<int> S;
+static_assert(std::random_access_iterator<S::iterator>);
+static_assert(std::is_same_v<S::iterator, S::const_iterator>);
+
+template <class S>
+void test()
+{
+    for (int n : {0, 1, 2, 10, 100, 1000})
+    {
+        std::vector<int> existing;
+        for (int i = 0; i < n; ++i)
+            existing.push_back(2 * i);
+        std::vector<int> added;
+        for (int i = 0; i < n; ++i)
+            added.push_back((i * 7919) % (2 * n + 5));
+
+        S s(existing.begin(), existing.end());
+        std::set<int> expected(existing.begin(), existing.end());
+        s.insert(added.begin(), added.end());
+        expected.insert(added.begin(), added.end());
+        assert(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+        s.insert(cpp17_input_iterator<const int*>(added.data()),
+                 cpp17_input_iterator<const int*>(added.data() + added.size()));
+        assert(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+    }
+}
+
+int main(int, char**)
+{
+    test<S>();
+    test<std::flat_set<int, std::less<int>, std::deque<int>>>();
+    {
+        S s{5, 3, 9, 3, 1};
+        assert(s.size() == 4 && *s.begin() == 1);
+        assert(s.insert(7).second && !s.insert(7).second);
+        assert(*s.insert(s.end(), 100) == 100);
+        assert(*s.insert(s.begin(), 100) == 100 && s.size() == 6);
+        assert(s.erase(5) == 1 && !s.contains(5) && s.count(3) == 1);
+        assert(*s.lower_bound(4) == 7 && *s.upper_bound(7) == 9);
+        assert(s.erase(s.begin()) == s.begin() && *s.begin() == 3);
+        S t = s;
+        assert(t == s);
+        t.insert(1000);
+        assert(s < t && (s <=> t) == std::strong_ordering::less);
+        assert(std::erase_if(t, [](int x) { return x % 2 == 0; }) == 2);
+        assert((std::move(t).extract() == std::vector<int>{3, 7, 9}));
+        assert(t.empty());
+    }
+    {
+        std::flat_set<std::string, std::less<>> s = {"b", "a"};
+        assert(s.contains("a") && s.find("b") == s.begin() + 1);
+        assert(s.insert("c").second && s.size() == 3);
+        assert(s.erase("a") == 1);
+    }
+    {
+        std::flat_set<int, std::greater<int>, std::deque<int>> d({3, 1, 2, 3});
+        assert(*d.begin() == 3 && d.size() == 3);
+        std::flat_set s(std::vector<int>{3, 1, 2, 1});
+        ASSERT_SAME_TYPE(decltype(s), std::flat_set<int>);
+        assert(s.size() == 3);
+        s.replace(std::vector<int>{1, 4});
+        assert(*s.rbegin() == 4);
+    }
+
+  return 0;
+}
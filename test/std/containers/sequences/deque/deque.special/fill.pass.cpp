@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <deque>
+
+// Optimization for deque::iterators
+
+// template <class ForwardIterator, class T>
+//   void
+//   fill(ForwardIterator first, ForwardIterator last, const T& value);
+
+#include <deque>
+#include <algorithm>
+#include <cassert>
+
+#include "test_macros.h"
+#include "min_allocator.h"
+
+// Returns a deque of size elements numbered from 0, that starts start elements into its first block.
+template <class C>
+C
+make(int size, int start)
+{
+    C c;
+    for (int i = 0; i < start; ++i)
+        c.push_back(0);
+    for (int i = 0; i < size; ++i)
+        c.push_back(static_cast<typename C::value_type>(i));
+    for (int i = 0; i < start; ++i)
+        c.pop_front();
+    return c;
+}
+
+template <class C>
+void testN(int start, int N)
+{
+    typedef typename C::value_type T;
+    for (int first = 0; first <= N; first += N / 3 + 1)
+    {
+        for (int last = first; last <= N; last += N / 5 + 1)
+        {
+            C c = make<C>(N, start);
+            std::fill(c.begin() + first, c.begin() + last, T(7));
+            for (int i = 0; i < N; ++i)
+                assert(c[i] == (i >= first && i < last ? T(7) : T(i)));
+        }
+    }
+}
+
+template <class C>
+void test()
+{
+    const int b = 4096 / sizeof(typename C::value_type);
+    int rng[] = {0, 1, 2, 3, b - 1, b, b + 1, 2 * b - 1, 2 * b, 2 * b + 1};
+    const int N = sizeof(rng)/sizeof(rng[0]);
+    for (int i = 0; i < N; ++i)
+        for (int j = 0; j < N; ++j)
+            testN<C>(rng[i], rng[j]);
+    {
+        C c;
+        std::fill(c.begin(), c.end(), typename C::value_type(7));
+        assert(c.empty());
+    }
+}
+
+int main(int, char**)
+{
+    test<std::deque<int> >();
+    test<std::deque<unsigned char> >();
+#if TEST_STD_VER >= 11
+    test<std::deque<int, min_allocator<int>> >();
+#endif
+
+  return 0;
+}
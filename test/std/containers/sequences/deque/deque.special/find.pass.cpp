@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <deque>
+
+// Optimization for deque::iterators
+
+// template <class InputIterator, class T>
+//   InputIterator
+//   find(InputIterator first, InputIterator last, const T& value);
+
+#include <deque>
+#include <algorithm>
+#include <cassert>
+
+#include "test_macros.h"
+#include "min_allocator.h"
+
+// Returns a deque of size zeros, that starts start elements into its first block.
+template <class C>
+C
+make(int size, int start)
+{
+    C c;
+    for (int i = 0; i < start; ++i)
+        c.push_back(1);
+    for (int i = 0; i < size; ++i)
+        c.push_back(0);
+    for (int i = 0; i < start; ++i)
+        c.pop_front();
+    return c;
+}
+
+template <class C>
+void testN(int start, int N)
+{
+    typedef typename C::value_type T;
+    typedef typename C::const_iterator CI;
+    C c = make<C>(N, start);
+    const C& cc = c;
+    assert(std::find(c.begin(), c.end(), T(1)) == c.end());
+    for (int pos = 0; pos < N; pos += N / 7 + 1)
+    {
+        c[pos] = T(1);
+        for (int first = 0; first <= N; first += N / 3 + 1)
+        {
+            for (int last = first; last <= N; last += N / 5 + 1)
+            {
+                CI expected = pos >= first && pos < last ? cc.begin() + pos : cc.begin() + last;
+                assert(std::find(cc.begin() + first, cc.begin() + last, T(1)) == expected);
+                assert(std::find(c.begin() + first, c.begin() + last, 1) == c.begin() + (expected - cc.begin()));
+            }
+        }
+        // Values that the elements can't hold match none of them.
+        assert(std::find(c.begin(), c.end(), 1 + 1024 * 1024) == c.end());
+        c[pos] = T(0);
+    }
+}
+
+template <class C>
+void test()
+{
+    const int b = 4096 / sizeof(typename C::value_type);
+    int rng[] = {0, 1, 2, 3, b - 1, b, b + 1, 2 * b - 1, 2 * b, 2 * b + 1};
+    const int N = sizeof(rng)/sizeof(rng[0]);
+    for (int i = 0; i < N; ++i)
+        for (int j = 0; j < N; ++j)
+            testN<C>(rng[i], rng[j]);
+    {
+        C c;
+        assert(std::find(c.begin(), c.end(), typename C::value_type(1)) == c.end());
+    }
+}
+
+int main(int, char**)
+{
+    test<std::deque<int> >();
+    test<std::deque<unsigned char> >();
+#if TEST_STD_VER >= 11
+    test<std::deque<int, min_allocator<int>> >();
+#endif
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <vector>
+// vector<bool>
+
+// std::count_if with vector<bool>::iterator
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+#include "test_macros.h"
+
+struct Identity
+{
+    bool operator()(bool b) const {return b;}
+};
+
+struct Not
+{
+    bool operator()(bool b) const {return !b;}
+};
+
+struct Always
+{
+    bool operator()(bool) const {return true;}
+};
+
+struct Never
+{
+    bool operator()(bool) const {return false;}
+};
+
+template <class Iter, class Pred>
+void test_range(Iter first, Iter last, Pred pred)
+{
+    std::ptrdiff_t expected = 0;
+    for (Iter i = first; i != last; ++i)
+        if (pred(*i))
+            ++expected;
+    assert(std::count_if(first, last, pred) == expected);
+}
+
+template <class Pred>
+void test(Pred pred)
+{
+    const unsigned sizes[] = {0, 1, 2, 31, 32, 33, 63, 64, 65, 127, 128, 129, 200};
+    for (std::size_t s = 0; s != sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        const unsigned n = sizes[s];
+        std::vector<bool> v(n);
+        for (unsigned i = 0; i != n; ++i)
+            v[i] = (i * 7) % 3 == 0;
+        const std::vector<bool>& cv = v;
+        for (unsigned first = 0; first <= n; first += n / 7 + 1)
+        {
+            for (unsigned last = first; last <= n; last += n / 5 + 1)
+            {
+                test_range(v.begin() + first, v.begin() + last, pred);
+                test_range(cv.begin() + first, cv.begin() + last, pred);
+            }
+        }
+        // Ranges of a single value.
+        std::vector<bool> ones(n, true);
+        test_range(ones.begin(), ones.end(), pred);
+        test_range(ones.begin() + n / 2, ones.end(), pred);
+    }
+}
+
+// A predicate may depend on more than the value of the bit it is given, and is applied to every bit.
+struct CountCalls
+{
+    int* calls;
+    bool operator()(bool b) const {++*calls; return b;}
+};
+
+struct EvenPosition
+{
+    std::vector<bool>::iterator begin;
+    bool operator()(std::vector<bool>::reference r) const {return (&r - begin) % 2 == 0;}
+};
+
+void test_stateful()
+{
+    std::vector<bool> v(100);
+    int calls = 0;
+    CountCalls count = {&calls};
+    assert(std::count_if(v.begin(), v.end(), count) == 0);
+    assert(calls == 100);
+    EvenPosition even = {v.begin()};
+    assert(std::count_if(v.begin(), v.end(), even) == 50);
+}
+
+int main(int, char**)
+{
+    test(Identity());
+    test(Not());
+    test(Always());
+    test(Never());
+    test_stateful();
+
+  return 0;
+}
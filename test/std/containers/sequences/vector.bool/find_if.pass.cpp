@@ -0,0 +1,130 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// <vector>
+// vector<bool>
+
+// std::find_if, std::find_if_not, std::any_of, std::all_of and std::none_of with vector<bool>::iterator
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+#include "test_macros.h"
+
+struct Identity
+{
+    bool operator()(bool b) const {return b;}
+};
+
+struct Not
+{
+    bool operator()(bool b) const {return !b;}
+};
+
+struct Always
+{
+    bool operator()(bool) const {return true;}
+};
+
+struct Never
+{
+    bool operator()(bool) const {return false;}
+};
+
+template <class Iter, class Pred>
+Iter naive_find_if(Iter first, Iter last, Pred pred)
+{
+    for (; first != last; ++first)
+        if (pred(*first))
+            break;
+    return first;
+}
+
+template <class Iter, class Pred>
+void test_range(Iter first, Iter last, Pred pred)
+{
+    Iter expected = naive_find_if(first, last, pred);
+    assert(std::find_if(first, last, pred) == expected);
+    assert(std::any_of(first, last, pred) == (expected != last));
+    assert(std::none_of(first, last, pred) == (expected == last));
+
+    Iter expected_not = first;
+    while (expected_not != last && pred(*expected_not))
+        ++expected_not;
+    assert(std::find_if_not(first, last, pred) == expected_not);
+    assert(std::all_of(first, last, pred) == (expected_not == last));
+}
+
+template <class Pred>
+void test(Pred pred)
+{
+    const unsigned sizes[] = {0, 1, 2, 31, 32, 33, 63, 64, 65, 127, 128, 129, 200};
+    for (std::size_t s = 0; s != sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        const unsigned n = sizes[s];
+        for (unsigned pos = 0; pos <= n; pos += n / 7 + 1)
+        {
+            for (int fill = 0; fill != 2; ++fill)
+            {
+                // All bits but the one at pos have the same value.
+                std::vector<bool> v(n, fill != 0);
+                if (pos < n)
+                    v[pos] = !v[pos];
+                const std::vector<bool>& cv = v;
+                for (unsigned first = 0; first <= n; first += n / 5 + 1)
+                {
+                    for (unsigned last = first; last <= n; last += n / 3 + 1)
+                    {
+                        test_range(v.begin() + first, v.begin() + last, pred);
+                        test_range(cv.begin() + first, cv.begin() + last, pred);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// A predicate may depend on more than the value of the bit it is given, here on its position.
+struct AtPosition
+{
+    std::vector<bool>::iterator begin;
+    std::ptrdiff_t pos;
+    bool operator()(std::vector<bool>::reference r) const {return &r - begin == pos;}
+};
+
+struct NotAtPosition
+{
+    std::vector<bool>::iterator begin;
+    std::ptrdiff_t pos;
+    bool operator()(std::vector<bool>::reference r) const {return &r - begin != pos;}
+};
+
+void test_position()
+{
+    std::vector<bool> v(100);
+    AtPosition at = {v.begin(), 42};
+    NotAtPosition not_at = {v.begin(), 42};
+    assert(std::find_if(v.begin(), v.end(), at) == v.begin() + 42);
+    assert(std::find_if_not(v.begin(), v.end(), not_at) == v.begin() + 42);
+    assert(std::any_of(v.begin(), v.end(), at));
+    assert(!std::none_of(v.begin(), v.end(), at));
+    assert(!std::all_of(v.begin(), v.end(), not_at));
+}
+
+int main(int, char**)
+{
+    test(Identity());
+    test(Not());
+    test(Always());
+    test(Never());
+    test_position();
+
+  return 0;
+}
@@ -0,0 +1,266 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14, c++17
+// UNSUPPORTED: libcpp-has-no-incomplete-ranges
+
+// <vector>
+// vector<bool>
+
+// The ranges:: algorithms with vector<bool>::iterator, some of which work a word at a time.
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <ranges>
+
+#include "test_macros.h"
+
+constexpr std::size_t sizes[] = {0, 1, 2, 31, 32, 33, 63, 64, 65, 127, 128, 129, 200};
+
+std::vector<bool> make(std::size_t n, std::size_t seed) {
+  std::vector<bool> v(n);
+  for (std::size_t i = 0; i != n; ++i)
+    v[i] = ((i + seed) * 7) % 5 < 2;
+  return v;
+}
+
+template <class Pred, class Proj>
+void test_search(const std::vector<bool>& v, std::size_t first, std::size_t last, Pred pred, Proj proj) {
+  auto b = v.begin() + first;
+  auto e = v.begin() + last;
+  auto expected      = b;
+  auto expected_not  = b;
+  std::ptrdiff_t matches = 0;
+  while (expected != e && !pred(proj(*expected)))
+    ++expected;
+  while (expected_not != e && pred(proj(*expected_not)))
+    ++expected_not;
+  for (auto i = b; i != e; ++i)
+    matches += pred(proj(*i)) ? 1 : 0;
+
+  assert(std::ranges::find_if(b, e, pred, proj) == expected);
+  assert(std::ranges::find_if_not(b, e, pred, proj) == expected_not);
+  assert(std::ranges::count_if(b, e, pred, proj) == matches);
+  assert(std::ranges::any_of(b, e, pred, proj) == (expected != e));
+  assert(std::ranges::none_of(b, e, pred, proj) == (expected == e));
+  assert(std::ranges::all_of(b, e, pred, proj) == (expected_not == e));
+
+  std::ranges::subrange r(b, e);
+  assert(std::ranges::find_if(r, pred, proj) == expected);
+  assert(std::ranges::count_if(r, pred, proj) == matches);
+}
+
+void test_search() {
+  auto identity = [](bool b) { return b; };
+  auto negate   = [](bool b) { return !b; };
+  auto always   = [](bool) { return true; };
+  auto never    = [](bool) { return false; };
+  auto to_int   = [](bool b) { return b ? 3 : 5; };
+  auto is_three = [](int i) { return i == 3; };
+
+  for (std::size_t n : sizes) {
+    for (std::size_t seed = 0; seed != 3; ++seed) {
+      std::vector<bool> v = n != 0 && seed == 2 ? std::vector<bool>(n, true) : make(n, seed);
+      for (std::size_t first = 0; first <= n; first += n / 5 + 1) {
+        for (std::size_t last = first; last <= n; last += n / 3 + 1) {
+          test_search(v, first, last, identity, std::identity());
+          test_search(v, first, last, negate, std::identity());
+          test_search(v, first, last, always, std::identity());
+          test_search(v, first, last, never, std::identity());
+          test_search(v, first, last, is_three, to_int);
+
+          auto b = v.begin() + first;
+          auto e = v.begin() + last;
+          for (bool value : {false, true}) {
+            assert(std::ranges::find(b, e, value) == std::find(b, e, value));
+            assert(std::ranges::count(b, e, value) == std::count(b, e, value));
+          }
+          assert(std::ranges::find(b, e, 3, to_int) == std::find(b, e, true));
+          assert(std::ranges::count(b, e, 5, to_int) == std::count(b, e, false));
+          assert(std::ranges::find(b, e, 4, to_int) == e);
+          assert(std::ranges::find(b, e, 1) == std::find(b, e, true));
+          assert(std::ranges::count(b, e, 0.0) == std::count(b, e, false));
+          assert(std::ranges::find(b, e, 2) == e);
+          assert(std::ranges::count(b, e, 2) == 0);
+        }
+      }
+    }
+  }
+}
+
+// Predicates on the position of the bit they are given, which only its reference knows. The overload for
+// bool is only there for the concepts, and is never called.
+struct AtPosition {
+  std::vector<bool>::iterator begin;
+  std::ptrdiff_t pos;
+  bool operator()(std::vector<bool>::reference r) const { return &r - begin == pos; }
+  bool operator()(bool) const {
+    assert(false);
+    return false;
+  }
+};
+
+struct EvenPosition {
+  std::vector<bool>::iterator begin;
+  bool operator()(std::vector<bool>::reference r) const { return (&r - begin) % 2 == 0; }
+  bool operator()(bool) const {
+    assert(false);
+    return false;
+  }
+};
+
+// The predicates and projections may depend on more than the value of the bit they are given, so they are
+// applied to every bit.
+void test_stateful_predicates() {
+  std::vector<bool> v(100);
+  int calls  = 0;
+  auto count = [&](bool b) {
+    ++calls;
+    return b;
+  };
+  assert(std::ranges::count_if(v, count) == 0);
+  assert(calls == 100);
+  calls = 0;
+  assert(std::ranges::none_of(v, count));
+  assert(calls == 100);
+  calls = 0;
+  assert(std::ranges::count(v, false, count) == 100);
+  assert(calls == 100);
+  calls = 0;
+  assert(std::ranges::find(v, true, count) == v.end());
+  assert(calls == 100);
+
+  auto b = v.begin();
+  AtPosition at_42{b, 42};
+  EvenPosition even{b};
+  assert(std::ranges::find_if(v, at_42) == b + 42);
+  assert(std::ranges::find_if_not(v, even) == b + 1);
+  assert(std::ranges::count_if(v, even) == 50);
+  assert(std::ranges::any_of(v, at_42));
+  assert(!std::ranges::all_of(v, even));
+  assert(!std::ranges::none_of(v, at_42));
+}
+
+// vector<bool>::iterator is only an output iterator since C++23, whose vector<bool>::reference can be
+// assigned through a const reference.
+#if TEST_STD_VER > 20
+void test_fill() {
+  for (std::size_t n : sizes) {
+    for (std::size_t first = 0; first <= n; first += n / 5 + 1) {
+      for (std::size_t last = first; last <= n; last += n / 3 + 1) {
+        for (bool value : {false, true}) {
+          std::vector<bool> v        = make(n, 0);
+          std::vector<bool> expected = v;
+          for (std::size_t i = first; i != last; ++i)
+            expected[i] = value;
+          assert(std::ranges::fill(v.begin() + first, v.begin() + last, value) == v.begin() + last);
+          assert(v == expected);
+
+          v = make(n, 0);
+          assert(std::ranges::fill_n(v.begin() + first, last - first, value) == v.begin() + last);
+          assert(v == expected);
+        }
+      }
+    }
+    std::vector<bool> v = make(n, 1);
+    assert(std::ranges::fill_n(v.begin(), -1, true) == v.begin());
+    assert(v == make(n, 1));
+  }
+}
+
+void test_copy() {
+  for (std::size_t n : sizes) {
+    const std::vector<bool> in = make(n, 1);
+    for (std::size_t first = 0; first <= n; first += n / 5 + 1) {
+      for (std::size_t last = first; last <= n; last += n / 3 + 1) {
+        for (std::size_t out = 0; out <= n - (last - first); out += n / 4 + 1) {
+          std::vector<bool> expected = make(n, 2);
+          for (std::size_t i = first; i != last; ++i)
+            expected[out + (i - first)] = in[i];
+
+          auto b = in.begin() + first;
+          auto e = in.begin() + last;
+          {
+            std::vector<bool> v = make(n, 2);
+            auto result         = std::ranges::copy(b, e, v.begin() + out);
+            assert(result.in == e);
+            assert(result.out == v.begin() + out + (last - first));
+            assert(v == expected);
+          }
+          {
+            std::vector<bool> v = make(n, 2);
+            auto result         = std::ranges::copy_backward(b, e, v.begin() + out + (last - first));
+            assert(result.in == e);
+            assert(result.out == v.begin() + out);
+            assert(v == expected);
+          }
+          {
+            std::vector<bool> v = make(n, 2);
+            auto result         = std::ranges::move(std::ranges::subrange(b, e), v.begin() + out);
+            assert(result.in == e);
+            assert(result.out == v.begin() + out + (last - first));
+            assert(v == expected);
+          }
+          {
+            std::vector<bool> v = make(n, 2);
+            auto result         = std::ranges::move_backward(b, e, v.begin() + out + (last - first));
+            assert(result.in == e);
+            assert(result.out == v.begin() + out);
+            assert(v == expected);
+          }
+        }
+      }
+    }
+  }
+}
+
+#endif
+
+void test_swap_ranges_and_equal() {
+  for (std::size_t n : sizes) {
+    for (std::size_t m : {std::size_t(0), n / 2, n, n + 40}) {
+      std::vector<bool> a = make(n, 0);
+      std::vector<bool> b = make(m, 1);
+      const std::vector<bool> old_a = a;
+      const std::vector<bool> old_b = b;
+      std::size_t common = std::min(n, m);
+
+      auto result = std::ranges::swap_ranges(a, b);
+      assert(result.in1 == a.begin() + common);
+      assert(result.in2 == b.begin() + common);
+      for (std::size_t i = 0; i != n; ++i)
+        assert(a[i] == (i < common ? old_b[i] : old_a[i]));
+      for (std::size_t i = 0; i != m; ++i)
+        assert(b[i] == (i < common ? old_a[i] : old_b[i]));
+
+      std::vector<bool> c = a;
+      assert(std::ranges::equal(a, c));
+      assert(std::ranges::equal(a.begin(), a.end(), c.begin(), c.end()));
+      assert(std::ranges::equal(a.begin(), a.end(), c.begin(), c.begin() + common) == (common == n));
+      if (n != 0) {
+        c[n - 1] = !c[n - 1];
+        assert(!std::ranges::equal(a, c));
+        assert(std::ranges::equal(a.begin(), a.end() - 1, c.begin(), c.end() - 1));
+      }
+    }
+  }
+}
+
+int main(int, char**) {
+  test_search();
+  test_stateful_predicates();
+#if TEST_STD_VER > 20
+  test_fill();
+  test_copy();
+#endif
+  test_swap_ranges_and_equal();
+
+  return 0;
+}
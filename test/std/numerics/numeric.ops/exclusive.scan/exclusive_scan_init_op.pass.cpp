@@ -93,9 +93,45 @@ test()
     return true;
 }
 
+// Contiguous ranges of integers long enough to hold several vectors of any
+// width, and a remainder.
+template <class T>
+void
+test_contiguous()
+{
+    const unsigned N = 100;
+    T ia[N];
+    T out[N];
+    T pRes[N];
+    T mRes[N];
+    for (unsigned i = 0; i < N; ++i)
+        ia[i] = static_cast<T>(i % 5 + 1);
+    T sum = T(3);
+    T product = T(3);
+    for (unsigned i = 0; i < N; ++i)
+    {
+        pRes[i] = sum;
+        mRes[i] = product;
+        sum = static_cast<T>(sum + ia[i]);
+        product = static_cast<T>(product * ia[i]);
+    }
+    for (unsigned n = 0; n <= N; n += 7)
+    {
+        T *end = std::exclusive_scan(ia, ia + n, out, T(3), std::plus<>());
+        assert(std::equal(out, end, pRes, pRes + n));
+        std::copy(ia, ia + n, out);
+        end = std::exclusive_scan(out, out + n, out, T(3), std::multiplies<T>());
+        assert(std::equal(out, end, mRes, mRes + n));
+    }
+}
+
 int main(int, char**)
 {
     test();
+    test_contiguous<char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
 #if TEST_STD_VER > 17
     static_assert(test());
 #endif
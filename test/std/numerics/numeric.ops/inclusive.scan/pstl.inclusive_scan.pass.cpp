@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: libcpp-has-no-incomplete-pstl
+
+// <numeric>
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2>
+//   ForwardIterator2
+//     inclusive_scan(ExecutionPolicy&& exec,
+//                    ForwardIterator1 first, ForwardIterator1 last,
+//                    ForwardIterator2 result);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2,
+//          class BinaryOperation>
+//   ForwardIterator2
+//     inclusive_scan(ExecutionPolicy&& exec,
+//                    ForwardIterator1 first, ForwardIterator1 last,
+//                    ForwardIterator2 result, BinaryOperation binary_op);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2,
+//          class BinaryOperation, class T>
+//   ForwardIterator2
+//     inclusive_scan(ExecutionPolicy&& exec,
+//                    ForwardIterator1 first, ForwardIterator1 last,
+//                    ForwardIterator2 result, BinaryOperation binary_op, T init);
+
+#include <cassert>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class Iter1, class Iter2>
+struct Test {
+  template <class ExecutionPolicy>
+  void operator()(ExecutionPolicy&& policy) {
+    for (std::size_t size : pstl_test_sizes) {
+      std::vector<long> in(size);
+      for (std::size_t i = 0; i != size; ++i)
+        in[i] = static_cast<long>(i % 13);
+      std::vector<long> expected(size);
+      std::partial_sum(in.begin(), in.end(), expected.begin());
+
+      {
+        std::vector<long> out(size, -1);
+        decltype(auto) ret = std::inclusive_scan(policy, Iter1(in.data()), Iter1(in.data() + in.size()), Iter2(out.data()));
+        static_assert(std::is_same_v<decltype(ret), Iter2>);
+        assert(base(ret) == out.data() + out.size());
+        assert(out == expected);
+      }
+      {
+        std::vector<long> out(size, -1);
+        decltype(auto) ret = std::inclusive_scan(
+            policy, Iter1(in.data()), Iter1(in.data() + in.size()), Iter2(out.data()), std::plus<>());
+        assert(base(ret) == out.data() + out.size());
+        assert(out == expected);
+      }
+      {
+        std::vector<long> out(size, -1);
+        decltype(auto) ret = std::inclusive_scan(
+            policy, Iter1(in.data()), Iter1(in.data() + in.size()), Iter2(out.data()), std::plus<>(), 100L);
+        assert(base(ret) == out.data() + out.size());
+        for (std::size_t i = 0; i != size; ++i)
+          assert(out[i] == expected[i] + 100);
+      }
+    }
+  }
+};
+
+int main(int, char**) {
+  test_execution_policies(Test<forward_iterator<long*>, forward_iterator<long*>>{});
+  test_execution_policies(Test<random_access_iterator<long*>, random_access_iterator<long*>>{});
+  test_execution_policies(Test<long*, long*>{});
+
+  // The operation is associative but not commutative: the order of the elements must be kept.
+  test_execution_policies([](auto&& policy) {
+    std::vector<std::string> in(10000);
+    for (std::size_t i = 0; i != in.size(); ++i)
+      in[i] = std::string(1, static_cast<char>('a' + i % 26));
+    std::vector<std::string> out(in.size());
+    std::inclusive_scan(policy, in.begin(), in.end(), out.begin(), std::plus<>(), std::string(">"));
+    for (std::size_t i = 0; i < in.size(); i += 997) {
+      assert(out[i].size() == i + 2);
+      assert(out[i][0] == '>');
+      for (std::size_t j = 0; j <= i; ++j)
+        assert(out[i][j + 1] == in[j][0]);
+    }
+  });
+
+  return 0;
+}
@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: libcpp-has-no-incomplete-pstl
+
+// <numeric>
+
+// template<class ExecutionPolicy, class ForwardIterator>
+//   typename iterator_traits<ForwardIterator>::value_type
+//     reduce(ExecutionPolicy&& exec,
+//            ForwardIterator first, ForwardIterator last);
+// template<class ExecutionPolicy, class ForwardIterator, class T>
+//   T reduce(ExecutionPolicy&& exec,
+//            ForwardIterator first, ForwardIterator last, T init);
+// template<class ExecutionPolicy, class ForwardIterator, class T, class BinaryOperation>
+//   T reduce(ExecutionPolicy&& exec,
+//            ForwardIterator first, ForwardIterator last, T init,
+//            BinaryOperation binary_op);
+
+#include <cassert>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class Iter>
+struct Test {
+  template <class ExecutionPolicy>
+  void operator()(ExecutionPolicy&& policy) {
+    for (std::size_t size : pstl_test_sizes) {
+      std::vector<long> v(size);
+      for (std::size_t i = 0; i != size; ++i)
+        v[i] = static_cast<long>(i);
+      long sum = static_cast<long>(size) * (static_cast<long>(size) - 1) / 2;
+
+      decltype(auto) r1 = std::reduce(policy, Iter(v.data()), Iter(v.data() + v.size()));
+      static_assert(std::is_same_v<decltype(r1), long>);
+      assert(r1 == sum);
+
+      decltype(auto) r2 = std::reduce(policy, Iter(v.data()), Iter(v.data() + v.size()), 10LL);
+      static_assert(std::is_same_v<decltype(r2), long long>);
+      assert(r2 == sum + 10);
+
+      decltype(auto) r3 =
+          std::reduce(policy, Iter(v.data()), Iter(v.data() + v.size()), 7L, [](long a, long b) { return a ^ b; });
+      static_assert(std::is_same_v<decltype(r3), long>);
+      long expected = 7;
+      for (long x : v)
+        expected ^= x;
+      assert(r3 == expected);
+    }
+  }
+};
+
+// The result type doesn't have to be default constructible.
+struct NoDefault {
+  explicit NoDefault(long v) : value(v) {}
+  long value;
+};
+
+struct AddNoDefault {
+  NoDefault operator()(NoDefault a, NoDefault b) const { return NoDefault(a.value + b.value); }
+  NoDefault operator()(NoDefault a, long b) const { return NoDefault(a.value + b); }
+  NoDefault operator()(long a, NoDefault b) const { return NoDefault(a + b.value); }
+  NoDefault operator()(long a, long b) const { return NoDefault(a + b); }
+};
+
+int main(int, char**) {
+  test_execution_policies(Test<forward_iterator<long*>>{});
+  test_execution_policies(Test<random_access_iterator<long*>>{});
+  test_execution_policies(Test<long*>{});
+
+  test_execution_policies([](auto&& policy) {
+    std::vector<long> v(100000, 1);
+    NoDefault r = std::reduce(policy, v.begin(), v.end(), NoDefault(5), AddNoDefault());
+    assert(r.value == 100005);
+  });
+
+  return 0;
+}
@@ -80,9 +80,40 @@ test()
     return true;
 }
 
+// Contiguous ranges long enough to hold several vectors of any width, and a
+// remainder. The products of their elements are powers of two, which are exact
+// in any order for floating-point types too.
+template <class T>
+void
+test_contiguous()
+{
+    const unsigned N = 100;
+    T ia[N];
+    for (unsigned i = 0; i < N; ++i)
+        ia[i] = static_cast<T>(i % 2 + 1);
+    for (unsigned n = 0; n <= N; n += 7)
+    {
+        T sum = T(3);
+        T product = T(3);
+        for (unsigned i = 0; i < n; ++i)
+        {
+            sum = static_cast<T>(sum + ia[i]);
+            product = static_cast<T>(product * ia[i]);
+        }
+        test(ia, ia + n, T(3), std::plus<>(), sum);
+        test(ia, ia + n, T(3), std::multiplies<T>(), product);
+    }
+}
+
 int main(int, char**)
 {
     test();
+    test_contiguous<char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<float>();
+    test_contiguous<double>();
 #if TEST_STD_VER > 17
     static_assert(test());
 #endif
@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: libcpp-has-no-incomplete-pstl
+
+// <numeric>
+
+// template<class ExecutionPolicy,
+//          class ForwardIterator1, class ForwardIterator2, class T>
+//   T transform_reduce(ExecutionPolicy&& exec,
+//                      ForwardIterator1 first1, ForwardIterator1 last1,
+//                      ForwardIterator2 first2, T init);
+//
+// template<class ExecutionPolicy,
+//          class ForwardIterator1, class ForwardIterator2, class T,
+//          class BinaryOperation1, class BinaryOperation2>
+//   T transform_reduce(ExecutionPolicy&& exec,
+//                      ForwardIterator1 first1, ForwardIterator1 last1,
+//                      ForwardIterator2 first2, T init,
+//                      BinaryOperation1 binary_op1, BinaryOperation2 binary_op2);
+
+#include <cassert>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class Iter1, class Iter2>
+struct Test {
+  template <class ExecutionPolicy>
+  void operator()(ExecutionPolicy&& policy) {
+    for (std::size_t size : pstl_test_sizes) {
+      std::vector<int> a(size);
+      std::vector<int> b(size);
+      for (std::size_t i = 0; i != size; ++i) {
+        a[i] = static_cast<int>(i % 10);
+        b[i] = static_cast<int>(i % 7);
+      }
+      long long dot = 0;
+      for (std::size_t i = 0; i != size; ++i)
+        dot += a[i] * b[i];
+
+      decltype(auto) r1 = std::transform_reduce(policy, Iter1(a.data()), Iter1(a.data() + a.size()), Iter2(b.data()), 1LL);
+      static_assert(std::is_same_v<decltype(r1), long long>);
+      assert(r1 == dot + 1);
+
+      decltype(auto) r2 = std::transform_reduce(
+          policy,
+          Iter1(a.data()),
+          Iter1(a.data() + a.size()),
+          Iter2(b.data()),
+          0LL,
+          std::plus<>(),
+          [](int x, int y) { return x == y ? 1 : 0; });
+      static_assert(std::is_same_v<decltype(r2), long long>);
+      long long equal = 0;
+      for (std::size_t i = 0; i != size; ++i)
+        equal += a[i] == b[i];
+      assert(r2 == equal);
+    }
+  }
+};
+
+int main(int, char**) {
+  test_execution_policies(Test<forward_iterator<int*>, forward_iterator<int*>>{});
+  test_execution_policies(Test<random_access_iterator<int*>, forward_iterator<int*>>{});
+  test_execution_policies(Test<random_access_iterator<int*>, random_access_iterator<int*>>{});
+  test_execution_policies(Test<int*, int*>{});
+
+  return 0;
+}
@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: libcpp-has-no-incomplete-pstl
+
+// <numeric>
+
+// template<class ExecutionPolicy, class ForwardIterator, class T,
+//          class BinaryOperation, class UnaryOperation>
+//   T transform_reduce(ExecutionPolicy&& exec,
+//                      ForwardIterator first, ForwardIterator last,
+//                      T init, BinaryOperation binary_op, UnaryOperation unary_op);
+
+#include <cassert>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include "test_execution_policies.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <class Iter>
+struct Test {
+  template <class ExecutionPolicy>
+  void operator()(ExecutionPolicy&& policy) {
+    for (std::size_t size : pstl_test_sizes) {
+      std::vector<int> v(size);
+      for (std::size_t i = 0; i != size; ++i)
+        v[i] = static_cast<int>(i % 100);
+      long long expected = 3;
+      for (int x : v)
+        expected += static_cast<long long>(x) * x;
+
+      decltype(auto) r = std::transform_reduce(
+          policy, Iter(v.data()), Iter(v.data() + v.size()), 3LL, std::plus<>(), [](int x) {
+            return static_cast<long long>(x) * x;
+          });
+      static_assert(std::is_same_v<decltype(r), long long>);
+      assert(r == expected);
+    }
+  }
+};
+
+int main(int, char**) {
+  test_execution_policies(Test<forward_iterator<int*>>{});
+  test_execution_policies(Test<random_access_iterator<int*>>{});
+  test_execution_policies(Test<int*>{});
+
+  return 0;
+}
@@ -117,9 +117,45 @@ test()
     return true;
 }
 
+// Contiguous ranges long enough to hold several vectors of any width, and a
+// remainder. The products of their elements are powers of two, which are exact
+// in any order for floating-point types too.
+template <class T>
+void
+test_contiguous()
+{
+    const unsigned N = 100;
+    T ia[N];
+    T ib[N];
+    for (unsigned i = 0; i < N; ++i)
+    {
+        ia[i] = static_cast<T>(i % 2 + 1);
+        ib[i] = static_cast<T>(i % 3 == 0 ? 2 : 1);
+    }
+    for (unsigned n = 0; n <= N; n += 7)
+    {
+        T dot = T(3);
+        T product = T(3);
+        for (unsigned i = 0; i < n; ++i)
+        {
+            dot = static_cast<T>(dot + static_cast<T>(ia[i] * ib[i]));
+            product = static_cast<T>(product * static_cast<T>(ia[i] + ib[i] - 1));
+        }
+        test(ia, ia + n, static_cast<const T*>(ib), T(3), std::plus<>(), std::multiplies<>(), dot);
+        test(static_cast<const T*>(ia), static_cast<const T*>(ia + n), ib, T(3), std::multiplies<T>(),
+             [](T x, T y) { return static_cast<T>(x + y - 1); }, product);
+    }
+}
+
 int main(int, char**)
 {
     test();
+    test_contiguous<char>();
+    test_contiguous<short>();
+    test_contiguous<unsigned>();
+    test_contiguous<long long>();
+    test_contiguous<float>();
+    test_contiguous<double>();
 #if TEST_STD_VER > 17
     static_assert(test());
 #endif
@@ -367,6 +367,31 @@ TEST_CONSTEXPR_CXX20 void test3()
     test(S("abcdeabcdeabcdeabcde"), "abcdeabcdeabcdeabcde", 21, 20, S::npos);
 }
 
+template <class S>
+TEST_CONSTEXPR_CXX20 void test4()
+{
+    // Repetitive strings, where most positions match a large part of the needle.
+    S s(641, 'a');
+    s[620] = 'b';
+    const char* n = s.c_str() + 600;
+    test(s, n, 0, 41, 600);
+    test(s, n, 600, 41, 600);
+    test(s, n, 601, 41, S::npos);
+    test(s, n, 0, 21, 600);
+    test(s, n + 20, 0, 21, 620);
+    test(S(600, 'a'), n, 0, 41, S::npos);
+
+    S t(501, 'b');
+    for (int i = 0; i != 500; ++i)
+        t[i] = "abaab"[i % 5];
+    const char* u = t.c_str() + 400;
+    test(t, u, 0, 100, 0);
+    test(t, u, 3, 100, 5);
+    test(t, u, 401, 100, S::npos);
+    test(t, u, 0, 101, 400);
+    test(t, u + 1, 0, 100, 401);
+}
+
 TEST_CONSTEXPR_CXX20 bool test() {
   {
     typedef std::string S;
@@ -374,6 +399,7 @@ TEST_CONSTEXPR_CXX20 bool test() {
     test1<S>();
     test2<S>();
     test3<S>();
+    test4<S>();
   }
 #if TEST_STD_VER >= 11
   {
@@ -382,6 +408,7 @@ TEST_CONSTEXPR_CXX20 bool test() {
     test1<S>();
     test2<S>();
     test3<S>();
+    test4<S>();
   }
 #endif
 
@@ -132,9 +132,27 @@ void test_custom_pred() {
     assert(ret.second == std::end(str));
 }
 
+void test_long_pattern() {
+    // The pattern is longer than the largest distance the skip table holds for chars.
+    std::string pattern(600, 'b');
+    pattern[0] = 'a';
+    std::string corpus(1000, 'b');
+    corpus.replace(350, pattern.size(), pattern);
+    std::boyer_moore_searcher searcher(pattern.begin(), pattern.end());
+    const std::boyer_moore_searcher copy = searcher;
+    auto ret = copy(corpus.begin(), corpus.end());
+    assert(ret.first == corpus.begin() + 350);
+    assert(ret.second == corpus.begin() + 950);
+    corpus[350] = 'c';
+    ret = searcher(corpus.begin(), corpus.end());
+    assert(ret.first == corpus.end());
+    assert(ret.second == corpus.end());
+}
+
 int main(int, char**) {
     test<random_access_iterator<const int*>, random_access_iterator<const int*> >();
     test2<random_access_iterator<const char*>, random_access_iterator<const char*> >();
+    test_long_pattern();
     test_custom_pred();
 
   return 0;
@@ -34,6 +34,7 @@
 #include <algorithm>
 #include <functional>
 #include <cassert>
+#include <string>
 
 #include "test_macros.h"
 #include "test_iterators.h"
@@ -122,9 +123,27 @@ test2()
     do_search(Iter1(ij), Iter1(ij+sj), Iter2(ik), Iter2(ik+sk), Iter1(ij+6));
 }
 
+void test_long_pattern() {
+    // The pattern is longer than the largest distance the skip table holds for chars.
+    std::string pattern(600, 'b');
+    pattern[0] = 'a';
+    std::string corpus(1000, 'b');
+    corpus.replace(350, pattern.size(), pattern);
+    std::boyer_moore_horspool_searcher searcher(pattern.begin(), pattern.end());
+    const std::boyer_moore_horspool_searcher copy = searcher;
+    auto ret = copy(corpus.begin(), corpus.end());
+    assert(ret.first == corpus.begin() + 350);
+    assert(ret.second == corpus.begin() + 950);
+    corpus[350] = 'c';
+    ret = searcher(corpus.begin(), corpus.end());
+    assert(ret.first == corpus.end());
+    assert(ret.second == corpus.end());
+}
+
 int main(int, char**) {
     test<random_access_iterator<const int*>, random_access_iterator<const int*> >();
     test2<random_access_iterator<const char*>, random_access_iterator<const char*> >();
+    test_long_pattern();
 
   return 0;
 }
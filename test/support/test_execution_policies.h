@@ -0,0 +1,34 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef TEST_SUPPORT_TEST_EXECUTION_POLICIES
+#define TEST_SUPPORT_TEST_EXECUTION_POLICIES
+
+#include <cstddef>
+#include <execution>
+#include <vector>
+
+#include "test_macros.h"
+
+// Sizes which cover the empty range, ranges that are too small to be split, and ranges that are
+// split into many chunks, some of which are larger than the others.
+inline const std::vector<std::size_t> pstl_test_sizes = {0, 1, 2, 3, 100, 4097, 65537, 250000};
+
+template <class Functor>
+bool test_execution_policies(Functor func) {
+  func(std::execution::seq);
+#if TEST_STD_VER >= 20
+  func(std::execution::unseq);
+#endif
+  func(std::execution::par);
+  func(std::execution::par_unseq);
+
+  return true;
+}
+
+#endif // TEST_SUPPORT_TEST_EXECUTION_POLICIES
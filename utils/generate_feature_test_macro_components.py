@@ -307,6 +307,16 @@ feature_test_macros = [ add_version_header(x) for x in [
     "headers": ["filesystem"],
     "test_suite_guard": "!defined(_LIBCPP_AVAILABILITY_DISABLE_FTM___cpp_lib_filesystem)",
     "libcxx_guard": "!defined(_LIBCPP_AVAILABILITY_DISABLE_FTM___cpp_lib_filesystem)"
+  }, {
+    "name": "__cpp_lib_flat_map",
+    "values": { "c++2b": 202207 },
+    "headers": ["flat_map"],
+    "unimplemented": True,
+  }, {
+    "name": "__cpp_lib_flat_set",
+    "values": { "c++2b": 202207 },
+    "headers": ["flat_set"],
+    "unimplemented": True,
   }, {
     "name": "__cpp_lib_format",
     "values": { "c++20": 202106 },
@@ -40,8 +40,12 @@ header_restrictions = {
     "wchar.h": "!defined(_LIBCPP_HAS_NO_WIDE_CHARACTERS)",
 
     "experimental/algorithm": "__cplusplus >= 201103L",
+    "experimental/btree_map": "__cplusplus >= 201703L",
+    "experimental/btree_set": "__cplusplus >= 201703L",
     "experimental/coroutine": "__cplusplus >= 201103L && !defined(_LIBCPP_HAS_NO_EXPERIMENTAL_COROUTINES)",
     "experimental/deque": "__cplusplus >= 201103L",
+    "experimental/flat_hash_map": "__cplusplus >= 201703L",
+    "experimental/flat_hash_set": "__cplusplus >= 201703L",
     "experimental/forward_list": "__cplusplus >= 201103L",
     "experimental/functional": "__cplusplus >= 201103L",
     "experimental/iterator": "__cplusplus >= 201103L",
@@ -49,6 +53,7 @@ header_restrictions = {
     "experimental/map": "__cplusplus >= 201103L",
     "experimental/memory_resource": "__cplusplus >= 201103L",
     "experimental/propagate_const": "__cplusplus >= 201103L",
+    "experimental/queue": "__cplusplus >= 201103L",
     "experimental/regex": "!defined(_LIBCPP_HAS_NO_LOCALIZATION) && __cplusplus >= 201103L",
     "experimental/set": "__cplusplus >= 201103L",
     "experimental/simd": "__cplusplus >= 201103L",